@@ -0,0 +1,255 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "AllocatorSubjects.hpp"
+#include "BenchCommon.hpp"
+#include "BenchSuites.hpp"
+#include "Traces.hpp"
+#include <optional>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using namespace Epic::Bench;
+
+	struct ThreadResult
+	{
+		std::vector<uint32_t> Latencies;	// Per-operation latency (ns)
+		uint64_t Ops = 0;					// Operations performed
+		uint64_t Failures = 0;				// Allocations and reallocations that failed
+		int64_t PeakLive = 0;				// Peak requested bytes held by this thread
+		int64_t Footprint = 0;				// Untracked bytes held by this thread's allocator
+	};
+
+	/* Replays trace against allocator.  When Timed, each operation's latency is recorded. */
+	template<bool Timed, class A>
+	void Replay(A& allocator, eSubjectLifetime lifetime, const Trace& trace, ThreadResult& result)
+	{
+		std::vector<Epic::Blk> blocks(trace.SlotCount);
+		std::vector<uint32_t> sizes(trace.SlotCount, 0);
+		int64_t live = 0;
+
+		if constexpr (Timed)
+			result.Latencies.reserve(trace.Ops.size());
+
+		auto timed = [&result] (auto&& fn)
+		{
+			if constexpr (Timed)
+			{
+				const auto begin = Clock::now();
+				fn();
+				result.Latencies.push_back(static_cast<uint32_t>(std::min<uint64_t>(ElapsedNs(begin, Clock::now()), UINT32_MAX)));
+			}
+			else
+				fn();
+		};
+
+		for (const auto& op : trace.Ops)
+		{
+			auto& blk = blocks[op.Slot];
+
+			if (op.Op == eTraceOp::EndFrame)
+			{
+				if (lifetime == eSubjectLifetime::Frame)
+				{
+					EndFrameOf(allocator);
+					std::fill(blocks.begin(), blocks.end(), Epic::Blk{ });
+					live = 0;
+				}
+
+				continue;
+			}
+
+			++result.Ops;
+
+			if (op.Op == eTraceOp::Deallocate)
+			{
+				if (blk)
+				{
+					timed([&] { DeallocateTo(allocator, blk); });
+					live -= sizes[op.Slot];
+					blk = { };
+				}
+
+				continue;
+			}
+
+			if (op.Size > A::MaxAllocSize)
+			{
+				++result.Failures;
+				continue;
+			}
+
+			bool succeeded;
+
+			if (blk)
+				timed([&] { succeeded = ReallocateIn(allocator, blk, op.Size); });
+			else
+			{
+				timed([&] { blk = AllocateFrom(allocator, op.Size); });
+				succeeded = static_cast<bool>(blk);
+				sizes[op.Slot] = 0;
+			}
+
+			if (!succeeded)
+			{
+				++result.Failures;
+				continue;
+			}
+
+			// Touch the block as its owner would
+			static_cast<unsigned char*>(blk.Ptr)[op.Size - 1] = 1;
+
+			live += static_cast<int64_t>(op.Size) - sizes[op.Slot];
+			sizes[op.Slot] = op.Size;
+			result.PeakLive = std::max(result.PeakLive, live);
+		}
+
+		if (lifetime == eSubjectLifetime::Frame)
+			EndFrameOf(allocator);
+		else
+		{
+			for (auto& blk : blocks)
+				if (blk) DeallocateTo(allocator, blk);
+		}
+	}
+
+	/* Runs one replay pass of traces on threadCount threads.  Returns the wall time in seconds. */
+	template<bool Timed, class A>
+	double RunPass(const SubjectInfo& info, const std::vector<Trace>& traces, size_t threadCount, std::vector<ThreadResult>& results)
+	{
+		results.assign(threadCount, ThreadResult{ });
+
+		// Instances are constructed in place; some allocators (e.g. StackAllocator) cannot live on the heap
+		std::optional<A> shared;
+		if (info.Scope == eSubjectScope::Shared)
+			shared.emplace();
+
+		const double seconds = RunThreads(threadCount, [&] (size_t index)
+		{
+			if (shared)
+				Replay<Timed>(*shared, info.Lifetime, traces[index], results[index]);
+			else
+			{
+				A allocator;
+				Replay<Timed>(allocator, info.Lifetime, traces[index], results[index]);
+				results[index].Footprint = GetUntrackedFootprint(allocator);
+			}
+		});
+
+		if (shared)
+			results[0].Footprint += GetUntrackedFootprint(*shared);
+
+		return seconds;
+	}
+
+	template<class A>
+	void RunSubject(const SubjectInfo& info, eTraceKind kind, const std::vector<Trace>& traces, size_t threadCount)
+	{
+		// Bytes of TrackingAllocator memory this subject still holds between runs
+		// (e.g. the shared allocator behind a ThreadCachedAllocator)
+		static int64_t s_Retained = 0;
+
+		std::vector<ThreadResult> results;
+
+		// Latency and footprint pass
+		const int64_t liveBefore = TrackingAllocator::GetLive();
+		TrackingAllocator::BeginTracking();
+		RunPass<true, A>(info, traces, threadCount, results);
+		const int64_t peak = TrackingAllocator::EndTracking();
+		const int64_t tracked = peak - liveBefore + s_Retained;
+		s_Retained += TrackingAllocator::GetLive() - liveBefore;
+
+		std::vector<uint32_t> latencies;
+		uint64_t failures = 0;
+		int64_t peakLive = 0;
+		int64_t untracked = 0;
+
+		for (auto& result : results)
+		{
+			latencies.insert(latencies.end(), result.Latencies.begin(), result.Latencies.end());
+			failures += result.Failures;
+			peakLive += result.PeakLive;
+
+			if (result.Footprint < 0) untracked = -1;
+			else if (untracked >= 0) untracked += result.Footprint;
+		}
+
+		// Throughput pass
+		const double seconds = RunPass<false, A>(info, traces, threadCount, results);
+
+		uint64_t ops = 0;
+		for (auto& result : results)
+			ops += result.Ops;
+
+		const auto latency = LatencySummary::From(latencies);
+		const double mops = ops / seconds * 1e-6;
+
+		std::printf("%-12s %-20s %3zu %9.2f %7llu %7llu %8llu %10.1f ",
+			GetTraceName(kind), info.Name, threadCount, mops,
+			static_cast<unsigned long long>(latency.P50),
+			static_cast<unsigned long long>(latency.P99),
+			static_cast<unsigned long long>(latency.P999),
+			peakLive / 1024.0);
+
+		if (untracked < 0)
+			std::printf("%11s %6s", "n/a", "n/a");
+		else
+		{
+			const int64_t footprint = tracked + untracked;
+			const double fragmentation = (footprint > 0) ? 100.0 * (1.0 - static_cast<double>(peakLive) / footprint) : 0.0;
+
+			std::printf("%11.1f %5.1f%%", footprint / 1024.0, std::max(0.0, fragmentation));
+		}
+
+		std::printf(" %7llu\n", static_cast<unsigned long long>(failures));
+		std::fflush(stdout);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Replays each trace against each allocator subject at 1..N threads.
+//	Mops/s		Trace operations per second (all threads), measured without per-op timing
+//	p50..p999	Per-operation latency in ns
+//	live KiB	Peak bytes requested by the trace (summed over threads)
+//	fp KiB		Peak bytes the subject held from its backing allocator (or committed)
+//	frag		1 - live / fp: the share of the footprint not holding live data
+//	fail		Requests the subject could not satisfy
+void Epic::Bench::RunAllocatorSuite(const Options& options)
+{
+	PrintHeading("alloc: allocator trace replay");
+	std::printf("%-12s %-20s %3s %9s %7s %7s %8s %10s %11s %6s %7s\n",
+		"trace", "allocator", "thr", "Mops/s", "p50", "p99", "p999", "live KiB", "fp KiB", "frag", "fail");
+
+	const auto threadCounts = options.GetThreadCounts();
+
+	for (auto kind : AllTraceKinds)
+	{
+		std::vector<Trace> traces;
+		for (size_t i = 0; i < options.MaxThreads; ++i)
+			traces.push_back(MakeTrace(kind, options.Ops, options.Seed + i));
+
+		ForEachAllocatorSubject([&] (auto tag, const SubjectInfo& info)
+		{
+			using A = typename decltype(tag)::AllocatorType;
+
+			if (!options.Selects(info.Name))
+				return;
+
+			for (auto threadCount : threadCounts)
+				RunSubject<A>(info, kind, traces, threadCount);
+		});
+	}
+}
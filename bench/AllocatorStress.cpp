@@ -0,0 +1,337 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "AllocatorSubjects.hpp"
+#include "BenchCommon.hpp"
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using namespace Epic::Bench;
+
+	/// StressBlock - A live block and the pattern it was filled with
+	struct StressBlock
+	{
+		Epic::Blk Blk;
+		uint32_t Size;
+		uint32_t Pattern;
+	};
+
+	/// Mailbox - Blocks handed to a thread to be freed there
+	struct Mailbox
+	{
+		std::mutex Mutex;
+		std::vector<StressBlock> Blocks;
+	};
+
+	/// StressContext - State shared by the threads of one run
+	struct StressContext
+	{
+		std::vector<Mailbox> Mailboxes;
+		std::atomic<size_t> Finished{ 0 };
+		std::atomic<uint64_t> Errors{ 0 };
+		std::atomic<uint64_t> Failures{ 0 };
+		std::mutex ReportMutex;
+	};
+
+	inline unsigned char PatternByte(uint32_t pattern, size_t i) noexcept
+	{
+		return static_cast<unsigned char>((pattern >> ((i & 3) * 8)) ^ (i * 131));
+	}
+
+	void Fill(const StressBlock& block) noexcept
+	{
+		auto p = static_cast<unsigned char*>(block.Blk.Ptr);
+
+		for (size_t i = 0; i < block.Size; ++i)
+			p[i] = PatternByte(block.Pattern, i);
+	}
+
+	/* Returns whether the first size bytes of block still hold its pattern. */
+	bool Verify(const StressBlock& block, size_t size) noexcept
+	{
+		auto p = static_cast<const unsigned char*>(block.Blk.Ptr);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (p[i] != PatternByte(block.Pattern, i))
+				return false;
+		}
+
+		return true;
+	}
+
+	template<class A>
+	class StressThread
+	{
+	private:
+		A& m_Allocator;
+		const SubjectInfo& m_Info;
+		StressContext& m_Context;
+		size_t m_Index;
+		std::mt19937_64 m_Rng;
+		std::vector<StressBlock> m_Live;
+		uint32_t m_NextPattern;
+
+	public:
+		StressThread(A& allocator, const SubjectInfo& info, StressContext& context, size_t index, uint64_t seed)
+			: m_Allocator{ allocator }, m_Info{ info }, m_Context{ context }, m_Index{ index },
+			  m_Rng{ seed + index }, m_NextPattern{ static_cast<uint32_t>(index << 24) }
+		{ }
+
+	private:
+		void Error(const char* what, const StressBlock& block)
+		{
+			if (m_Context.Errors.fetch_add(1) < 8)
+			{
+				std::lock_guard<std::mutex> lock(m_Context.ReportMutex);
+				std::fprintf(stderr, "  ERROR %s: %s (thread %zu, ptr %p, size %u)\n",
+					m_Info.Name, what, m_Index, block.Blk.Ptr, block.Size);
+			}
+		}
+
+		uint32_t RandomSize()
+		{
+			const uint32_t pick = m_Rng() % 100;
+			const uint32_t size = (pick < 70) ? 1 + m_Rng() % 128 : (pick < 95) ? 129 + m_Rng() % 896 : 1025 + m_Rng() % 7168;
+
+			return static_cast<uint32_t>(std::min<size_t>(size, A::MaxAllocSize));
+		}
+
+		/* Checks the invariants every block handed out must satisfy. */
+		void Check(const StressBlock& block)
+		{
+			if (block.Blk.Size < block.Size)
+				Error("block is smaller than requested", block);
+
+			if (reinterpret_cast<uintptr_t>(block.Blk.Ptr) % A::Alignment != 0)
+				Error("block is misaligned", block);
+
+			if (!m_Allocator.Owns(block.Blk))
+				Error("Owns() rejected its own block", block);
+		}
+
+		void Free(const StressBlock& block)
+		{
+			if (!Verify(block, block.Size))
+				Error("block was corrupted while live", block);
+
+			DeallocateTo(m_Allocator, block.Blk);
+		}
+
+		void Allocate()
+		{
+			StressBlock block{ { }, RandomSize(), m_NextPattern++ };
+
+			block.Blk = AllocateFrom(m_Allocator, block.Size);
+			if (!block.Blk)
+			{
+				m_Context.Failures.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			Check(block);
+			Fill(block);
+			m_Live.push_back(block);
+		}
+
+		void Reallocate(StressBlock& block)
+		{
+			if (!Verify(block, block.Size))
+				Error("block was corrupted while live", block);
+
+			const uint32_t size = RandomSize();
+			const uint32_t kept = std::min(size, block.Size);
+
+			if (!ReallocateIn(m_Allocator, block.Blk, size))
+			{
+				m_Context.Failures.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			block.Size = size;
+			Check(block);
+
+			if (!Verify(block, kept))
+				Error("reallocation lost the block's contents", block);
+
+			block.Pattern = m_NextPattern++;
+			Fill(block);
+		}
+
+		void DrainMailbox()
+		{
+			std::vector<StressBlock> blocks;
+
+			{	/* CS */
+				auto& mailbox = m_Context.Mailboxes[m_Index];
+				std::lock_guard<std::mutex> lock(mailbox.Mutex);
+				blocks.swap(mailbox.Blocks);
+			}
+
+			for (auto& block : blocks)
+				Free(block);
+		}
+
+		void Remove(size_t index)
+		{
+			std::swap(m_Live[index], m_Live.back());
+			m_Live.pop_back();
+		}
+
+	public:
+		void Run(size_t opCount)
+		{
+			const bool canHandOff = m_Info.Scope == eSubjectScope::Shared && m_Context.Mailboxes.size() > 1;
+			const bool isFrame = m_Info.Lifetime == eSubjectLifetime::Frame;
+
+			for (size_t op = 0; op < opCount; ++op)
+			{
+				const uint32_t pick = m_Rng() % 100;
+
+				if (m_Live.empty() || pick < 45)
+					Allocate();
+				else
+				{
+					const size_t index = m_Rng() % m_Live.size();
+
+					if (pick < 65)
+						Reallocate(m_Live[index]);
+					else if (pick < 95 || !canHandOff)
+					{
+						Free(m_Live[index]);
+						Remove(index);
+					}
+					else
+					{
+						// Hand the block to another thread to free
+						size_t target = m_Rng() % (m_Context.Mailboxes.size() - 1);
+						if (target >= m_Index) ++target;
+
+						auto& mailbox = m_Context.Mailboxes[target];
+						std::lock_guard<std::mutex> lock(mailbox.Mutex);
+						mailbox.Blocks.push_back(m_Live[index]);
+						Remove(index);
+					}
+				}
+
+				if (op % 64 == 63)
+					DrainMailbox();
+
+				if (isFrame && op % 256 == 255)
+				{
+					for (auto& block : m_Live)
+						if (!Verify(block, block.Size)) Error("block was corrupted while live", block);
+
+					m_Live.clear();
+					EndFrameOf(m_Allocator);
+				}
+			}
+
+			for (auto& block : m_Live)
+				Free(block);
+
+			m_Live.clear();
+
+			if (isFrame)
+				EndFrameOf(m_Allocator);
+
+			// Keep freeing handed-off blocks until every thread has stopped handing them out
+			m_Context.Finished.fetch_add(1);
+
+			while (m_Context.Finished.load() < m_Context.Mailboxes.size())
+			{
+				DrainMailbox();
+				std::this_thread::yield();
+			}
+
+			DrainMailbox();
+		}
+	};
+
+	template<class A>
+	uint64_t StressSubject(const SubjectInfo& info, const Options& options, size_t threadCount, std::map<size_t, double>& baselines)
+	{
+		StressContext context;
+		context.Mailboxes = std::vector<Mailbox>(threadCount);
+
+		// Instances are constructed in place; some allocators (e.g. StackAllocator) cannot live on the heap
+		std::optional<A> shared;
+		if (info.Scope == eSubjectScope::Shared)
+			shared.emplace();
+
+		const double seconds = RunThreads(threadCount, [&] (size_t index)
+		{
+			if (shared)
+				StressThread<A>(*shared, info, context, index, options.Seed).Run(options.Ops);
+			else
+			{
+				A allocator;
+				StressThread<A>(allocator, info, context, index, options.Seed).Run(options.Ops);
+			}
+		});
+
+		const double mops = threadCount * options.Ops / seconds * 1e-6;
+		if (baselines.count(threadCount) == 0)
+			baselines[threadCount] = mops;
+
+		const uint64_t errors = context.Errors.load();
+
+		std::printf("%-20s %3zu %9.2f %8.2fx %8llu  %s\n", info.Name, threadCount, mops, mops / baselines[threadCount],
+			static_cast<unsigned long long>(context.Failures.load()), errors ? "FAILED" : "ok");
+		std::fflush(stdout);
+
+		return errors;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// epic_stress [--threads N] [--ops N] [--seed N] [--filter TEXT] [--quick]
+//	Runs randomized allocate/reallocate/free sequences against every allocator subject at
+//	1..N threads.  Each block is filled with a pattern that is verified before it is resized
+//	or freed, and is checked for size, alignment and ownership.  Blocks of shared subjects
+//	are also handed to other threads to be freed there.  Throughput is reported relative to
+//	Mallocator.  Returns non-zero if any check failed.
+int main(int argc, char** argv)
+{
+	Options options;
+
+	if (!options.Parse(argc, argv, 200000))
+		return 1;
+
+	std::printf("epic_stress: %zu ops per thread, up to %zu threads, seed 0x%llx\n",
+		options.Ops, options.MaxThreads, static_cast<unsigned long long>(options.Seed));
+	std::printf("%-20s %3s %9s %9s %8s  %s\n", "allocator", "thr", "Mops/s", "vs malloc", "fail", "result");
+
+	std::map<size_t, double> baselines;
+	uint64_t errors = 0;
+
+	ForEachAllocatorSubject([&] (auto tag, const SubjectInfo& info)
+	{
+		using A = typename decltype(tag)::AllocatorType;
+
+		if (!options.Selects(info.Name) && std::strcmp(info.Name, "Mallocator") != 0)
+			return;
+
+		for (auto threadCount : options.GetThreadCounts())
+			errors += StressSubject<A>(info, options, threadCount, baselines);
+	});
+
+	return errors ? 1 : 0;
+}
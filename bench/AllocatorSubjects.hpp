@@ -0,0 +1,322 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Memory/AffixAllocator.hpp>
+#include <Epic/Memory/AlignedMallocator.hpp>
+#include <Epic/Memory/CascadingAllocator.hpp>
+#include <Epic/Memory/FrameArena.hpp>
+#include <Epic/Memory/FreelistAllocator.hpp>
+#include <Epic/Memory/HeapAllocator.hpp>
+#include <Epic/Memory/Mallocator.hpp>
+#include <Epic/Memory/SegregatorAllocator.hpp>
+#include <Epic/Memory/SlabAllocator.hpp>
+#include <Epic/Memory/StackAllocator.hpp>
+#include <Epic/Memory/TLSFAllocator.hpp>
+#include <Epic/Memory/ThreadCachedAllocator.hpp>
+#include <Epic/Memory/VirtualMemoryAllocator.hpp>
+#include <Epic/Memory/detail/AllocatorTraits.hpp>
+#include <Epic/Memory/MemoryBlock.hpp>
+#include <Epic/TMP/TypeTraits.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Bench
+{
+	class TrackingAllocator;
+
+	enum class eSubjectScope : uint8_t;
+	enum class eSubjectLifetime : uint8_t;
+
+	template<class Allocator>
+	struct SubjectTag;
+
+	struct SubjectInfo;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// TrackingAllocator
+//	The backing allocator for the subjects.  Forwards to AlignedMallocator and, while
+//	enabled, tracks the bytes held (and the peak) so that fragmentation can be reported
+//	as the footprint a subject needed to serve a trace.
+class Epic::Bench::TrackingAllocator
+{
+public:
+	using Type = Epic::Bench::TrackingAllocator;
+
+public:
+	static constexpr size_t Alignment = Epic::AlignedMallocator::Alignment;
+	static constexpr size_t MinAllocSize = 0;
+	static constexpr size_t MaxAllocSize = Epic::AlignedMallocator::MaxAllocSize;
+	static constexpr bool IsShareable = true;
+
+private:
+	static inline std::atomic<bool> s_IsEnabled{ false };
+	static inline std::atomic<int64_t> s_Live{ 0 };
+	static inline std::atomic<int64_t> s_Peak{ 0 };
+
+private:
+	static void Track(int64_t delta) noexcept
+	{
+		if (!s_IsEnabled.load(std::memory_order_relaxed))
+			return;
+
+		const int64_t live = s_Live.fetch_add(delta, std::memory_order_relaxed) + delta;
+		int64_t peak = s_Peak.load(std::memory_order_relaxed);
+
+		while (live > peak && !s_Peak.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+	}
+
+public:
+	/* Starts tracking.  The peak restarts from the bytes currently held. */
+	static void BeginTracking() noexcept
+	{
+		s_Peak.store(s_Live.load());
+		s_IsEnabled.store(true);
+	}
+
+	/* Stops tracking and returns the peak number of bytes held while it was enabled. */
+	static int64_t EndTracking() noexcept
+	{
+		s_IsEnabled.store(false);
+		return s_Peak.load();
+	}
+
+	/* Returns the number of bytes held that were allocated while tracking was enabled. */
+	static int64_t GetLive() noexcept
+	{
+		return s_Live.load();
+	}
+
+public:
+	constexpr bool Owns(const Blk&) const noexcept
+	{
+		return true;
+	}
+
+public:
+	Blk Allocate(size_t sz) const noexcept
+	{
+		return AllocateAligned(sz, Alignment);
+	}
+
+	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) const noexcept
+	{
+		auto blk = Epic::AlignedMallocator{ }.AllocateAligned(sz, alignment);
+		if (blk) Track(static_cast<int64_t>(blk.Size));
+
+		return blk;
+	}
+
+	bool Reallocate(Blk& blk, size_t sz) const
+	{
+		return ReallocateAligned(blk, sz, Alignment);
+	}
+
+	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = Alignment) const
+	{
+		const auto oldSize = static_cast<int64_t>(blk.Size);
+
+		if (!Epic::AlignedMallocator{ }.ReallocateAligned(blk, sz, alignment))
+			return false;
+
+		Track(static_cast<int64_t>(blk.Size) - oldSize);
+
+		return true;
+	}
+
+public:
+	void Deallocate(const Blk& blk) const
+	{
+		DeallocateAligned(blk);
+	}
+
+	void DeallocateAligned(const Blk& blk) const
+	{
+		if (!blk) return;
+
+		Track(-static_cast<int64_t>(blk.Size));
+		Epic::AlignedMallocator{ }.DeallocateAligned(blk);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// eSubjectScope
+enum class Epic::Bench::eSubjectScope : uint8_t
+{
+	Shared,			// One instance is used by every thread
+	PerThread		// Each thread uses its own instance
+};
+
+/// eSubjectLifetime
+enum class Epic::Bench::eSubjectLifetime : uint8_t
+{
+	Persistent,		// Blocks live until they are freed
+	Frame			// Blocks are reclaimed at the end of each frame
+};
+
+/// SubjectTag<A>
+template<class A>
+struct Epic::Bench::SubjectTag
+{
+	using AllocatorType = A;
+};
+
+/// SubjectInfo
+struct Epic::Bench::SubjectInfo
+{
+	const char* Name;
+	eSubjectScope Scope;
+	eSubjectLifetime Lifetime;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Bench
+{
+	namespace detail
+	{
+		template<class T> using HasNextFrame = decltype(std::declval<T>().NextFrame());
+		template<class T> using CanNextFrame = Epic::TMP::IsDetected<HasNextFrame, T>;
+
+		template<class T> using HasGetCommittedSize = decltype(std::declval<const T&>().GetCommittedSize());
+		template<class T> using CanGetCommittedSize = Epic::TMP::IsDetected<HasGetCommittedSize, T>;
+
+		struct ThreadCachedTag { };
+	}
+
+	/* Allocates sz bytes from allocator, using whichever allocation function it provides. */
+	template<class A>
+	Blk AllocateFrom(A& allocator, size_t sz) noexcept
+	{
+		if constexpr (Epic::detail::CanAllocate<A>::value)
+			return allocator.Allocate(sz);
+		else
+			return allocator.AllocateAligned(sz, A::Alignment);
+	}
+
+	/* Frees blk, if allocator supports freeing individual blocks. */
+	template<class A>
+	void DeallocateTo(A& allocator, const Blk& blk)
+	{
+		if constexpr (Epic::detail::CanDeallocate<A>::value)
+			allocator.Deallocate(blk);
+		else if constexpr (Epic::detail::CanDeallocateAligned<A>::value)
+			allocator.DeallocateAligned(blk);
+	}
+
+	/* Resizes blk to sz bytes.  If the allocator cannot resize blk itself, blk is moved
+	   to a new block, as a container would. */
+	template<class A>
+	bool ReallocateIn(A& allocator, Blk& blk, size_t sz)
+	{
+		if constexpr (Epic::detail::CanReallocate<A>::value)
+		{
+			if (allocator.Reallocate(blk, sz))
+				return true;
+		}
+		else if constexpr (Epic::detail::CanReallocateAligned<A>::value)
+		{
+			if (allocator.ReallocateAligned(blk, sz, A::Alignment))
+				return true;
+		}
+
+		Blk newBlk = AllocateFrom(allocator, sz);
+		if (!newBlk) return false;
+
+		std::memcpy(newBlk.Ptr, blk.Ptr, std::min(blk.Size, sz));
+		DeallocateTo(allocator, blk);
+		blk = newBlk;
+
+		return true;
+	}
+
+	/* Reclaims every block of a frame-lifetime subject. */
+	template<class A>
+	void EndFrameOf(A& allocator) noexcept
+	{
+		if constexpr (detail::CanNextFrame<A>::value)
+			allocator.NextFrame();
+		else if constexpr (Epic::detail::CanDeallocateAll<A>::value)
+			allocator.DeallocateAll();
+	}
+
+	/* Returns the bytes an allocator holds that are not reported by TrackingAllocator. */
+	template<class A>
+	int64_t GetUntrackedFootprint(const A& allocator) noexcept
+	{
+		if constexpr (detail::CanGetCommittedSize<A>::value)
+			return static_cast<int64_t>(allocator.GetCommittedSize());
+		else if constexpr (std::is_same_v<A, Epic::Mallocator>)
+			return -1;
+		else
+			return static_cast<int64_t>(sizeof(A));
+	}
+
+	/* Calls visit(SubjectTag<A>{ }, SubjectInfo) for each allocator under test.
+	   Fixed-size allocators sit behind a SegregatorAllocator so they can serve whole traces.
+	   Its threshold is exclusive, so it is one past the small allocator's largest block. */
+	template<class Visitor>
+	void ForEachAllocatorSubject(Visitor&& visit)
+	{
+		using namespace Epic;
+		using Backing = TrackingAllocator;
+
+		constexpr auto Shared = eSubjectScope::Shared;
+		constexpr auto PerThread = eSubjectScope::PerThread;
+		constexpr auto Persistent = eSubjectLifetime::Persistent;
+		constexpr auto Frame = eSubjectLifetime::Frame;
+
+		// Baseline
+		visit(SubjectTag<Mallocator>{ }, SubjectInfo{ "Mallocator", Shared, Persistent });
+
+		// Shared
+		visit(SubjectTag<SegregatorAllocator<129, SharedFreelistAllocator<Backing, 64, 128>, Backing>>{ },
+			SubjectInfo{ "SharedFreelist", Shared, Persistent });
+		visit(SubjectTag<SegregatorAllocator<129, LockFreeFreelistAllocator<Backing, 64, 128>, Backing>>{ },
+			SubjectInfo{ "LockFreeFreelist", Shared, Persistent });
+		visit(SubjectTag<SegregatorAllocator<129, ThreadCachedAllocator<SharedFreelistAllocator<Backing, 64, 128>, 32, detail::ThreadCachedTag>, Backing>>{ },
+			SubjectInfo{ "ThreadCached", Shared, Persistent });
+		visit(SubjectTag<SegregatorAllocator<4097, SharedSlabAllocator<Backing, 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 2048, 4096>, Backing>>{ },
+			SubjectInfo{ "SharedSlab", Shared, Persistent });
+		visit(SubjectTag<SharedHeapAllocator<64, 256 * 1024, Backing>>{ },
+			SubjectInfo{ "SharedHeap", Shared, Persistent });
+		visit(SubjectTag<SharedTLSFAllocator<Backing, 32 * 1024 * 1024>>{ },
+			SubjectInfo{ "SharedTLSF", Shared, Persistent });
+		visit(SubjectTag<SharedCascadingAllocator<SharedHeapAllocator<64, 8 * 1024, Backing>, Backing, eCascadingOwnership::Sorted>>{ },
+			SubjectInfo{ "SharedCascading", Shared, Persistent });
+		visit(SubjectTag<SharedVirtualMemoryAllocator<size_t(8) * 1024 * 1024 * 1024>>{ },
+			SubjectInfo{ "SharedVirtualMemory", Shared, Persistent });
+		visit(SubjectTag<AffixAllocator<Backing, size_t>>{ },
+			SubjectInfo{ "Affix", Shared, Persistent });
+
+		// Per-thread
+		visit(SubjectTag<HeapAllocator<64, 64 * 1024, Backing>>{ },
+			SubjectInfo{ "Heap", PerThread, Persistent });
+		visit(SubjectTag<TLSFAllocator<Backing, 8 * 1024 * 1024>>{ },
+			SubjectInfo{ "TLSF", PerThread, Persistent });
+		visit(SubjectTag<CascadingAllocator<HeapAllocator<64, 4 * 1024, Backing>, Backing, eCascadingOwnership::Sorted>>{ },
+			SubjectInfo{ "Cascading", PerThread, Persistent });
+		visit(SubjectTag<StackAllocator<1024 * 1024>>{ },
+			SubjectInfo{ "Stack", PerThread, Frame });
+		visit(SubjectTag<FrameArena<Backing, 256 * 1024>>{ },
+			SubjectInfo{ "FrameArena", PerThread, Frame });
+	}
+}
@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "BenchSuites.hpp"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	struct Suite
+	{
+		const char* Name;
+		void (*pRun)(const Epic::Bench::Options&);
+	};
+
+	constexpr Suite Suites[] =
+	{
+		{ "alloc", &Epic::Bench::RunAllocatorSuite },
+		{ "ecs", &Epic::Bench::RunEcsSuite },
+		{ "events", &Epic::Bench::RunEventSuite },
+		{ "shared-events", &Epic::Bench::RunSharedEventSuite },
+		{ "freelist", &Epic::Bench::RunFreelistSuite },
+		{ "slab", &Epic::Bench::RunSlabSuite },
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// epic_bench [suite...] [--threads N] [--ops N] [--seed N] [--filter TEXT] [--quick]
+int main(int argc, char** argv)
+{
+	Epic::Bench::Options options;
+
+	if (!options.Parse(argc, argv, 200000))
+		return 1;
+
+	for (const auto& name : options.Names)
+	{
+		if (std::none_of(std::begin(Suites), std::end(Suites), [&] (const Suite& suite) { return name == suite.Name; }))
+		{
+			std::fprintf(stderr, "Unknown suite '%s'\n", name.c_str());
+			return 1;
+		}
+	}
+
+	std::printf("epic_bench: %zu ops per thread, up to %zu threads, seed 0x%llx\n",
+		options.Ops, options.MaxThreads, static_cast<unsigned long long>(options.Seed));
+
+	for (const auto& suite : Suites)
+	{
+		if (options.RunsSuite(suite.Name))
+			suite.pRun(options);
+	}
+
+	return 0;
+}
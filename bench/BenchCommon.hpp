@@ -0,0 +1,243 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Bench
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct Options;
+	struct LatencySummary;
+
+	class StartGate;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Options
+//	Command line options shared by epic_bench and epic_stress.
+//		[name...]			Run only the named suites
+//		--threads N			Highest thread count to run (thread counts double from 1)
+//		--ops N				Operations per thread
+//		--seed N			Seed for the generated traces
+//		--filter TEXT		Run only the subjects whose name contains TEXT
+//		--quick				Small operation counts and at most 2 threads (used by ctest)
+struct Epic::Bench::Options
+{
+	size_t MaxThreads = 0;
+	size_t Ops = 0;
+	uint64_t Seed = 0x5EED5EED;
+	bool Quick = false;
+	std::string Filter;
+	std::vector<std::string> Names;
+
+	/* Parses argv.  Returns false (after printing the usage) if the arguments are invalid. */
+	bool Parse(int argc, char** argv, size_t defaultOps) noexcept
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const char* arg = argv[i];
+			const bool hasValue = (i + 1 < argc);
+
+			if (std::strcmp(arg, "--quick") == 0)
+				Quick = true;
+			else if (std::strcmp(arg, "--threads") == 0 && hasValue)
+				MaxThreads = std::strtoull(argv[++i], nullptr, 10);
+			else if (std::strcmp(arg, "--ops") == 0 && hasValue)
+				Ops = std::strtoull(argv[++i], nullptr, 10);
+			else if (std::strcmp(arg, "--seed") == 0 && hasValue)
+				Seed = std::strtoull(argv[++i], nullptr, 0);
+			else if (std::strcmp(arg, "--filter") == 0 && hasValue)
+				Filter = argv[++i];
+			else if (arg[0] != '-')
+				Names.emplace_back(arg);
+			else
+			{
+				std::fprintf(stderr, "usage: %s [name...] [--threads N] [--ops N] [--seed N] [--filter TEXT] [--quick]\n", argv[0]);
+				return false;
+			}
+		}
+
+		if (MaxThreads == 0)
+			MaxThreads = Quick ? 2 : std::clamp<size_t>(std::thread::hardware_concurrency(), 1, 16);
+
+		if (Ops == 0)
+			Ops = Quick ? defaultOps / 20 : defaultOps;
+
+		return true;
+	}
+
+	/* Returns 1, 2, 4, ... up to and including MaxThreads. */
+	std::vector<size_t> GetThreadCounts() const
+	{
+		std::vector<size_t> counts;
+
+		for (size_t n = 1; n < MaxThreads; n *= 2)
+			counts.push_back(n);
+
+		counts.push_back(MaxThreads);
+
+		return counts;
+	}
+
+	/* Returns whether or not the suite or subject 'name' was selected. */
+	bool Selects(const char* name) const noexcept
+	{
+		return Filter.empty() || std::strstr(name, Filter.c_str()) != nullptr;
+	}
+
+	/* Returns whether or not the suite 'name' should be run. */
+	bool RunsSuite(const char* name) const noexcept
+	{
+		return Names.empty() || std::find(Names.begin(), Names.end(), name) != Names.end();
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// LatencySummary
+struct Epic::Bench::LatencySummary
+{
+	uint64_t P50 = 0;
+	uint64_t P99 = 0;
+	uint64_t P999 = 0;
+	uint64_t Max = 0;
+
+	/* Summarizes samples (in nanoseconds).  The samples are reordered. */
+	static LatencySummary From(std::vector<uint32_t>& samples)
+	{
+		LatencySummary summary;
+
+		if (samples.empty())
+			return summary;
+
+		auto at = [&] (double q)
+		{
+			const size_t n = std::min(samples.size() - 1, static_cast<size_t>(q * samples.size()));
+			std::nth_element(samples.begin(), samples.begin() + n, samples.end());
+			return static_cast<uint64_t>(samples[n]);
+		};
+
+		summary.P50 = at(0.50);
+		summary.P99 = at(0.99);
+		summary.P999 = at(0.999);
+		summary.Max = *std::max_element(samples.begin(), samples.end());
+
+		return summary;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// StartGate
+//	Holds a group of threads until all of them are ready, then releases them at once.
+class Epic::Bench::StartGate
+{
+private:
+	std::atomic<size_t> m_Waiting;
+	std::atomic<bool> m_IsOpen;
+
+public:
+	StartGate() noexcept
+		: m_Waiting{ 0 }, m_IsOpen{ false }
+	{ }
+
+public:
+	/* Called by each participating thread. */
+	void Wait() noexcept
+	{
+		m_Waiting.fetch_add(1, std::memory_order_acq_rel);
+
+		while (!m_IsOpen.load(std::memory_order_acquire))
+			std::this_thread::yield();
+	}
+
+	/* Waits for count threads to arrive, then releases them. */
+	void Open(size_t count) noexcept
+	{
+		while (m_Waiting.load(std::memory_order_acquire) < count)
+			std::this_thread::yield();
+
+		m_IsOpen.store(true, std::memory_order_release);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Bench
+{
+	/* Returns the nanoseconds between begin and end. */
+	inline uint64_t ElapsedNs(Clock::time_point begin, Clock::time_point end) noexcept
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+	}
+
+	/* Runs fn(threadIndex) on threadCount threads that start together.
+	   Returns the wall time in seconds from their release until the last one finished. */
+	template<class Function>
+	double RunThreads(size_t threadCount, Function&& fn)
+	{
+		StartGate gate;
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+
+		for (size_t i = 0; i < threadCount; ++i)
+		{
+			threads.emplace_back([&gate, &fn, i]
+			{
+				gate.Wait();
+				fn(i);
+			});
+		}
+
+		gate.Open(threadCount);
+		const auto begin = Clock::now();
+
+		for (auto& thread : threads)
+			thread.join();
+
+		return ElapsedNs(begin, Clock::now()) * 1e-9;
+	}
+
+	namespace detail
+	{
+		inline std::atomic<uint64_t> s_Sink{ 0 };
+	}
+
+	/* Stores an arithmetic value where the optimizer cannot discard it. */
+	template<class T>
+	inline void Consume(T value) noexcept
+	{
+		detail::s_Sink.store(static_cast<uint64_t>(value), std::memory_order_relaxed);
+	}
+
+	/* Prints a suite heading. */
+	inline void PrintHeading(const char* title)
+	{
+		std::printf("\n== %s\n", title);
+	}
+}
@@ -0,0 +1,28 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "BenchCommon.hpp"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Bench
+{
+	void RunAllocatorSuite(const Options& options);
+	void RunEcsSuite(const Options& options);
+	void RunEventSuite(const Options& options);
+	void RunFreelistSuite(const Options& options);
+	void RunSlabSuite(const Options& options);
+	void RunSharedEventSuite(const Options& options);
+}
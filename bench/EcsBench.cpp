@@ -0,0 +1,174 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "BenchSuites.hpp"
+#include <Epic/EntityManager.hpp>
+#include <Epic/ThreadPool.hpp>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	struct BenchPosition { float X, Y, Z; };
+	struct BenchVelocity { float X, Y, Z; };
+	struct BenchHeading { float Angle, Turn; };
+}
+
+MAKE_ENTITY_COMPONENT(BenchPosition);
+MAKE_ENTITY_COMPONENT(BenchVelocity);
+MAKE_ENTITY_COMPONENT(BenchHeading);
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using namespace Epic::Bench;
+
+	/// EcsKernel - One parallel pass over the entities
+	struct EcsKernel
+	{
+		const char* Name;
+		void (*pRun)(Epic::EntityManager& manager, size_t grainSize);
+	};
+
+	// Memory bound: one multiply-add per component
+	void Integrate(Epic::EntityManager& manager, size_t grainSize)
+	{
+		manager.ParallelEach<BenchPosition, BenchVelocity>(
+			[] (Epic::Entity&, BenchPosition& position, BenchVelocity& velocity)
+			{
+				position.X += velocity.X * 0.016f;
+				position.Y += velocity.Y * 0.016f;
+				position.Z += velocity.Z * 0.016f;
+			}, grainSize);
+	}
+
+	// Compute bound: a few dozen transcendental calls per entity
+	void Steer(Epic::EntityManager& manager, size_t grainSize)
+	{
+		manager.ParallelEach<BenchVelocity, BenchHeading>(
+			[] (Epic::Entity&, BenchVelocity& velocity, BenchHeading& heading)
+			{
+				for (int i = 0; i < 16; ++i)
+				{
+					heading.Angle += heading.Turn * std::sin(heading.Angle);
+					velocity.X = std::cos(heading.Angle);
+					velocity.Z = std::sin(heading.Angle);
+				}
+			}, grainSize);
+	}
+
+	// Per-chunk accumulation followed by an ordered fold
+	void Reduce(Epic::EntityManager& manager, size_t grainSize)
+	{
+		Consume(manager.ParallelReduce<BenchPosition>(0.0,
+			[] (double& result, Epic::Entity&, BenchPosition& position)
+			{
+				result += position.X + position.Y + position.Z;
+			},
+			[] (double a, double b) { return a + b; }, grainSize));
+	}
+
+	constexpr EcsKernel EcsKernels[] =
+	{
+		{ "integrate", &Integrate },
+		{ "steer", &Steer },
+		{ "reduce", &Reduce },
+	};
+
+	/* Creates entityCount entities.  All have a position, 3/4 a velocity and 1/2 a heading. */
+	void Populate(Epic::EntityManager& manager, size_t entityCount)
+	{
+		for (size_t i = 0; i < entityCount; ++i)
+		{
+			auto pEntity = manager.CreateEntity();
+			const float f = static_cast<float>(i);
+
+			pEntity->Assign<BenchPosition>(f, 0.0f, -f);
+
+			if (i % 4 != 0)
+				pEntity->Assign<BenchVelocity>(1.0f, 0.5f, 0.25f);
+
+			if (i % 2 == 0)
+				pEntity->Assign<BenchHeading>(0.0f, 0.001f * (i % 100));
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// ecs: Scaling of EntityManager::ParallelEach/ParallelReduce with the worker count
+//	Entities:	--ops (entities are created once and reused for every run)
+//	Columns:	kernel, grain size, threads (caller + workers), entities/s, pass time
+//				percentiles, and speedup over the single-threaded run of the same kernel
+void Epic::Bench::RunEcsSuite(const Options& options)
+{
+	PrintHeading("ecs: ParallelEach/ParallelReduce scaling");
+
+	const size_t entityCount = options.Ops;
+	const size_t passCount = options.Quick ? 5 : 50;
+
+	Epic::EntityManager manager;
+	Populate(manager, entityCount);
+
+	std::printf("%zu entities, %zu passes per run\n", entityCount, passCount);
+	std::printf("%-10s %6s %4s %9s %10s %10s %8s\n", "kernel", "grain", "thr", "Ment/s", "p50 us", "p99 us", "speedup");
+
+	const size_t grainSizes[] = { 64, Epic::EntityManager::DefaultGrainSize, 4096 };
+
+	for (const auto& kernel : EcsKernels)
+	{
+		if (!options.Selects(kernel.Name))
+			continue;
+
+		for (auto grainSize : grainSizes)
+		{
+			double baseline = 0.0;
+
+			for (auto threadCount : options.GetThreadCounts())
+			{
+				// The calling thread takes part in ParallelFor, so it counts as one of the threads
+				Epic::ThreadPool pool(threadCount - 1);
+				manager.SetUpdateMode(Epic::eEntityUpdateMode::Parallel, &pool);
+
+				// Warm up the pool and the caches
+				kernel.pRun(manager, grainSize);
+
+				std::vector<uint32_t> samples;
+				samples.reserve(passCount);
+
+				const auto begin = Clock::now();
+
+				for (size_t pass = 0; pass < passCount; ++pass)
+				{
+					const auto passBegin = Clock::now();
+					kernel.pRun(manager, grainSize);
+					samples.push_back(static_cast<uint32_t>(ElapsedNs(passBegin, Clock::now()) / 1000));
+				}
+
+				const double seconds = ElapsedNs(begin, Clock::now()) * 1e-9;
+				const double rate = entityCount * passCount / seconds;
+
+				if (threadCount == 1)
+					baseline = rate;
+
+				const auto latency = LatencySummary::From(samples);
+
+				std::printf("%-10s %6zu %4zu %9.2f %10llu %10llu %7.2fx\n", kernel.Name, grainSize, threadCount, rate * 1e-6,
+					static_cast<unsigned long long>(latency.P50), static_cast<unsigned long long>(latency.P99), rate / baseline);
+				std::fflush(stdout);
+			}
+		}
+	}
+}
@@ -0,0 +1,396 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "BenchSuites.hpp"
+#include <Epic/Event.hpp>
+#include <Epic/SharedEvent.hpp>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using namespace Epic::Bench;
+
+	// Listener calls made by this thread (so concurrent invokers do not share a counter)
+	thread_local uint64_t t_ThreadCalls = 0;
+
+	/// Counter - A listener that accumulates what it receives
+	struct Counter
+	{
+		uint64_t Total = 0;
+
+		void OnValue(int value) noexcept
+		{
+			Total += static_cast<uint64_t>(value);
+		}
+
+		void OnThreadValue(int) noexcept
+		{
+			++t_ThreadCalls;
+		}
+	};
+
+	/// StdFunctionEvent - The listener storage and dispatch loop Event used before
+	//	Delegate: (handle, instance) pairs with a std::function, member functions bound
+	//	with std::bind, and the suspend flag that guards the list during invocation.
+	class StdFunctionEvent
+	{
+	private:
+		struct EventHandler
+		{
+			uint32_t Handle;
+			intptr_t Instance;
+		};
+
+		using DelegateType = std::function<void(int)>;
+
+	private:
+		std::vector<std::pair<EventHandler, DelegateType>> m_Listeners;
+		bool m_IsSuspended = false;
+
+	public:
+		template<class Function>
+		void Connect(const Function& fn)
+		{
+			m_Listeners.emplace_back(EventHandler{ 0, 0 }, fn);
+		}
+
+		void Connect(Counter* pThis, void (Counter::* fn)(int))
+		{
+			m_Listeners.emplace_back(EventHandler{ 0, reinterpret_cast<intptr_t>(pThis) }, 
+				std::bind(fn, pThis, std::placeholders::_1));
+		}
+
+		void operator() (int value)
+		{
+			m_IsSuspended = true;
+
+			for (auto& listener : m_Listeners)
+				listener.second(value);
+
+			m_IsSuspended = false;
+		}
+	};
+
+	/// CallableList<DelegateType> - Listeners called directly, without any event bookkeeping
+	template<class DelegateType>
+	class CallableList
+	{
+	private:
+		std::vector<DelegateType> m_Listeners;
+
+	public:
+		template<class Function>
+		void Connect(const Function& fn)
+		{
+			m_Listeners.emplace_back(fn);
+		}
+
+		void Connect(Counter* pThis, void (Counter::* fn)(int))
+		{
+			if constexpr (std::is_same_v<DelegateType, std::function<void(int)>>)
+				m_Listeners.emplace_back(std::bind(fn, pThis, std::placeholders::_1));
+			else
+				m_Listeners.emplace_back(pThis, fn);
+		}
+
+		template<auto Method>
+		void Connect(Counter* pThis)
+		{
+			m_Listeners.emplace_back(DelegateType::template Bind<Method>(pThis));
+		}
+
+		void operator() (int value)
+		{
+			for (auto& listener : m_Listeners)
+				listener(value);
+		}
+	};
+
+	using StdFunctionList = CallableList<std::function<void(int)>>;
+	using DelegateList = CallableList<Epic::Delegate<void(int)>>;
+
+	enum class eListenerKind
+	{
+		Member,			// Runtime member function pointer
+		BoundMember,	// Member function bound at compile time (Delegate only; std::bind otherwise)
+		Lambda			// Lambda capturing a pointer
+	};
+
+	const char* GetListenerKindName(eListenerKind kind) noexcept
+	{
+		switch (kind)
+		{
+		case eListenerKind::Member: return "member";
+		case eListenerKind::BoundMember: return "bound";
+		default: return "lambda";
+		}
+	}
+
+	template<class EventType>
+	void ConnectListeners(EventType& event, eListenerKind kind, std::vector<Counter>& counters)
+	{
+		for (auto& counter : counters)
+		{
+			Counter* pCounter = &counter;
+
+			if (kind == eListenerKind::Lambda)
+				event.Connect([pCounter] (int value) { pCounter->OnValue(value); });
+			else if constexpr (std::is_same_v<EventType, StdFunctionEvent> || std::is_same_v<EventType, StdFunctionList>)
+				event.Connect(pCounter, &Counter::OnValue);
+			else if (kind == eListenerKind::Member)
+				event.Connect(pCounter, &Counter::OnValue);
+			else
+				event.template Connect<&Counter::OnValue>(pCounter);
+		}
+	}
+
+	/* Returns the mean nanoseconds per dispatch of invocationCount invocations. */
+	template<class EventType>
+	double TimeDispatch(eListenerKind kind, size_t listenerCount, size_t invocationCount)
+	{
+		std::vector<Counter> counters(listenerCount);
+		EventType event;
+
+		ConnectListeners(event, kind, counters);
+
+		// Warm up
+		for (size_t i = 0; i < invocationCount / 10; ++i)
+			event(static_cast<int>(i));
+
+		const auto begin = Clock::now();
+
+		for (size_t i = 0; i < invocationCount; ++i)
+			event(static_cast<int>(i));
+
+		const double ns = static_cast<double>(ElapsedNs(begin, Clock::now())) / invocationCount;
+
+		uint64_t total = 0;
+		for (auto& counter : counters)
+			total += counter.Total;
+
+		Consume(total);
+
+		return ns;
+	}
+
+	/// LockedEvent - The alternative to SharedEvent: an Event behind a mutex
+	class LockedEvent
+	{
+	private:
+		Epic::Event<void(int)> m_Event;
+		mutable std::mutex m_Mutex;
+
+	public:
+		void Connect(Counter* pThis)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Event.Connect(pThis, &Counter::OnThreadValue);
+		}
+
+		void Disconnect(Counter* pThis)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Event.Disconnect(pThis);
+		}
+
+		void operator() (int value)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Event(value);
+		}
+	};
+
+	/// SharedEventAdapter - SharedEvent with the same interface as LockedEvent
+	class SharedEventAdapter
+	{
+	private:
+		Epic::SharedEvent<void(int)> m_Event;
+
+	public:
+		void Connect(Counter* pThis)
+		{
+			m_Event.Connect(pThis, &Counter::OnThreadValue);
+		}
+
+		void Disconnect(Counter* pThis)
+		{
+			m_Event.Disconnect(pThis);
+		}
+
+		void operator() (int value)
+		{
+			m_Event(value);
+		}
+	};
+
+	/// ContentionResult
+	struct ContentionResult
+	{
+		double InvokeRate;			// Invocations per second (all invokers)
+		double MutateRate;			// Connect/Disconnect pairs per second (all mutators)
+		LatencySummary Latency;		// Invocation latency (sampled)
+	};
+
+	/* Runs invokerCount threads that each invoke an event with listenerCount listeners
+	   invocationCount times, while mutatorCount threads connect and disconnect listeners
+	   of their own until the invokers finish. */
+	template<class EventType>
+	ContentionResult TimeContention(size_t invokerCount, size_t mutatorCount, size_t listenerCount, size_t invocationCount)
+	{
+		constexpr size_t SampleInterval = 8;
+
+		EventType event;
+		std::vector<Counter> listeners(listenerCount);
+		std::vector<Counter> mutatorListeners(mutatorCount);
+
+		for (auto& listener : listeners)
+			event.Connect(&listener);
+
+		std::vector<std::vector<uint32_t>> samples(invokerCount);
+		std::vector<uint64_t> mutations(mutatorCount, 0);
+		std::atomic<size_t> invokersRunning{ invokerCount };
+
+		// The mutators stop when the last invoker finishes, so the wall time covers both
+		const double seconds = RunThreads(invokerCount + mutatorCount, [&] (size_t index)
+		{
+			if (index < invokerCount)
+			{
+				auto& threadSamples = samples[index];
+				threadSamples.reserve(invocationCount / SampleInterval + 1);
+
+				for (size_t i = 0; i < invocationCount; ++i)
+				{
+					if (i % SampleInterval == 0)
+					{
+						const auto callBegin = Clock::now();
+						event(static_cast<int>(i));
+						threadSamples.push_back(static_cast<uint32_t>(ElapsedNs(callBegin, Clock::now())));
+					}
+					else
+						event(static_cast<int>(i));
+				}
+
+				invokersRunning.fetch_sub(1);
+				Consume(t_ThreadCalls);
+			}
+			else
+			{
+				const size_t mutator = index - invokerCount;
+				Counter* pListener = &mutatorListeners[mutator];
+
+				while (invokersRunning.load(std::memory_order_relaxed) > 0)
+				{
+					event.Connect(pListener);
+					event.Disconnect(pListener);
+					++mutations[mutator];
+				}
+			}
+		});
+
+		std::vector<uint32_t> allSamples;
+		for (auto& threadSamples : samples)
+			allSamples.insert(allSamples.end(), threadSamples.begin(), threadSamples.end());
+
+		uint64_t mutationCount = 0;
+		for (auto count : mutations)
+			mutationCount += count;
+
+		return ContentionResult
+		{
+			invokerCount * invocationCount / seconds,
+			mutationCount / seconds,
+			LatencySummary::From(allSamples)
+		};
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// events: Event<Sig> (Delegate) dispatch against the std::function listener path it replaced
+//	Invocations:	--ops (scaled so each run makes the same number of listener calls)
+//	Columns:		listener kind, listener count, then ns per dispatch for a bare list of
+//					std::function and of Delegate, and for the old (std::function) and current
+//					(Delegate) Event; the speedups are std::function time over Delegate time
+void Epic::Bench::RunEventSuite(const Options& options)
+{
+	PrintHeading("events: Event dispatch, Delegate vs std::function");
+
+	const size_t invocationCount = options.Ops;
+
+	std::printf("%zu invocations per run (x8 / listener count)\n", invocationCount);
+	std::printf("%-8s %5s %10s %10s %8s %10s %10s %8s\n", 
+		"kind", "count", "fn list", "dlg list", "speedup", "fn Event", "Event", "speedup");
+
+	for (auto kind : { eListenerKind::Member, eListenerKind::BoundMember, eListenerKind::Lambda })
+	{
+		if (!options.Selects(GetListenerKindName(kind)))
+			continue;
+
+		for (size_t listenerCount : { 1, 8, 64 })
+		{
+			// Keep the total number of listener calls comparable between counts
+			const size_t count = std::max<size_t>(invocationCount * 8 / listenerCount, 1);
+
+			const double fnListNs = TimeDispatch<StdFunctionList>(kind, listenerCount, count);
+			const double delegateListNs = TimeDispatch<DelegateList>(kind, listenerCount, count);
+			const double fnEventNs = TimeDispatch<StdFunctionEvent>(kind, listenerCount, count);
+			const double eventNs = TimeDispatch<Epic::Event<void(int)>>(kind, listenerCount, count);
+
+			std::printf("%-8s %5zu %10.1f %10.1f %7.2fx %10.1f %10.1f %7.2fx\n", GetListenerKindName(kind), listenerCount,
+				fnListNs, delegateListNs, fnListNs / delegateListNs, fnEventNs, eventNs, fnEventNs / eventNs);
+			std::fflush(stdout);
+		}
+	}
+}
+
+// shared-events: SharedEvent under contention against an Event guarded by a mutex
+//	Invocations:	--ops per invoker thread; 16 listeners
+//	Columns:		invoker threads, mutator threads (each connecting and disconnecting its own
+//					listener in a loop), then invocations/s, mutations/s and sampled invocation
+//					latency for each event
+void Epic::Bench::RunSharedEventSuite(const Options& options)
+{
+	PrintHeading("shared-events: SharedEvent vs mutex-guarded Event, N invokers x M mutators");
+
+	constexpr size_t ListenerCount = 16;
+	const size_t invocationCount = options.Ops;
+
+	std::printf("%zu invocations per invoker, %zu listeners\n", invocationCount, ListenerCount);
+	std::printf("%-8s %4s %4s %10s %10s %8s %8s %8s\n", "event", "inv", "mut", "Minv/s", "Kmut/s", "p50 ns", "p99 ns", "p999 ns");
+
+	for (size_t invokerCount : options.GetThreadCounts())
+	{
+		for (size_t mutatorCount : { 0, 1, 2 })
+		{
+			auto print = [&] (const char* name, const ContentionResult& result)
+			{
+				std::printf("%-8s %4zu %4zu %10.2f %10.1f %8llu %8llu %8llu\n", name, invokerCount, mutatorCount,
+					result.InvokeRate * 1e-6, result.MutateRate * 1e-3,
+					static_cast<unsigned long long>(result.Latency.P50), 
+					static_cast<unsigned long long>(result.Latency.P99), 
+					static_cast<unsigned long long>(result.Latency.P999));
+				std::fflush(stdout);
+			};
+
+			if (options.Selects("locked"))
+				print("locked", TimeContention<LockedEvent>(invokerCount, mutatorCount, ListenerCount, invocationCount));
+
+			if (options.Selects("shared"))
+				print("shared", TimeContention<SharedEventAdapter>(invokerCount, mutatorCount, ListenerCount, invocationCount));
+		}
+	}
+}
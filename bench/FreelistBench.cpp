@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "AllocatorSubjects.hpp"
+#include "BenchSuites.hpp"
+#include <Epic/Memory/FreelistAllocator.hpp>
+#include <Epic/Memory/ThreadCachedAllocator.hpp>
+#include <random>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using namespace Epic::Bench;
+
+	constexpr size_t BlockSize = 64;
+	constexpr size_t WindowSize = 256;
+
+	struct FreelistTag { };
+
+	using MutexFreelist = Epic::SharedFreelistAllocator<TrackingAllocator, 256, BlockSize>;
+	using LockFreeFreelist = Epic::LockFreeFreelistAllocator<TrackingAllocator, 256, BlockSize>;
+	using CachedFreelist = Epic::ThreadCachedAllocator<MutexFreelist, 64, FreelistTag>;
+
+	/// FreelistResult
+	struct FreelistResult
+	{
+		double Rate;				// Operations (allocations + frees) per second
+		LatencySummary Latency;		// Sampled operation latency
+	};
+
+	/* Each of threadCount threads keeps a window of blocks and replaces a random one
+	   opCount / 2 times; every replacement is one free and one allocation. */
+	template<class A>
+	FreelistResult TimeFreelist(A& allocator, size_t threadCount, size_t opCount, uint64_t seed)
+	{
+		constexpr size_t SampleInterval = 16;
+
+		std::vector<std::vector<uint32_t>> samples(threadCount);
+
+		const double seconds = RunThreads(threadCount, [&] (size_t index)
+		{
+			std::mt19937 rng(static_cast<uint32_t>(seed + index));
+			std::vector<Epic::Blk> window(WindowSize);
+			auto& threadSamples = samples[index];
+
+			threadSamples.reserve(opCount / SampleInterval + 1);
+
+			for (auto& blk : window)
+				blk = AllocateFrom(allocator, BlockSize);
+
+			for (size_t op = 0; op < opCount / 2; ++op)
+			{
+				auto& blk = window[rng() % WindowSize];
+
+				if (op % SampleInterval == 0)
+				{
+					const auto begin = Clock::now();
+					DeallocateTo(allocator, blk);
+					blk = AllocateFrom(allocator, BlockSize);
+					threadSamples.push_back(static_cast<uint32_t>(ElapsedNs(begin, Clock::now()) / 2));
+				}
+				else
+				{
+					DeallocateTo(allocator, blk);
+					blk = AllocateFrom(allocator, BlockSize);
+				}
+
+				// Touch the block as a caller would
+				static_cast<unsigned char*>(blk.Ptr)[0] = static_cast<unsigned char>(op);
+			}
+
+			for (auto& blk : window)
+				DeallocateTo(allocator, blk);
+		});
+
+		std::vector<uint32_t> allSamples;
+		for (auto& threadSamples : samples)
+			allSamples.insert(allSamples.end(), threadSamples.begin(), threadSamples.end());
+
+		return FreelistResult{ threadCount * (opCount / 2) * 2 / seconds, LatencySummary::From(allSamples) };
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// freelist: Shared freelist contention, mutex vs lock-free (plus thread-cached and malloc)
+//	Operations:	--ops per thread, 64 byte blocks, a window of 256 live blocks per thread
+//	Threads:	1, 4, 8 and 16 (1 and 2 with --quick), independent of --threads, since
+//				oversubscription is part of what is being measured
+//	Columns:	allocator, threads, Mops/s, sampled p50/p99/p999 per operation, and
+//				throughput relative to the mutex freelist at the same thread count
+void Epic::Bench::RunFreelistSuite(const Options& options)
+{
+	PrintHeading("freelist: SharedFreelist (mutex) vs LockFreeFreelist");
+
+	std::printf("%zu ops per thread, %zu byte blocks\n", options.Ops, BlockSize);
+	std::printf("%-10s %4s %9s %8s %8s %8s %9s\n", "allocator", "thr", "Mops/s", "p50 ns", "p99 ns", "p999 ns", "vs mutex");
+
+	const std::vector<size_t> threadCounts = options.Quick ? std::vector<size_t>{ 1, 2 } : std::vector<size_t>{ 1, 4, 8, 16 };
+
+	for (auto threadCount : threadCounts)
+	{
+		double mutexRate = 0.0;
+
+		auto run = [&] (const char* name, auto& allocator)
+		{
+			if (!options.Selects(name))
+				return;
+
+			const auto result = TimeFreelist(allocator, threadCount, options.Ops, options.Seed);
+
+			if (mutexRate == 0.0)
+				mutexRate = result.Rate;
+
+			std::printf("%-10s %4zu %9.2f %8llu %8llu %8llu %8.2fx\n", name, threadCount, result.Rate * 1e-6,
+				static_cast<unsigned long long>(result.Latency.P50), 
+				static_cast<unsigned long long>(result.Latency.P99),
+				static_cast<unsigned long long>(result.Latency.P999), result.Rate / mutexRate);
+			std::fflush(stdout);
+		};
+
+		MutexFreelist mutexFreelist;
+		LockFreeFreelist lockFreeFreelist;
+		CachedFreelist cachedFreelist;
+		Epic::Mallocator mallocator;
+
+		run("mutex", mutexFreelist);
+		run("lockfree", lockFreeFreelist);
+		run("cached", cachedFreelist);
+		run("malloc", mallocator);
+	}
+}
@@ -0,0 +1,146 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "AllocatorSubjects.hpp"
+#include "BenchSuites.hpp"
+#include <Epic/Memory/LinearSegregatorAllocator.hpp>
+#include <Epic/Memory/SegBucket.hpp>
+#include <random>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using namespace Epic::Bench;
+
+	/// SizeClassCompositions<A, Sizes...>
+	//	A SlabAllocator and the hand-nested composition it replaces: one freelist per size
+	//	class behind a chain of SegregatorAllocators (thresholds are exclusive, hence +1).
+	template<class A, size_t... Sizes>
+	struct SizeClassCompositions
+	{
+		using Slab = Epic::SlabAllocator<A, Sizes...>;
+		using Linear = Epic::LinearSegregatorAllocator<Epic::SegBucket<Sizes + 1, Epic::FreelistAllocator<A, 32, Sizes>>..., A>;
+	};
+
+	using Compositions = SizeClassCompositions<TrackingAllocator, 
+		16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 2048, 4096>;
+
+	constexpr size_t WindowSize = 1024;
+
+	/// SizePattern
+	struct SizePattern
+	{
+		const char* Name;
+		size_t (*pNext)(std::mt19937& rng);
+	};
+
+	constexpr SizePattern SizePatterns[] =
+	{
+		{ "small", [] (std::mt19937& rng) -> size_t { return 1 + rng() % 64; } },
+		{ "mixed", [] (std::mt19937& rng) -> size_t
+			{
+				const uint32_t pick = rng() % 100;
+				return (pick < 70) ? 1 + rng() % 128 : (pick < 95) ? 129 + rng() % 896 : 1025 + rng() % 3072;
+			} },
+		{ "large", [] (std::mt19937& rng) -> size_t { return 1025 + rng() % 3072; } },
+	};
+
+	/// SlabResult
+	struct SlabResult
+	{
+		double NsPerOp;			// Mean nanoseconds per allocation or free
+		int64_t Footprint;		// Peak backing bytes (-1 if unknown)
+	};
+
+	/* Keeps a window of live blocks and replaces a random one for each size in sizes. */
+	template<class A>
+	SlabResult TimeSizeClasses(const std::vector<size_t>& sizes, uint64_t seed)
+	{
+		std::mt19937 rng(static_cast<uint32_t>(seed));
+		std::vector<Epic::Blk> window(WindowSize);
+
+		const int64_t liveBefore = TrackingAllocator::GetLive();
+		TrackingAllocator::BeginTracking();
+
+		A allocator;
+
+		for (size_t i = 0; i < WindowSize; ++i)
+			window[i] = AllocateFrom(allocator, sizes[i % sizes.size()]);
+
+		const auto begin = Clock::now();
+
+		for (size_t size : sizes)
+		{
+			auto& blk = window[rng() % WindowSize];
+
+			DeallocateTo(allocator, blk);
+			blk = AllocateFrom(allocator, size);
+		}
+
+		const double ns = static_cast<double>(ElapsedNs(begin, Clock::now())) / (2 * sizes.size());
+
+		for (auto& blk : window)
+			DeallocateTo(allocator, blk);
+
+		const int64_t peak = TrackingAllocator::EndTracking() - liveBefore;
+
+		return SlabResult{ ns, std::is_same_v<A, Epic::Mallocator> ? -1 : peak };
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// slab: SlabAllocator against the equivalent LinearSegregatorAllocator of freelists
+//	Operations:	--ops replacements (one free and one allocation each) of a random block in
+//				a window of 1024, with sizes drawn from each pattern; single-threaded, since
+//				the size-class lookup is what differs
+//	Columns:	pattern, allocator, ns per operation, peak backing memory, and speedup over
+//				the linear segregator
+void Epic::Bench::RunSlabSuite(const Options& options)
+{
+	PrintHeading("slab: SlabAllocator vs LinearSegregatorAllocator<SegBucket<Freelist>...>");
+
+	std::printf("%zu replacements, 14 size classes (16..4096)\n", options.Ops);
+	std::printf("%-6s %-8s %8s %10s %9s\n", "sizes", "alloc", "ns/op", "peak KiB", "vs linear");
+
+	for (const auto& pattern : SizePatterns)
+	{
+		if (!options.Selects(pattern.Name))
+			continue;
+
+		std::mt19937 rng(static_cast<uint32_t>(options.Seed));
+		std::vector<size_t> sizes(options.Ops);
+
+		for (auto& size : sizes)
+			size = pattern.pNext(rng);
+
+		const auto linear = TimeSizeClasses<Compositions::Linear>(sizes, options.Seed);
+		const auto slab = TimeSizeClasses<Compositions::Slab>(sizes, options.Seed);
+		const auto heap = TimeSizeClasses<Epic::Mallocator>(sizes, options.Seed);
+
+		auto print = [&] (const char* name, const SlabResult& result)
+		{
+			if (result.Footprint < 0)
+				std::printf("%-6s %-8s %8.2f %10s %8.2fx\n", pattern.Name, name, result.NsPerOp, "n/a", linear.NsPerOp / result.NsPerOp);
+			else
+				std::printf("%-6s %-8s %8.2f %10.1f %8.2fx\n", pattern.Name, name, result.NsPerOp, 
+					result.Footprint / 1024.0, linear.NsPerOp / result.NsPerOp);
+		};
+
+		print("linear", linear);
+		print("slab", slab);
+		print("malloc", heap);
+		std::fflush(stdout);
+	}
+}
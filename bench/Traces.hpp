@@ -0,0 +1,314 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Bench
+{
+	enum class eTraceOp : uint8_t;
+	enum class eTraceKind : uint8_t;
+
+	struct TraceOp;
+	struct Trace;
+
+	namespace detail
+	{
+		class SlotPool;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// eTraceOp
+enum class Epic::Bench::eTraceOp : uint8_t
+{
+	Allocate,		// Allocate Size bytes into Slot
+	Reallocate,		// Resize the block in Slot to Size bytes
+	Deallocate,		// Free the block in Slot
+	EndFrame		// A frame boundary (frame arenas reset here)
+};
+
+/// eTraceKind
+enum class Epic::Bench::eTraceKind : uint8_t
+{
+	EcsChurn,		// Entities spawned and destroyed with 2-5 small components each
+	Strings,		// Strings built by repeated appends (geometric reallocation)
+	EventQueue		// Event payloads produced in bursts and consumed in FIFO order
+};
+
+/// TraceOp
+struct Epic::Bench::TraceOp
+{
+	eTraceOp Op;
+	uint32_t Slot;
+	uint32_t Size;
+};
+
+/// Trace
+//	A generated sequence of allocator operations.  Operations refer to live blocks by slot.
+struct Epic::Bench::Trace
+{
+	std::vector<TraceOp> Ops;
+	uint32_t SlotCount = 0;
+	uint32_t MaxSize = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// SlotPool
+class Epic::Bench::detail::SlotPool
+{
+private:
+	std::vector<uint32_t> m_Free;
+	uint32_t m_Next = 0;
+
+public:
+	uint32_t Acquire()
+	{
+		if (m_Free.empty())
+			return m_Next++;
+
+		const uint32_t slot = m_Free.back();
+		m_Free.pop_back();
+
+		return slot;
+	}
+
+	void Release(uint32_t slot)
+	{
+		m_Free.push_back(slot);
+	}
+
+	uint32_t GetCount() const noexcept
+	{
+		return m_Next;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Bench
+{
+	inline const char* GetTraceName(eTraceKind kind) noexcept
+	{
+		switch (kind)
+		{
+		case eTraceKind::EcsChurn:		return "ecs-churn";
+		case eTraceKind::Strings:		return "strings";
+		case eTraceKind::EventQueue:	return "event-queue";
+		}
+
+		return "?";
+	}
+
+	constexpr eTraceKind AllTraceKinds[] = { eTraceKind::EcsChurn, eTraceKind::Strings, eTraceKind::EventQueue };
+
+	/* Generates about opCount operations of the given kind.
+	   Every block allocated by the trace is freed by the end of it. */
+	inline Trace MakeTrace(eTraceKind kind, size_t opCount, uint64_t seed)
+	{
+		Trace trace;
+		trace.Ops.reserve(opCount + opCount / 4);
+
+		std::mt19937_64 rng{ seed ^ (static_cast<uint64_t>(kind) * 0x9E3779B97F4A7C15ull) };
+		detail::SlotPool slots;
+
+		auto uniform = [&rng] (uint32_t lo, uint32_t hi)
+		{
+			return std::uniform_int_distribution<uint32_t>{ lo, hi }(rng);
+		};
+
+		auto emit = [&trace] (eTraceOp op, uint32_t slot, uint32_t size)
+		{
+			trace.Ops.push_back({ op, slot, size });
+			trace.MaxSize = std::max(trace.MaxSize, size);
+		};
+
+		switch (kind)
+		{
+		case eTraceKind::EcsChurn:
+		{
+			// Component sizes typical of small POD components
+			static constexpr uint32_t ComponentSizes[] = { 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256 };
+			static constexpr uint32_t Population = 1000;
+
+			std::vector<std::vector<uint32_t>> entities;
+
+			auto spawn = [&]
+			{
+				std::vector<uint32_t> components(uniform(2, 5));
+
+				for (auto& slot : components)
+				{
+					slot = slots.Acquire();
+					emit(eTraceOp::Allocate, slot, ComponentSizes[uniform(0, std::size(ComponentSizes) - 1)]);
+				}
+
+				entities.push_back(std::move(components));
+			};
+
+			auto destroy = [&] (size_t index)
+			{
+				for (auto slot : entities[index])
+				{
+					emit(eTraceOp::Deallocate, slot, 0);
+					slots.Release(slot);
+				}
+
+				std::swap(entities[index], entities.back());
+				entities.pop_back();
+			};
+
+			while (trace.Ops.size() < opCount)
+			{
+				// Spawn towards the target population, then churn around it
+				const uint32_t spawnCount = (entities.size() < Population) ? 64 : uniform(8, 32);
+				const uint32_t destroyCount = (entities.size() < Population) ? 0 : uniform(8, 32);
+
+				for (uint32_t i = 0; i < spawnCount; ++i)
+					spawn();
+
+				for (uint32_t i = 0; i < destroyCount && !entities.empty(); ++i)
+					destroy(uniform(0, static_cast<uint32_t>(entities.size() - 1)));
+
+				// Attach and detach components on existing entities
+				for (uint32_t i = 0; i < 16 && !entities.empty(); ++i)
+				{
+					auto& components = entities[uniform(0, static_cast<uint32_t>(entities.size() - 1))];
+
+					if (components.size() < 6 && uniform(0, 1) == 0)
+					{
+						const uint32_t slot = slots.Acquire();
+						emit(eTraceOp::Allocate, slot, ComponentSizes[uniform(0, std::size(ComponentSizes) - 1)]);
+						components.push_back(slot);
+					}
+					else if (components.size() > 1)
+					{
+						emit(eTraceOp::Deallocate, components.back(), 0);
+						slots.Release(components.back());
+						components.pop_back();
+					}
+				}
+
+				emit(eTraceOp::EndFrame, 0, 0);
+			}
+
+			while (!entities.empty())
+				destroy(entities.size() - 1);
+
+			break;
+		}
+
+		case eTraceKind::Strings:
+		{
+			struct Builder { uint32_t Slot; uint32_t Size; uint32_t Target; };
+			std::vector<Builder> builders;
+
+			while (trace.Ops.size() < opCount)
+			{
+				const uint32_t action = uniform(0, 99);
+
+				if (builders.size() < 8 || (action < 20 && builders.size() < 256))
+				{
+					// Start a string with a short literal; most stay short, a few grow long
+					const uint32_t size = uniform(16, 48);
+					const uint32_t target = (uniform(0, 9) == 0) ? uniform(1024, 8192) : uniform(64, 512);
+					const uint32_t slot = slots.Acquire();
+
+					emit(eTraceOp::Allocate, slot, size);
+					builders.push_back({ slot, size, target });
+				}
+				else
+				{
+					const size_t index = uniform(0, static_cast<uint32_t>(builders.size() - 1));
+					auto& builder = builders[index];
+
+					if (builder.Size >= builder.Target)
+					{
+						// The string is done
+						emit(eTraceOp::Deallocate, builder.Slot, 0);
+						slots.Release(builder.Slot);
+						std::swap(builder, builders.back());
+						builders.pop_back();
+					}
+					else
+					{
+						// Append; capacity grows by half again, as std::basic_string does
+						builder.Size = std::min(builder.Target, builder.Size + builder.Size / 2);
+						emit(eTraceOp::Reallocate, builder.Slot, builder.Size);
+					}
+				}
+
+				if (trace.Ops.size() % 512 == 0)
+					emit(eTraceOp::EndFrame, 0, 0);
+			}
+
+			for (auto& builder : builders)
+				emit(eTraceOp::Deallocate, builder.Slot, 0);
+
+			break;
+		}
+
+		case eTraceKind::EventQueue:
+		{
+			static constexpr uint32_t PayloadSizes[] = { 24, 32, 32, 48, 48, 64, 96, 160 };
+
+			std::deque<uint32_t> queue;
+
+			while (trace.Ops.size() < opCount)
+			{
+				// Producers post a burst; occasionally a large one (e.g. a level load)
+				const uint32_t produced = (uniform(0, 31) == 0) ? uniform(256, 1024) : uniform(0, 64);
+
+				for (uint32_t i = 0; i < produced; ++i)
+				{
+					const uint32_t slot = slots.Acquire();
+					const uint32_t size = (uniform(0, 63) == 0) ? uniform(512, 2048) : PayloadSizes[uniform(0, std::size(PayloadSizes) - 1)];
+
+					emit(eTraceOp::Allocate, slot, size);
+					queue.push_back(slot);
+				}
+
+				// The consumer drains up to its budget in FIFO order
+				const uint32_t budget = uniform(16, 96);
+
+				for (uint32_t i = 0; i < budget && !queue.empty(); ++i)
+				{
+					emit(eTraceOp::Deallocate, queue.front(), 0);
+					slots.Release(queue.front());
+					queue.pop_front();
+				}
+
+				emit(eTraceOp::EndFrame, 0, 0);
+			}
+
+			for (auto slot : queue)
+				emit(eTraceOp::Deallocate, slot, 0);
+
+			break;
+		}
+		}
+
+		trace.SlotCount = slots.GetCount();
+
+		return trace;
+	}
+}
@@ -0,0 +1,262 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Event.hpp>
+#include <Epic/STL/UniquePtr.hpp>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <tuple>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	enum class eEventBackPressure
+	{
+		Drop,		// Invocations posted while the queue is full are discarded
+		Wait		// Producers yield until the consumer frees space
+	};
+
+	template<typename Signature>
+	class ConcurrentPolledEvent;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// ConcurrentPolledEvent<Signature>
+//	A PolledEvent that may be invoked from any number of threads.
+//	Invocations are buffered in a bounded lock-free ring and dispatched
+//	to the listeners by Poll().  Listeners may only be connected, disconnected 
+//	and polled from a single (consumer) thread.
+template<class R, class... Args>
+class Epic::ConcurrentPolledEvent<R(Args...)> : public Epic::detail::EventBase<R, Args...>
+{
+	using Type = Epic::ConcurrentPolledEvent<R(Args...)>;
+	using Base = Epic::detail::EventBase<R, Args...>;
+
+public:
+	static constexpr size_t DefaultCapacity = 1024;
+	static constexpr size_t CacheLineSize = 64;
+
+private:
+	template<class EventType>
+	struct ScopeSuspend
+	{
+		ScopeSuspend(EventType& evt)
+			: _event(evt)
+		{
+			_event.Suspend(true);
+		}
+
+		~ScopeSuspend()
+		{
+			_event.Flush();
+		}
+
+		EventType& _event;
+	};
+
+	template<class EventType>
+	friend struct ScopeSuspend;
+
+protected:
+	using Invocation = std::tuple<std::decay_t<Args>...>;
+
+	struct Cell
+	{
+		std::atomic<size_t> Sequence;
+		alignas(Invocation) unsigned char Storage[sizeof(Invocation)];
+	};
+
+	using CellArray = Epic::UniquePtr<Cell[]>;
+
+private:
+	CellArray m_pCells;
+	size_t m_Mask;
+	eEventBackPressure m_BackPressure;
+	alignas(CacheLineSize) std::atomic<size_t> m_EnqueuePos;
+	alignas(CacheLineSize) std::atomic<size_t> m_DroppedCount;
+	alignas(CacheLineSize) size_t m_DequeuePos;
+
+public:
+	// Create an event that can buffer 'capacity' invocations (rounded up to a power of 2)
+	explicit ConcurrentPolledEvent(size_t capacity = DefaultCapacity, 
+								   eEventBackPressure backPressure = eEventBackPressure::Drop)
+		: m_BackPressure{ backPressure }, m_EnqueuePos{ 0 }, m_DroppedCount{ 0 }, m_DequeuePos{ 0 }
+	{
+		size_t size = 2;
+		while (size < capacity)
+			size <<= 1;
+
+		m_pCells = Epic::MakeUnique<Cell[]>(size);
+		m_Mask = size - 1;
+
+		for (size_t i = 0; i < size; ++i)
+			m_pCells[i].Sequence.store(i, std::memory_order_relaxed);
+	}
+
+	ConcurrentPolledEvent(const Type&) = delete;
+	ConcurrentPolledEvent(Type&&) = delete;
+
+	~ConcurrentPolledEvent() noexcept
+	{
+		// Destroy any invocations that were never polled
+		Invocation* pInvocation;
+
+		while ((pInvocation = Front()) != nullptr)
+			PopFront(pInvocation);
+	}
+
+public:
+	Type& operator = (const Type&) = delete;
+	Type& operator = (Type&&) = delete;
+
+public:
+	// Retrieve the maximum number of invocations that can be buffered
+	inline size_t GetCapacity() const noexcept
+	{
+		return m_Mask + 1;
+	}
+
+	// Retrieve the number of invocations discarded because the queue was full
+	inline size_t GetDroppedCount() const noexcept
+	{
+		return m_DroppedCount.load(std::memory_order_relaxed);
+	}
+
+	inline eEventBackPressure GetBackPressure() const noexcept
+	{
+		return m_BackPressure;
+	}
+
+public:
+	// Buffer an invocation of the event.  This may be called from any thread.
+	// Returns false if the queue was full and the invocation was dropped.
+	inline bool operator() (Args... args)
+	{
+		return Invoke(std::forward<Args>(args)...);
+	}
+
+	// Buffer an invocation of the event.  This may be called from any thread.
+	// Returns false if the queue was full and the invocation was dropped.
+	// NOTE: Under eEventBackPressure::Wait, calling this from the polling thread 
+	//       while the queue is full will never return.
+	bool Invoke(Args... args)
+	{
+		Cell* pCell = nullptr;
+
+		while ((pCell = Reserve()) == nullptr)
+		{
+			if (m_BackPressure == eEventBackPressure::Drop)
+			{
+				m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			std::this_thread::yield();
+		}
+
+		const size_t pos = pCell->Sequence.load(std::memory_order_relaxed);
+
+		::new (pCell->Storage) Invocation(std::forward<Args>(args)...);
+		pCell->Sequence.store(pos + 1, std::memory_order_release);
+
+		return true;
+	}
+
+private:
+	// Claim the next free cell (or return nullptr if the queue is full).
+	// The claimed cell's sequence identifies its position.
+	Cell* Reserve() noexcept
+	{
+		size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			Cell* pCell = &m_pCells[pos & m_Mask];
+
+			const size_t seq = pCell->Sequence.load(std::memory_order_acquire);
+			const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+			if (diff == 0)
+			{
+				if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					return pCell;
+			}
+			else if (diff < 0)
+				return nullptr;
+			else
+				pos = m_EnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	// Retrieve the oldest published invocation (or nullptr if the queue is empty)
+	Invocation* Front() noexcept
+	{
+		Cell& cell = m_pCells[m_DequeuePos & m_Mask];
+
+		const size_t seq = cell.Sequence.load(std::memory_order_acquire);
+		if (seq != m_DequeuePos + 1)
+			return nullptr;
+
+		return reinterpret_cast<Invocation*>(cell.Storage);
+	}
+
+	// Destroy the oldest invocation and release its cell to the producers
+	void PopFront(Invocation* pInvocation) noexcept
+	{
+		Cell& cell = m_pCells[m_DequeuePos & m_Mask];
+
+		pInvocation->~Invocation();
+		cell.Sequence.store(m_DequeuePos + m_Mask + 1, std::memory_order_release);
+		++m_DequeuePos;
+	}
+
+	template<size_t... Is>
+	void DoInvoke(Invocation& invocation, std::integer_sequence<size_t, Is...>)
+	{
+		for (auto& listener : this->m_Listeners)
+			listener.delegate(std::get<Is>(invocation)...);
+	}
+
+public:
+	// Invoke pending event invocations.  This must only be called from the consumer thread.
+	// At most GetCapacity() invocations are dispatched per call, so producers that post
+	// continuously cannot starve the caller.
+	// Returns the number of invocations dispatched.
+	size_t Poll()
+	{
+		ScopeSuspend<Type> _suspend(*this);
+
+		const size_t capacity = GetCapacity();
+		size_t count = 0;
+
+		Invocation* pInvocation;
+
+		while (count < capacity && (pInvocation = Front()) != nullptr)
+		{
+			// Release the cell before dispatching so listeners may post to this event
+			Invocation invocation{ std::move(*pInvocation) };
+			PopFront(pInvocation);
+
+			DoInvoke(invocation, Epic::TMP::MakeSequence<size_t, sizeof...(Args)>());
+			++count;
+		}
+
+		return count;
+	}
+};
@@ -0,0 +1,395 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/STL/UniquePtr.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<typename Signature>
+	class Delegate;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Delegate<R(Args...)>
+//	A type-erased callable with inline storage.  Function pointers, member function
+//	pointers and small function objects are stored without allocating; larger
+//	function objects fall back to the heap.
+//	Delegates that target a function pointer or a bound member function compare 
+//	equal when they target the same function (and instance).
+template<class R, class... Args>
+class Epic::Delegate<R(Args...)>
+{
+public:
+	using Type = Epic::Delegate<R(Args...)>;
+	using InstanceType = intptr_t;
+	using FunctionPointerType = R(*)(Args...);
+
+	static constexpr size_t BufferSize = 4 * sizeof(void*);
+	static constexpr size_t BufferAlignment = alignof(std::max_align_t);
+
+private:
+	enum class eOperation { Copy, Move, Destroy };
+
+	using InvokeFn = R(*)(void*, Args&&...);
+	using ManageFn = void(*)(eOperation, void*, void*);
+
+	template<class Function>
+	static constexpr bool IsStoredInline = 
+		sizeof(Function) <= BufferSize && 
+		alignof(Function) <= BufferAlignment &&
+		std::is_nothrow_move_constructible<Function>::value;
+
+	template<class Function>
+	static constexpr bool IsTrivial = 
+		IsStoredInline<Function> &&
+		std::is_trivially_copyable<Function>::value && 
+		std::is_trivially_destructible<Function>::value;
+
+private:
+	// Comparable targets store their identifying pointer (the function pointer
+	// or the bound instance) at the front of the buffer.
+	alignas(BufferAlignment) mutable unsigned char m_Buffer[BufferSize] = { };
+	InvokeFn m_pInvoke;			// Calls the stored target
+	ManageFn m_pManage;			// Copies, moves and destroys non-trivial targets (null for trivial targets)
+	bool m_IsComparable;		// Whether or not the buffer identifies the target
+
+public:
+	Delegate() noexcept
+		: m_pInvoke{ nullptr }, m_pManage{ nullptr }, m_IsComparable{ false }
+	{ }
+
+	Delegate(std::nullptr_t) noexcept
+		: Delegate()
+	{ }
+
+	// Target a static function
+	Delegate(FunctionPointerType fn) noexcept
+		: Delegate()
+	{
+		if (fn)
+			StoreComparable(fn, &FunctionStub::Invoke);
+	}
+
+	// Target a member function of pThis
+	template<class T, class This>
+	Delegate(This* pThis, R(T::* fn)(Args...)) noexcept
+		: Delegate()
+	{
+		StoreComparable(BoundMethod<This, R(T::*)(Args...)>{ pThis, fn }, 
+						&BoundMethod<This, R(T::*)(Args...)>::Invoke);
+	}
+
+	// Target a const member function of pThis
+	template<class T, class This>
+	Delegate(const This* pThis, R(T::* fn)(Args...) const) noexcept
+		: Delegate()
+	{
+		StoreComparable(BoundMethod<const This, R(T::*)(Args...) const>{ pThis, fn }, 
+						&BoundMethod<const This, R(T::*)(Args...) const>::Invoke);
+	}
+
+	// Target a function object.
+	// Function objects are not comparable.
+	template<class Function, typename = std::enable_if_t<
+		!std::is_same<std::decay_t<Function>, Type>::value &&
+		!std::is_same<std::decay_t<Function>, FunctionPointerType>::value &&
+		std::is_invocable_r<R, std::decay_t<Function>&, Args...>::value>>
+	Delegate(Function&& fn)
+		: Delegate()
+	{
+		using FunctionType = std::decay_t<Function>;
+
+		if constexpr (IsTrivial<FunctionType>)
+		{
+			::new (m_Buffer) FunctionType(std::forward<Function>(fn));
+			m_pInvoke = &InlineStub<FunctionType>::Invoke;
+		}
+		else if constexpr (IsStoredInline<FunctionType>)
+		{
+			::new (m_Buffer) FunctionType(std::forward<Function>(fn));
+			m_pInvoke = &InlineStub<FunctionType>::Invoke;
+			m_pManage = &InlineStub<FunctionType>::Manage;
+		}
+		else
+		{
+			using Pointer = typename RemoteStub<FunctionType>::Pointer;
+
+			::new (m_Buffer) Pointer(Epic::MakeUnique<FunctionType>(std::forward<Function>(fn)));
+			m_pInvoke = &RemoteStub<FunctionType>::Invoke;
+			m_pManage = &RemoteStub<FunctionType>::Manage;
+		}
+	}
+
+	Delegate(const Type& other)
+		: Delegate()
+	{
+		CopyFrom(other);
+	}
+
+	Delegate(Type&& other) noexcept
+		: Delegate()
+	{
+		MoveFrom(other);
+	}
+
+	~Delegate() noexcept
+	{
+		Reset();
+	}
+
+public:
+	Type& operator = (const Type& other)
+	{
+		if (this != &other)
+		{
+			Type copy{ other };
+
+			Reset();
+			MoveFrom(copy);
+		}
+
+		return *this;
+	}
+
+	Type& operator = (Type&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Reset();
+			MoveFrom(other);
+		}
+
+		return *this;
+	}
+
+	Type& operator = (std::nullptr_t) noexcept
+	{
+		Reset();
+		return *this;
+	}
+
+public:
+	// Create a delegate that targets Method of pThis.
+	// Method is part of the target's type, so invocation is a direct call.
+	template<auto Method, class This>
+	static Type Bind(This* pThis) noexcept
+	{
+		Type result;
+		result.StoreComparable(pThis, &StaticMethodStub<This, Method>::Invoke);
+
+		return result;
+	}
+
+public:
+	explicit inline operator bool() const noexcept
+	{
+		return m_pInvoke != nullptr;
+	}
+
+	inline R operator() (Args... args) const
+	{
+		return m_pInvoke(m_Buffer, std::forward<Args>(args)...);
+	}
+
+	// Retrieve the bound instance (or function pointer) of this delegate.
+	// Returns 0 for function objects and empty delegates.
+	inline InstanceType GetInstance() const noexcept
+	{
+		if (!m_IsComparable)
+			return 0;
+
+		InstanceType instance;
+		std::memcpy(&instance, m_Buffer, sizeof(InstanceType));
+
+		return instance;
+	}
+
+	// Query whether or not this delegate targets the same function (and instance) as other.
+	// Delegates that target function objects never compare equal to one another.
+	bool operator == (const Type& other) const noexcept
+	{
+		if (m_pInvoke != other.m_pInvoke)
+			return false;
+
+		if (m_pInvoke == nullptr)
+			return true;
+
+		return m_IsComparable && other.m_IsComparable &&
+			std::memcmp(m_Buffer, other.m_Buffer, BufferSize) == 0;
+	}
+
+	inline bool operator != (const Type& other) const noexcept
+	{
+		return !(*this == other);
+	}
+
+	// Release the target
+	void Reset() noexcept
+	{
+		if (m_pManage)
+			m_pManage(eOperation::Destroy, m_Buffer, nullptr);
+
+		m_pInvoke = nullptr;
+		m_pManage = nullptr;
+		m_IsComparable = false;
+	}
+
+private:
+	template<class T>
+	void StoreComparable(const T& target, InvokeFn pInvoke) noexcept
+	{
+		static_assert(sizeof(T) <= BufferSize, "Delegate target does not fit in the inline buffer.");
+		static_assert(std::is_trivially_copyable<T>::value, "Comparable delegate targets must be trivially copyable.");
+
+		// Zero the buffer so that comparisons are not affected by unused bytes
+		std::memset(m_Buffer, 0, BufferSize);
+		std::memcpy(m_Buffer, &target, sizeof(T));
+
+		m_pInvoke = pInvoke;
+		m_IsComparable = true;
+	}
+
+	void CopyFrom(const Type& other)
+	{
+		if (other.m_pManage)
+			other.m_pManage(eOperation::Copy, m_Buffer, other.m_Buffer);
+		else if (other.m_pInvoke)
+			std::memcpy(m_Buffer, other.m_Buffer, BufferSize);
+
+		m_pInvoke = other.m_pInvoke;
+		m_pManage = other.m_pManage;
+		m_IsComparable = other.m_IsComparable;
+	}
+
+	void MoveFrom(Type& other) noexcept
+	{
+		if (other.m_pManage)
+			other.m_pManage(eOperation::Move, m_Buffer, other.m_Buffer);
+		else if (other.m_pInvoke)
+			std::memcpy(m_Buffer, other.m_Buffer, BufferSize);
+
+		m_pInvoke = other.m_pInvoke;
+		m_pManage = other.m_pManage;
+		m_IsComparable = other.m_IsComparable;
+
+		other.m_pInvoke = nullptr;
+		other.m_pManage = nullptr;
+		other.m_IsComparable = false;
+	}
+
+private:
+	struct FunctionStub
+	{
+		static R Invoke(void* pBuffer, Args&&... args)
+		{
+			FunctionPointerType fn;
+			std::memcpy(&fn, pBuffer, sizeof(FunctionPointerType));
+
+			return fn(std::forward<Args>(args)...);
+		}
+	};
+
+	template<class This, class Method>
+	struct BoundMethod
+	{
+		This* pThis;
+		Method pMethod;
+
+		static R Invoke(void* pBuffer, Args&&... args)
+		{
+			auto pBound = reinterpret_cast<BoundMethod*>(pBuffer);
+			return (pBound->pThis->*pBound->pMethod)(std::forward<Args>(args)...);
+		}
+	};
+
+	template<class This, auto Method>
+	struct StaticMethodStub
+	{
+		static R Invoke(void* pBuffer, Args&&... args)
+		{
+			This* pThis;
+			std::memcpy(&pThis, pBuffer, sizeof(This*));
+
+			return (pThis->*Method)(std::forward<Args>(args)...);
+		}
+	};
+
+	template<class Function>
+	struct InlineStub
+	{
+		static R Invoke(void* pBuffer, Args&&... args)
+		{
+			return (*reinterpret_cast<Function*>(pBuffer))(std::forward<Args>(args)...);
+		}
+
+		static void Manage(eOperation op, void* pDest, void* pSrc)
+		{
+			switch (op)
+			{
+			case eOperation::Copy:
+				::new (pDest) Function(*reinterpret_cast<const Function*>(pSrc));
+				break;
+
+			case eOperation::Move:
+				::new (pDest) Function(std::move(*reinterpret_cast<Function*>(pSrc)));
+				reinterpret_cast<Function*>(pSrc)->~Function();
+				break;
+
+			case eOperation::Destroy:
+				reinterpret_cast<Function*>(pDest)->~Function();
+				break;
+			}
+		}
+	};
+
+	template<class Function>
+	struct RemoteStub
+	{
+		using Pointer = Epic::UniquePtr<Function>;
+
+		static R Invoke(void* pBuffer, Args&&... args)
+		{
+			return (**reinterpret_cast<Pointer*>(pBuffer))(std::forward<Args>(args)...);
+		}
+
+		static void Manage(eOperation op, void* pDest, void* pSrc)
+		{
+			switch (op)
+			{
+			case eOperation::Copy:
+				::new (pDest) Pointer(Epic::MakeUnique<Function>(**reinterpret_cast<const Pointer*>(pSrc)));
+				break;
+
+			case eOperation::Move:
+				::new (pDest) Pointer(std::move(*reinterpret_cast<Pointer*>(pSrc)));
+				reinterpret_cast<Pointer*>(pSrc)->~Pointer();
+				break;
+
+			case eOperation::Destroy:
+				reinterpret_cast<Pointer*>(pDest)->~Pointer();
+				break;
+			}
+		}
+	};
+};
@@ -18,11 +18,10 @@
 #pragma once
 
 #include <Epic/EntityComponentTraits.hpp>
-#include <Epic/detail/EntityComponent.hpp>
+#include <Epic/EntityHandle.hpp>
+#include <Epic/detail/EntityComponentStorage.hpp>
 #include <Epic/Event.hpp>
 #include <Epic/StringHash.hpp>
-#include <Epic/STL/Map.hpp>
-#include <Epic/STL/UniquePtr.hpp>
 #include <Epic/detail/EntityManagerFwd.hpp>
 #include <functional>
 
@@ -32,7 +31,7 @@ namespace Epic
 {
 	class Entity;
 
-	using EntityID = size_t;
+	using EntityID = Epic::EntityHandle;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -49,14 +48,13 @@ public:
 	constexpr static Epic::StringHash NoEntityName = Epic::Hash("");
 
 private:
-	using ComponentPtr = Epic::UniquePtr<Epic::detail::EntityComponentBase>;
-	using ComponentMap = Epic::STLUnorderedMap<Epic::EntityComponentID, ComponentPtr>;
+	using ComponentStorage = Epic::detail::EntityComponentStorage;
 
 private:
-	ComponentMap m_Components;				// Maps component type IDs to instances of component data
+	ComponentStorage* m_pStorage;			// The component pools owned by the controlling EntityManager
 	Epic::EntityManager* m_pEntityManager;	// This Entity's controlling EntityManager
 	Epic::StringHash m_Name;				// This Entity's name
-	EntityID m_ID;							// This Entity's ID (assigned by controlling EntityManager)
+	EntityID m_ID;							// This Entity's handle (assigned by controlling EntityManager)
 	bool m_DestroyPending;					// Whether or not this Entity is awaiting destruction
 
 private:
@@ -67,8 +65,10 @@ public:
 	ComponentAttachmentDelegate ComponentDetached;
 
 public:
-	inline Entity(Epic::EntityManager* pSystem, Epic::StringHash name, EntityID id) noexcept
-		: m_pEntityManager{ pSystem }, m_Name{ name }, m_ID{ id }, m_DestroyPending { false }
+	inline Entity(Epic::EntityManager* pSystem, ComponentStorage* pStorage, 
+				  Epic::StringHash name, EntityID id) noexcept
+		: m_pStorage{ pStorage }, m_pEntityManager{ pSystem }, m_Name{ name }, 
+		  m_ID{ id }, m_DestroyPending { false }
 	{ }
 
 	~Entity() noexcept 
@@ -97,6 +97,11 @@ public:
 		return m_ID;
 	}
 
+	size_t GetIndex() const noexcept
+	{
+		return m_ID.Index;
+	}
+
 	bool IsDestroyPending() const
 	{
 		return m_DestroyPending;
@@ -130,7 +135,7 @@ public:
 		//
 		////////////////////////////////////////////////////////////////////////////////
 
-		return m_Components.find(Epic::EntityComponentTraits<Component>::ID) != std::end(m_Components);
+		return m_pStorage->Has<Component>(m_ID.Index);
 	}
 
 	// Query whether or not this Entity has ALL the components
@@ -161,30 +166,10 @@ public:
 		//
 		////////////////////////////////////////////////////////////////////////////////
 
-		auto it = m_Components.find(Epic::EntityComponentTraits<Component>::ID);
-
-		if (it != std::end(m_Components))
-		{
-			auto pContainer = static_cast<detail::EntityComponent<Component>*>((*it).second.get());
-			pContainer->Component = Component{ std::forward<Args>(args)... };
-			
-			this->ComponentAttached(this, Epic::EntityComponentTraits<Component>::ID);
+		auto& component = m_pStorage->Assign<Component>(this, m_ID.Index, std::forward<Args>(args)...);
+		this->ComponentAttached(this, Epic::EntityComponentTraits<Component>::ID);
 
-			return pContainer->Component;
-		}
-		else
-		{
-			auto pContainerBase 
-				= Epic::MakeImpl<detail::EntityComponentBase, 
-								 detail::EntityComponent<Component>>
-									 (Component{ std::forward<Args>(args)... });
-			auto pContainer = static_cast<detail::EntityComponent<Component>*>(pContainerBase.get());
-			
-			m_Components[Epic::EntityComponentTraits<Component>::ID] = std::move(pContainerBase);
-			this->ComponentAttached(this, Epic::EntityComponentTraits<Component>::ID);
-
-			return pContainer->Component;
-		}
+		return component;
 	}
 
 	// Erase a component from this Entity.
@@ -192,10 +177,8 @@ public:
 	template<class Component>
 	bool Erase() noexcept
 	{
-		auto it = m_Components.find(Epic::EntityComponentTraits<Component>::ID);
-		if (it != std::end(m_Components))
+		if (m_pStorage->Erase<Component>(m_ID.Index))
 		{
-			m_Components.erase(it);
 			this->ComponentDetached(this, Epic::EntityComponentTraits<Component>::ID);
 
 			return true;
@@ -207,23 +190,20 @@ public:
 	// Erase all components from this Entity.
 	inline void EraseAll() noexcept
 	{
-		for (const auto& cmp : m_Components)
-			this->ComponentDetached(this, cmp.first);
-
-		m_Components.clear();
+		m_pStorage->EraseAll(m_ID.Index, [this] (Epic::EntityComponentID id)
+		{
+			this->ComponentDetached(this, id);
+		});
 	}
 
 	// Get a component that has been attached to this Entity.
+	// The component is not stamped as changed (see Modify() and MarkChanged()).
 	// Will fail an assertion if this Entity does not have the component.
 	// Use Has<Component>() if unsure.
 	template<class Component>
 	Component& Get() noexcept
 	{
-		auto it = m_Components.find(Epic::EntityComponentTraits<Component>::ID);
-		assert(it != std::end(m_Components));
-
-		auto pContainer = static_cast<detail::EntityComponent<Component>*>((*it).second.get());
-		return pContainer->Component;
+		return m_pStorage->Get<Component>(m_ID.Index);
 	}
 
 	// Get a component that has been attached to this Entity.
@@ -232,11 +212,42 @@ public:
 	template<class Component>
 	const Component& Get() const noexcept
 	{
-		auto it = m_Components.find(Epic::EntityComponentTraits<Component>::ID);
-		assert(it != std::end(m_Components));
+		return m_pStorage->Get<Component>(m_ID.Index);
+	}
 
-		auto pContainer = static_cast<detail::EntityComponent<Component>*>((*it).second.get());
-		return pContainer->Component;
+public:
+	// Get a component that has been attached to this Entity and stamp it as changed.
+	// Will fail an assertion if this Entity does not have the component.
+	template<class Component>
+	Component& Modify() noexcept
+	{
+		return m_pStorage->Modify<Component>(m_ID.Index);
+	}
+
+	// Stamp a component with the EntityManager's current version.
+	// Only Modify() and MarkChanged() stamp components; Get() and bulk iteration
+	// (EntityManager::Each(), EntityQuery::Each(), EntityManager::ParallelEach()) do not.
+	// Will fail an assertion if this Entity does not have the component.
+	template<class Component>
+	inline void MarkChanged() noexcept
+	{
+		m_pStorage->MarkChanged<Component>(m_ID.Index);
+	}
+
+	// Retrieve the version at which a component was last attached or changed.
+	// Will fail an assertion if this Entity does not have the component.
+	template<class Component>
+	inline auto GetVersion() const noexcept
+	{
+		return m_pStorage->GetVersion<Component>(m_ID.Index);
+	}
+
+	// Query whether or not a component was attached or changed after version 'since'.
+	// Will fail an assertion if this Entity does not have the component.
+	template<class Component>
+	inline bool ChangedSince(Epic::detail::EntityComponentStorage::VersionType since) const noexcept
+	{
+		return GetVersion<Component>() > since;
 	}
 
 public:
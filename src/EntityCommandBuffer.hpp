@@ -0,0 +1,324 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//
+//    This simple ECS system was inspired by Sam Bloomberg's ECS system
+//        available for download at: https://github.com/redxdev/ECS
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/EntityComponentTraits.hpp>
+#include <Epic/EntityHandle.hpp>
+#include <Epic/Entity.hpp>
+#include <Epic/StringHash.hpp>
+#include <Epic/detail/EntityComponentPool.hpp>
+#include <Epic/detail/EntityComponentStorage.hpp>
+#include <Epic/detail/EntityManagerFwd.hpp>
+#include <Epic/STL/UniquePtr.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	struct DeferredEntity;
+
+	class EntityCommandBuffer;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// DeferredEntity
+//	Refers to either an existing Entity or to an Entity whose creation has
+//	been recorded in an EntityCommandBuffer but not yet applied.
+struct Epic::DeferredEntity
+{
+	using Type = Epic::DeferredEntity;
+
+	static constexpr uint32_t NotPending = ~uint32_t(0);
+
+	Epic::EntityHandle Handle;
+	uint32_t PendingIndex;
+	const Epic::EntityCommandBuffer* pOwner;	// The buffer that recorded the creation (if pending)
+
+	DeferredEntity(Epic::EntityHandle handle) noexcept
+		: Handle{ handle }, PendingIndex{ NotPending }, pOwner{ nullptr }
+	{ }
+
+	DeferredEntity(const Epic::Entity* pEntity) noexcept
+		: Handle{ pEntity->GetID() }, PendingIndex{ NotPending }, pOwner{ nullptr }
+	{ }
+
+	bool IsPending() const noexcept
+	{
+		return PendingIndex != NotPending;
+	}
+
+private:
+	friend class Epic::EntityCommandBuffer;
+
+	DeferredEntity(const Epic::EntityCommandBuffer* pBuffer, uint32_t pendingIndex) noexcept
+		: Handle{ }, PendingIndex{ pendingIndex }, pOwner{ pBuffer }
+	{ }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityCommandBuffer
+//	Records structural changes (entity creation and destruction, component 
+//	attachment and removal) so that they can be applied together by
+//	EntityManager::Apply().  Recording is thread-safe.
+//
+//	When applied, the commands recorded against each Entity are collapsed to 
+//	their final effect: for each component type, only the last Assign or Erase 
+//	is applied, and commands recorded after an Entity's destruction are ignored.
+//	Each EntitySystem then receives one batched notification for the created entities,
+//	one per component type for attachments and for removals, and one for the destroyed
+//	entities (see EntitySystem::EntitiesCreated, EntityComponentsAttached, etc).  
+//	The per-entity ComponentAttached/ComponentDetached events and the EntityManager's 
+//	EntityCreated/EntityDestroyed events are not raised for buffered changes.
+class Epic::EntityCommandBuffer
+{
+public:
+	using Type = Epic::EntityCommandBuffer;
+
+private:
+	friend class Epic::EntityManager;
+
+	using EntityList = Epic::detail::EntityComponentStorage::EntityList;
+
+	// Target - A resolved Entity and the queue slot of the component to attach to it
+	struct Target
+	{
+		Epic::Entity* pEntity;
+		uint32_t Slot;
+	};
+
+	// ComponentQueueBase
+	class ComponentQueueBase
+	{
+	private:
+		Epic::EntityComponentID m_ComponentID;
+
+	public:
+		explicit ComponentQueueBase(Epic::EntityComponentID id) noexcept
+			: m_ComponentID{ id }
+		{ }
+
+		virtual ~ComponentQueueBase() { }
+
+	public:
+		inline Epic::EntityComponentID GetComponentID() const noexcept
+		{
+			return m_ComponentID;
+		}
+
+		// Attach the components queued at each target's slot.
+		// Entities that received a component are appended to 'out'.
+		virtual void ApplyAssigns(Epic::detail::EntityComponentStorage& storage, 
+								  const Target* pTargets, size_t count, EntityList& out) = 0;
+
+		// Erase the component from each target.
+		// Entities that lost a component are appended to 'out'.
+		virtual void ApplyErases(Epic::detail::EntityComponentStorage& storage, 
+								 const Target* pTargets, size_t count, EntityList& out) = 0;
+
+		virtual void Clear() noexcept = 0;
+	};
+
+	// ComponentQueue<C>
+	template<class C>
+	class ComponentQueue : public ComponentQueueBase
+	{
+	public:
+		Epic::STLVector<C> Values;		// Components to attach (indexed by Command::Slot)
+
+	public:
+		ComponentQueue() noexcept
+			: ComponentQueueBase{ Epic::EntityComponentTraits<C>::ID }
+		{ }
+
+	public:
+		void ApplyAssigns(Epic::detail::EntityComponentStorage& storage, 
+						  const Target* pTargets, size_t count, EntityList& out) override
+		{
+			if (count == 0)
+				return;
+
+			auto& pool = storage.GetPool<C>();
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				auto pEntity = pTargets[i].pEntity;
+
+				pool.Assign(pEntity, pEntity->GetIndex(), std::move(Values[pTargets[i].Slot]));
+				out.emplace_back(pEntity);
+			}
+		}
+
+		void ApplyErases(Epic::detail::EntityComponentStorage& storage, 
+						 const Target* pTargets, size_t count, EntityList& out) override
+		{
+			auto pPool = storage.FindPool<C>();
+			if (!pPool)
+				return;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (pPool->Erase(pTargets[i].pEntity->GetIndex()))
+					out.emplace_back(pTargets[i].pEntity);
+			}
+		}
+
+		void Clear() noexcept override
+		{
+			Values.clear();
+		}
+	};
+
+	enum class eCommand : uint32_t
+	{
+		Assign,
+		Erase,
+		Destroy
+	};
+
+	// Command - One recorded Assign, Erase or Destroy
+	struct Command
+	{
+		Epic::DeferredEntity Entity;
+		eCommand Kind;
+		uint32_t Queue;		// Component type index (Assign and Erase)
+		uint32_t Slot;		// Index into the queue's Values (Assign)
+	};
+
+	using ComponentQueuePtr = Epic::UniquePtr<ComponentQueueBase>;
+	using ComponentQueueList = Epic::STLVector<ComponentQueuePtr>;
+	using CommandList = Epic::STLVector<Command>;
+	using NameList = Epic::STLVector<Epic::StringHash>;
+
+private:
+	std::mutex m_Mutex;
+	NameList m_Creates;				// Names of the entities to create (indexed by DeferredEntity::PendingIndex)
+	ComponentQueueList m_Queues;	// Component queues (indexed by component type index)
+	CommandList m_Commands;			// Assigns, erases and destructions in the order they were recorded
+	std::atomic<bool> m_IsEmpty;
+
+public:
+	EntityCommandBuffer() noexcept
+		: m_IsEmpty{ true }
+	{ }
+
+	EntityCommandBuffer(const Type&) = delete;
+	EntityCommandBuffer& operator = (const Type&) = delete;
+
+private:
+	// NOTE: m_Mutex must be held
+	template<class Component>
+	ComponentQueue<Component>& _GetQueue(size_t index)
+	{
+		if (index >= m_Queues.size())
+			m_Queues.resize(index + 1);
+
+		if (!m_Queues[index])
+			m_Queues[index] = Epic::MakeImpl<ComponentQueueBase, ComponentQueue<Component>>();
+
+		return static_cast<ComponentQueue<Component>&>(*m_Queues[index]);
+	}
+
+	// NOTE: m_Mutex must be held
+	void _Clear() noexcept
+	{
+		m_Creates.clear();
+		m_Commands.clear();
+
+		for (auto& pQueue : m_Queues)
+		{
+			if (pQueue)
+				pQueue->Clear();
+		}
+
+		m_IsEmpty = true;
+	}
+
+public:
+	// Query whether or not any commands have been recorded
+	bool IsEmpty() const noexcept
+	{
+		return m_IsEmpty;
+	}
+
+	// Discard all recorded commands
+	void Clear() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		_Clear();
+	}
+
+public:
+	// Record the creation of an Entity.
+	// The returned DeferredEntity may be used to record further commands against it in this buffer.
+	Epic::DeferredEntity CreateEntity(Epic::StringHash name = Epic::Entity::NoEntityName)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		m_Creates.emplace_back(name);
+		m_IsEmpty = false;
+
+		return Epic::DeferredEntity{ this, static_cast<uint32_t>(m_Creates.size() - 1) };
+	}
+
+	// Record the destruction of an Entity
+	void DestroyEntity(Epic::DeferredEntity entity)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		m_Commands.push_back({ entity, eCommand::Destroy, 0, 0 });
+		m_IsEmpty = false;
+	}
+
+	// Record the attachment of a component to an Entity.
+	// The component is constructed immediately; Args... are forwarded to Component's ctor
+	template<class Component, class... Args>
+	void Assign(Epic::DeferredEntity entity, Args&&... args)
+	{
+		Component component{ std::forward<Args>(args)... };
+
+		const size_t index = Epic::detail::EntityComponentTypeIndexer::Get<Component>();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		auto& queue = _GetQueue<Component>(index);
+
+		m_Commands.push_back({ entity, eCommand::Assign, static_cast<uint32_t>(index), static_cast<uint32_t>(queue.Values.size()) });
+		queue.Values.emplace_back(std::move(component));
+		m_IsEmpty = false;
+	}
+
+	// Record the removal of a component from an Entity
+	template<class Component>
+	void Erase(Epic::DeferredEntity entity)
+	{
+		const size_t index = Epic::detail::EntityComponentTypeIndexer::Get<Component>();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		_GetQueue<Component>(index);
+
+		m_Commands.push_back({ entity, eCommand::Erase, static_cast<uint32_t>(index), 0 });
+		m_IsEmpty = false;
+	}
+};
@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//
+//    This simple ECS system was inspired by Sam Bloomberg's ECS system
+//        available for download at: https://github.com/redxdev/ECS
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	struct EntityHandle;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityHandle
+//	Identifies an Entity by its slot index and the generation of that slot.
+//	A slot's generation is bumped each time its Entity is destroyed, so handles
+//	to destroyed entities are detected by a single comparison.
+struct Epic::EntityHandle
+{
+	using Type = Epic::EntityHandle;
+	using IndexType = uint32_t;
+	using GenerationType = uint32_t;
+
+	static constexpr IndexType InvalidIndex = ~IndexType(0);
+	static constexpr GenerationType InvalidGeneration = 0;
+
+	IndexType Index;
+	GenerationType Generation;
+
+	constexpr EntityHandle() noexcept
+		: Index{ InvalidIndex }, Generation{ InvalidGeneration }
+	{ }
+
+	constexpr EntityHandle(IndexType index, GenerationType generation) noexcept
+		: Index{ index }, Generation{ generation }
+	{ }
+
+	// Query whether or not this handle was ever assigned to an Entity.
+	// NOTE: A non-null handle may still be stale. Use EntityManager::IsValid() to check.
+	constexpr bool IsNull() const noexcept
+	{
+		return Generation == InvalidGeneration;
+	}
+
+	constexpr explicit operator bool() const noexcept
+	{
+		return !IsNull();
+	}
+
+	constexpr uint64_t Value() const noexcept
+	{
+		return (uint64_t(Generation) << 32) | uint64_t(Index);
+	}
+
+	constexpr bool operator == (const Type& other) const noexcept
+	{
+		return Index == other.Index && Generation == other.Generation;
+	}
+
+	constexpr bool operator != (const Type& other) const noexcept
+	{
+		return !(*this == other);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// std::hash<Epic::EntityHandle>
+namespace std
+{
+	template<>
+	struct hash<Epic::EntityHandle>
+	{
+		constexpr hash() noexcept = default;
+
+		size_t operator() (const Epic::EntityHandle& x) const noexcept
+		{
+			return std::hash<uint64_t>{}(x.Value());
+		}
+	};
+}
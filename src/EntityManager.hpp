@@ -18,20 +18,37 @@
 #pragma once
 
 #include <Epic/detail/EntityComponentIterator.hpp>
+#include <Epic/detail/EntityComponentStorage.hpp>
 #include <Epic/detail/EntityComponentView.hpp>
 #include <Epic/detail/EntityManagerFwd.hpp>
 #include <Epic/Entity.hpp>
+#include <Epic/EntityCommandBuffer.hpp>
+#include <Epic/EntityQuery.hpp>
 #include <Epic/EntitySystem.hpp>
 #include <Epic/Event.hpp>
+#include <Epic/Memory/AlignedMallocator.hpp>
 #include <Epic/StringHash.hpp>
+#include <Epic/ThreadPool.hpp>
 #include <Epic/STL/Vector.hpp>
 #include <Epic/STL/Map.hpp>
 #include <Epic/STL/UniquePtr.hpp>
 #include <algorithm>
+#include <cassert>
 #include <functional>
 
 //////////////////////////////////////////////////////////////////////////////
 
+namespace Epic
+{
+	enum class eEntityUpdateMode
+	{
+		Serial,		// Systems are updated one at a time, in creation order
+		Parallel	// Systems with non-conflicting access are updated concurrently
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 // EntityManager
 class Epic::EntityManager
 {
@@ -40,25 +57,49 @@ public:
 
 public:
 	constexpr static Epic::StringHash NoEntityName = Entity::NoEntityName;
+	constexpr static size_t DefaultGrainSize = 256;
 
 private:
 	using EntityPtr = Epic::UniquePtr<Entity>;
-	using EntityList = Epic::STLVector<EntityPtr>;
+	using EntityList = Epic::detail::EntityComponentStorage::EntityList;
 	using EntityNameMap = Epic::STLUnorderedMap<Epic::StringHash, EntityPtr::pointer>;
-	using EntityIDMap = Epic::STLUnorderedMap<EntityID, EntityPtr::pointer>;
 	using SystemPtr = Epic::UniquePtr<EntitySystem>;
 	using SystemList = Epic::STLVector<SystemPtr>;
+	using SystemWave = Epic::STLVector<SystemPtr::pointer>;
+	using SystemSchedule = Epic::STLVector<SystemWave>;
+	using ThreadPoolPtr = Epic::UniquePtr<Epic::ThreadPool>;
+	using IndexType = Epic::EntityHandle::IndexType;
+	using GenerationType = Epic::EntityHandle::GenerationType;
+
+	struct EntitySlot
+	{
+		EntityPtr pEntity;			// The Entity occupying this slot (or null if the slot is free)
+		GenerationType Generation;	// Incremented each time the slot is vacated
+		IndexType Link;				// Index into m_Entities if occupied, next free slot otherwise
+	};
+
+	using EntitySlotList = Epic::STLVector<EntitySlot>;
+
+	static constexpr IndexType InvalidIndex = Epic::EntityHandle::InvalidIndex;
 
 private:
-	EntityID m_NextID;
-	EntityList m_Entities;
+	Epic::detail::EntityComponentStorage m_Storage;		// Component pools (must outlive m_EntitySlots)
+	EntitySlotList m_EntitySlots;						// Owns entities; indexed by EntityHandle::Index
+	IndexType m_FreeSlot;								// Head of the free slot list
+	EntityList m_Entities;								// Packed list of live entities
 	EntityNameMap m_NameEntityMap;
-	EntityIDMap m_IDEntityMap;
 	SystemList m_Systems;
+	SystemSchedule m_Schedule;							// Waves of systems that may be updated concurrently
+	Epic::EntityCommandBuffer m_Commands;				// Applied at the end of each Update()
+	Epic::eEntityUpdateMode m_UpdateMode;
+	Epic::ThreadPool* m_pThreadPool;
+	ThreadPoolPtr m_pOwnedThreadPool;
+	bool m_ScheduleDirty;
 
 public:
 	EntityManager() noexcept 
-		: m_NextID{ 1 } 
+		: m_FreeSlot{ InvalidIndex }, m_UpdateMode{ Epic::eEntityUpdateMode::Serial }, 
+		  m_pThreadPool{ nullptr }, m_ScheduleDirty{ true }
 	{ }
 
 	~EntityManager() noexcept
@@ -80,16 +121,61 @@ private:
 
 	void _DestroyEntity(EntityPtr::pointer pEntity) noexcept
 	{
-		m_NameEntityMap.erase(pEntity->GetName());
-		m_IDEntityMap.erase(pEntity->GetID());
+		const IndexType index = pEntity->GetID().Index;
+		auto& slot = m_EntitySlots[index];
+		
+		assert(slot.pEntity.get() == pEntity);
+
+		auto itName = m_NameEntityMap.find(pEntity->GetName());
+		if (itName != std::end(m_NameEntityMap) && itName->second == pEntity)
+			m_NameEntityMap.erase(itName);
+
+		// Swap the last live entity into the vacated position
+		const IndexType dense = slot.Link;
+		EntityPtr::pointer pLast = m_Entities.back();
+
+		m_Entities[dense] = pLast;
+		m_EntitySlots[pLast->GetID().Index].Link = dense;
+		m_Entities.pop_back();
+
+		// Destroy the entity and release its slot
+		slot.pEntity.reset();
+		
+		if (++slot.Generation == Epic::EntityHandle::InvalidGeneration)
+			++slot.Generation;
+
+		slot.Link = m_FreeSlot;
+		m_FreeSlot = index;
+	}
+
+	inline IndexType _AcquireSlot()
+	{
+		if (m_FreeSlot == InvalidIndex)
+		{
+			m_EntitySlots.emplace_back(EntitySlot{ nullptr, 1, InvalidIndex });
+			return static_cast<IndexType>(m_EntitySlots.size() - 1);
+		}
 
-		auto it = std::find_if(
-			std::begin(m_Entities),
-			std::end(m_Entities),
-			[&](const auto& p) { return p.get() == pEntity; });
+		const IndexType index = m_FreeSlot;
+		m_FreeSlot = m_EntitySlots[index].Link;
 
-		if (it != std::end(m_Entities))
-			m_Entities.erase(it);
+		return index;
+	}
+
+	// Retrieve the packed entity list that should drive iteration over Components.
+	// With no Components, every live entity is visited.
+	template<class... Components>
+	const EntityList* _GetDrivingList() const noexcept
+	{
+		static const EntityList s_EmptyList;
+
+		if constexpr (sizeof...(Components) == 0)
+			return &m_Entities;
+		else
+		{
+			auto pList = m_Storage.FindSmallestList<Components...>();
+			return pList ? pList : &s_EmptyList;
+		}
 	}
 
 	inline auto _GetSystemByPtr(SystemPtr::pointer p) noexcept
@@ -98,6 +184,43 @@ private:
 							[&](const SystemPtr& pSystem) { return pSystem.get() == p; });
 	}
 
+	// Sort the systems into waves.  A system is placed in the wave after the last
+	// wave containing an earlier system that it conflicts with, so conflicting 
+	// systems always update in creation order.
+	void _BuildSchedule()
+	{
+		const size_t count = m_Systems.size();
+
+		Epic::STLVector<Epic::EntitySystemAccess> access(count);
+		Epic::STLVector<size_t> waves(count, 0);
+		Epic::STLVector<bool> declared(count, false);
+
+		for (auto& wave : m_Schedule)
+			wave.clear();
+
+		size_t waveCount = 0;
+
+		for (size_t j = 0; j < count; ++j)
+		{
+			declared[j] = m_Systems[j]->GetAccess(access[j]);
+
+			for (size_t i = 0; i < j; ++i)
+			{
+				if (!declared[i] || !declared[j] || access[i].ConflictsWith(access[j]))
+					waves[j] = std::max(waves[j], waves[i] + 1);
+			}
+
+			if (waves[j] >= m_Schedule.size())
+				m_Schedule.resize(waves[j] + 1);
+
+			m_Schedule[waves[j]].emplace_back(m_Systems[j].get());
+			waveCount = std::max(waveCount, waves[j] + 1);
+		}
+
+		m_Schedule.resize(waveCount);
+		m_ScheduleDirty = false;
+	}
+
 	inline void _ConstructSystem(SystemPtr::pointer pSystem) noexcept
 	{
 		EntityCreated.Connect(pSystem, &EntitySystem::OnEntityCreated);
@@ -135,18 +258,22 @@ public:
 		return m_Systems.size();
 	}
 
-	inline EntityPtr::pointer GetEntity(const EntityID id) noexcept
+	// Query whether or not 'id' refers to an Entity that has not been destroyed
+	inline bool IsValid(const EntityID id) const noexcept
 	{
-		auto it = m_IDEntityMap.find(id);
-
-		return (it != std::end(m_IDEntityMap)) ? it->second : nullptr;
+		return id.Index < m_EntitySlots.size() && 
+			m_EntitySlots[id.Index].Generation == id.Generation &&
+			m_EntitySlots[id.Index].pEntity;
 	}
 
-	inline const EntityPtr::pointer GetEntity(const EntityID id) const noexcept
+	inline EntityPtr::pointer GetEntity(const EntityID id) noexcept
 	{
-		auto it = m_IDEntityMap.find(id);
+		return IsValid(id) ? m_EntitySlots[id.Index].pEntity.get() : nullptr;
+	}
 
-		return (it != std::end(m_IDEntityMap)) ? it->second : nullptr;
+	inline const EntityPtr::element_type* GetEntity(const EntityID id) const noexcept
+	{
+		return IsValid(id) ? m_EntitySlots[id.Index].pEntity.get() : nullptr;
 	}
 
 	inline EntityPtr::pointer GetEntity(Epic::StringHash name) noexcept
@@ -156,7 +283,7 @@ public:
 		return (it != std::end(m_NameEntityMap)) ? it->second : nullptr;
 	}
 
-	inline const EntityPtr::pointer GetEntity(Epic::StringHash name) const noexcept
+	inline const EntityPtr::element_type* GetEntity(Epic::StringHash name) const noexcept
 	{
 		auto it = m_NameEntityMap.find(name);
 
@@ -165,16 +292,16 @@ public:
 
 	inline EntityPtr::pointer GetEntityByIndex(size_t index) noexcept
 	{
-		if (index >= 0 && index < m_Entities.size())
-			return m_Entities[index].get();
+		if (index < m_Entities.size())
+			return m_Entities[index];
 
 		return nullptr;
 	}
 
-	inline const EntityPtr::pointer GetEntityByIndex(size_t index) const noexcept
+	inline const EntityPtr::element_type* GetEntityByIndex(size_t index) const noexcept
 	{
-		if (index >= 0 && index < m_Entities.size())
-			return m_Entities[index].get();
+		if (index < m_Entities.size())
+			return m_Entities[index];
 
 		return nullptr;
 	}
@@ -182,15 +309,15 @@ public:
 public:
 	inline SystemPtr::pointer GetSystemByIndex(size_t index) noexcept
 	{
-		if (index >= 0 && index < m_Systems.size())
+		if (index < m_Systems.size())
 			return m_Systems[index].get();
 
 		return nullptr;
 	}
 
-	inline const SystemPtr::pointer GetSystemByIndex(size_t index) const noexcept
+	inline const SystemPtr::element_type* GetSystemByIndex(size_t index) const noexcept
 	{
-		if (index >= 0 && index < m_Systems.size())
+		if (index < m_Systems.size())
 			return m_Systems[index].get();
 
 		return nullptr;
@@ -205,25 +332,39 @@ public:
 	template<class System>
 	inline const System* GetSystemByIndexAs(size_t index) const noexcept
 	{
-		return static_cast<System*>(GetSystemByIndex(index));
+		return static_cast<const System*>(GetSystemByIndex(index));
 	}
 
 public:
 	EntityPtr::pointer CreateEntity(Epic::StringHash name = NoEntityName) noexcept
 	{
-		m_Entities.emplace_back(Epic::MakeUnique<Entity>(this, name, m_NextID++));
-		EntityPtr::pointer pEntity = m_Entities.back().get();
+		EntityPtr::pointer pEntity = _CreateEntity(name);
+		
+		OnEntityCreated(pEntity);
 
-		if (name != NoEntityName)
-			m_NameEntityMap[name] = pEntity;
+		return pEntity;
+	}
 
-		m_IDEntityMap[pEntity->GetID()] = pEntity;
+private:
+	EntityPtr::pointer _CreateEntity(Epic::StringHash name) noexcept
+	{
+		const IndexType index = _AcquireSlot();
+		auto& slot = m_EntitySlots[index];
 
-		OnEntityCreated(pEntity);
+		slot.pEntity = Epic::MakeUnique<Entity>(this, &m_Storage, name, EntityID{ index, slot.Generation });
+		slot.Link = static_cast<IndexType>(m_Entities.size());
+
+		EntityPtr::pointer pEntity = slot.pEntity.get();
+		m_Entities.emplace_back(pEntity);
+
+		if (name != NoEntityName)
+			m_NameEntityMap[name] = pEntity;
 
 		return pEntity;
 	}
 
+public:
+
 	void DestroyEntity(EntityPtr::pointer pEntity, bool destroyNow = false) noexcept
 	{
 		if (!pEntity)
@@ -257,16 +398,36 @@ public:
 	void DestroyEntities() noexcept
 	{
 		m_NameEntityMap.clear();
-		m_IDEntityMap.clear();
 
-		for (auto& pEntity : m_Entities)
+		for (auto pEntity : m_Entities)
 		{
-			pEntity->Destroy();
-			OnEntityDestroyed(pEntity.get());
+			if (!pEntity->IsDestroyPending())
+			{
+				pEntity->Destroy();
+				OnEntityDestroyed(pEntity);
+			}
 		}
 
 		m_Entities.clear();
-		m_NextID = 1;
+
+		// Release every slot (lowest indices are reused first)
+		m_FreeSlot = InvalidIndex;
+
+		for (size_t i = m_EntitySlots.size(); i-- > 0; )
+		{
+			auto& slot = m_EntitySlots[i];
+
+			if (slot.pEntity)
+			{
+				slot.pEntity.reset();
+
+				if (++slot.Generation == Epic::EntityHandle::InvalidGeneration)
+					++slot.Generation;
+			}
+
+			slot.Link = m_FreeSlot;
+			m_FreeSlot = static_cast<IndexType>(i);
+		}
 	}
 
 public:
@@ -278,6 +439,7 @@ public:
 		auto pSystem = m_Systems.back().get();
 
 		_ConstructSystem(pSystem);
+		m_ScheduleDirty = true;
 		
 		return static_cast<System*>(pSystem);
 	}
@@ -289,6 +451,7 @@ public:
 		{
 			_DestroySystem(it->get());
 			m_Systems.erase(it);
+			m_ScheduleDirty = true;
 		}
 	}
 
@@ -298,90 +461,153 @@ public:
 			_DestroySystem(pSystem.get());
 
 		m_Systems.clear();
+		m_ScheduleDirty = true;
 	}
 
 public:
 	template<class... Components>
 	Epic::detail::EntityComponentView<Components...> Each(bool includeDestroyed = false) noexcept
 	{
+		auto pList = _GetDrivingList<Components...>();
+
 		return Epic::detail::EntityComponentView<Components...>
 		{
-			{ this, 0, includeDestroyed },
-			{ this, GetEntityCount(), includeDestroyed }
+			{ this, pList, 0, includeDestroyed },
+			{ this, pList, pList->size(), includeDestroyed }
 		};
 	}
 
 	template<class... Components>
 	Epic::detail::ConstEntityComponentView<Components...> Each(bool includeDestroyed = false) const noexcept
 	{
+		auto pList = _GetDrivingList<Components...>();
+
 		return Epic::detail::ConstEntityComponentView<Components...>
 		{
-			{ this, 0, includeDestroyed },
-			{ this, GetEntityCount(), includeDestroyed }
+			{ this, pList, 0, includeDestroyed },
+			{ this, pList, pList->size(), includeDestroyed }
 		};
 	}
 
+	// Calls 'fn(Entity&, Components&...)' for each Entity that has ALL Components.
+	// NOTE: Components are not stamped as changed.  Use Entity::MarkChanged() after modifying one.
 	template<class... Components>
 	void Each(std::function<void(Entity&, Components&...)> fn, bool includeDestroyed = false)
 	{
-		if (includeDestroyed)
-		{
-			for (auto& pEntity : m_Entities)
-			{
-				auto& entity = *pEntity;
-				if (entity.Has<Components...>())
-					fn(entity, entity.Get<Components>()...);
-			}
-		}
-		else
+		auto pList = _GetDrivingList<Components...>();
+
+		for (size_t i = 0; i < pList->size(); ++i)
 		{
-			for (auto& pEntity : m_Entities)
-			{
-				auto& entity = *pEntity;
-				if (entity.Has<Components...>() && !entity.IsDestroyPending())
-					fn(entity, entity.Get<Components>()...);
-			}
+			Entity* pEntity = (*pList)[i];
+
+			if (pEntity && detail::EntityHasComponents<Components...>::Apply(pEntity) && 
+				(includeDestroyed || !pEntity->IsDestroyPending()))
+				fn(*pEntity, pEntity->Get<Components>()...);
 		}
 	}
 
+	// Calls 'fn(const Entity&, const Components&...)' for each Entity that has ALL Components.
 	template<class... Components>
 	void Each(std::function<void(const Entity&, const Components&...)> fn, bool includeDestroyed = false) const
 	{
-		if (includeDestroyed)
+		auto pList = _GetDrivingList<Components...>();
+
+		for (size_t i = 0; i < pList->size(); ++i)
 		{
-			for (auto& pEntity : m_Entities)
-			{
-				auto& entity = *pEntity;
-				if (entity.Has<Components...>())
-					fn(entity, entity.Get<Components>()...);
-			}
+			const Entity* pEntity = (*pList)[i];
+
+			if (pEntity && detail::EntityHasComponents<Components...>::Apply(pEntity) && 
+				(includeDestroyed || !pEntity->IsDestroyPending()))
+				fn(*pEntity, pEntity->Get<Components>()...);
 		}
-		else
-		{
-			for (auto& pEntity : m_Entities)
+	}
+
+	// Calls 'fn(Entity&, Components&...)' for each Entity that has ALL Components.
+	// The matching entities are split into chunks of 'grainSize' which are processed 
+	// concurrently on the thread pool.  
+	// NOTE: 'fn' must not create or destroy entities, nor attach or detach components.
+	//		 Components are not stamped as changed.  Use Entity::MarkChanged() after modifying one.
+	template<class... Components, class Function>
+	void ParallelEach(Function&& fn, size_t grainSize = DefaultGrainSize, bool includeDestroyed = false)
+	{
+		_ParallelEach(*_GetDrivingList<Components...>(), grainSize, includeDestroyed,
+			[&fn] (size_t, Entity& entity, Components&... components)
 			{
-				auto& entity = *pEntity;
-				if (entity.Has<Components...>() && !entity.IsDestroyPending())
-					fn(entity, entity.Get<Components>()...);
-			}
-		}
+				fn(entity, components...);
+			},
+			m_Storage.FindPool<Components>()...);
+	}
+
+	// Calls 'fn(T& result, Entity&, Components&...)' for each Entity that has ALL Components.
+	// Each chunk of 'grainSize' entities accumulates into its own result (initialized to 
+	// 'identity'), and the chunk results are then folded in order using 'combine(T, T)'.
+	// NOTE: 'fn' must not create or destroy entities, nor attach or detach components.
+	template<class... Components, class T, class Function, class CombineFunction>
+	T ParallelReduce(T identity, Function&& fn, CombineFunction&& combine, 
+					 size_t grainSize = DefaultGrainSize, bool includeDestroyed = false)
+	{
+		const auto& list = *_GetDrivingList<Components...>();
+		
+		grainSize = std::max<size_t>(grainSize, 1);
+		const size_t chunkCount = (list.size() + grainSize - 1) / grainSize;
+
+		// Each chunk's result occupies its own cache line so that workers do not contend
+		// (this also sidesteps vector<bool>'s packed proxies)
+		struct alignas(64) ResultSlot { T Value; };
+
+		Epic::STLVector<ResultSlot, Epic::AlignedMallocator> results(chunkCount, ResultSlot{ identity });
+
+		_ParallelEach(list, grainSize, includeDestroyed,
+			[&fn, &results] (size_t chunk, Entity& entity, Components&... components)
+			{
+				fn(results[chunk].Value, entity, components...);
+			},
+			m_Storage.FindPool<Components>()...);
+
+		T result = identity;
+
+		for (auto& chunkResult : results)
+			result = combine(std::move(result), std::move(chunkResult.Value));
+
+		return result;
+	}
+
+	// Retrieve the persistent query for entities that have ALL Components.
+	// The query is created on first use and kept up to date as components change.
+	template<class... Components>
+	inline Epic::EntityQuery<Components...>& GetQuery()
+	{
+		return m_Storage.GetQuery<Components...>();
+	}
+
+	// Retrieve the current component version.
+	// Components attached (or changed) are stamped with this version.
+	// Update() increments the version before each system (or parallel wave of systems) 
+	// runs and again before deferred changes are applied.
+	inline Epic::detail::EntityComponentStorage::VersionType GetVersion() const noexcept
+	{
+		return m_Storage.GetVersion();
 	}
 
 	Epic::detail::EntityComponentView<> All(bool includeDestroyed = false) noexcept
 	{
+		auto pList = _GetDrivingList<>();
+
 		return Epic::detail::EntityComponentView<>
 		{
-			{ this, 0, includeDestroyed },
-			{ this, GetEntityCount(), includeDestroyed }
+			{ this, pList, 0, includeDestroyed },
+			{ this, pList, pList->size(), includeDestroyed }
 		};
 	}
 
 	Epic::detail::ConstEntityComponentView<> All(bool includeDestroyed = false) const noexcept
 	{
+		auto pList = _GetDrivingList<>();
+
 		return Epic::detail::ConstEntityComponentView<>
 		{
-			{ this, 0, includeDestroyed },
-			{ this, GetEntityCount(), includeDestroyed }
+			{ this, pList, 0, includeDestroyed },
+			{ this, pList, pList->size(), includeDestroyed }
 		};
 	}
 
@@ -419,28 +645,291 @@ public:
 		}
 	}
 
+private:
+	inline Epic::ThreadPool& _GetThreadPool()
+	{
+		if (!m_pThreadPool)
+		{
+			if (!m_pOwnedThreadPool)
+				m_pOwnedThreadPool = Epic::MakeUnique<Epic::ThreadPool>();
+
+			m_pThreadPool = m_pOwnedThreadPool.get();
+		}
+
+		return *m_pThreadPool;
+	}
+
+	template<class Function, class... Pools>
+	void _ParallelEach(const EntityList& list, size_t grainSize, bool includeDestroyed, 
+					   Function&& fn, Pools*... pPools)
+	{
+		// A missing pool means no entity has that component
+		if (!(true && ... && pPools))
+			return;
+
+		const size_t count = list.size();
+		grainSize = std::max<size_t>(grainSize, 1);
+
+		_GetThreadPool().ParallelFor((count + grainSize - 1) / grainSize, [&] (size_t chunk)
+		{
+			const size_t first = chunk * grainSize;
+			const size_t last = std::min(count, first + grainSize);
+
+			for (size_t i = first; i < last; ++i)
+			{
+				Entity* pEntity = list[i];
+				const size_t index = pEntity->GetIndex();
+
+				if ((true && ... && pPools->Has(index)) && 
+					(includeDestroyed || !pEntity->IsDestroyPending()))
+					fn(chunk, *pEntity, pPools->Get(index)...);
+			}
+		});
+	}
+
+public:
+	inline Epic::eEntityUpdateMode GetUpdateMode() const noexcept
+	{
+		return m_UpdateMode;
+	}
+
+	inline Epic::ThreadPool* GetThreadPool() noexcept
+	{
+		return m_pThreadPool;
+	}
+
+	// Set how systems are updated.
+	// In parallel mode, systems run on 'pThreadPool', or on a pool owned by this
+	// EntityManager if 'pThreadPool' is null.
+	void SetUpdateMode(Epic::eEntityUpdateMode mode, Epic::ThreadPool* pThreadPool = nullptr)
+	{
+		m_UpdateMode = mode;
+
+		if (mode == Epic::eEntityUpdateMode::Parallel)
+		{
+			if (pThreadPool)
+				m_pThreadPool = pThreadPool;
+			else
+			{
+				m_pThreadPool = m_pOwnedThreadPool.get();
+				_GetThreadPool();
+			}
+
+			m_ScheduleDirty = true;
+		}
+	}
+
+public:
+	// Retrieve the command buffer that is applied at the end of each Update()
+	inline Epic::EntityCommandBuffer& GetCommandBuffer() noexcept
+	{
+		return m_Commands;
+	}
+
+	// Apply and clear the changes recorded in 'commands'.
+	// Creations are applied first.  The remaining commands are then collapsed per Entity
+	// in recorded order: for each component type only the last Assign or Erase takes effect
+	// (so a component erased and then reassigned remains attached), and commands recorded
+	// against an Entity after its destruction have no effect.
+	// Each system receives one notification for the created entities, one per component
+	// type for attachments and for removals, and one for the destroyed entities.
+	void Apply(Epic::EntityCommandBuffer& commands)
+	{
+		using eCommand = Epic::EntityCommandBuffer::eCommand;
+		using Target = Epic::EntityCommandBuffer::Target;
+
+		if (commands.IsEmpty())
+			return;
+
+		// Take the recorded commands so that systems may record new ones while they are applied
+		Epic::EntityCommandBuffer::NameList creates;
+		Epic::EntityCommandBuffer::ComponentQueueList queues;
+		Epic::EntityCommandBuffer::CommandList log;
+
+		{ /* CS */
+			std::lock_guard<std::mutex> lock(commands.m_Mutex);
+
+			creates.swap(commands.m_Creates);
+			queues.swap(commands.m_Queues);
+			log.swap(commands.m_Commands);
+			commands.m_IsEmpty = true;
+		}
+
+		EntityList created, destroyed, changed;
+
+		// Create entities
+		created.reserve(creates.size());
+
+		for (auto name : creates)
+			created.emplace_back(_CreateEntity(name));
+
+		if (!created.empty())
+		{
+			for (auto& pSystem : m_Systems)
+				pSystem->OnEntitiesCreated(created.data(), created.size());
+		}
+
+		// Resolve the targets in recorded order.
+		// Entities are flagged as they are destroyed, so later commands against them resolve to nothing.
+		struct Operation
+		{
+			Entity* pEntity;
+			eCommand Kind;
+			uint32_t Queue;
+			uint32_t Slot;
+		};
+
+		Epic::STLVector<Operation> operations;
+		operations.reserve(log.size());
+
+		for (const auto& command : log)
+		{
+			Entity* pEntity = nullptr;
+
+			if (command.Entity.IsPending())
+			{
+				assert(command.Entity.pOwner == &commands && "DeferredEntity was created by another EntityCommandBuffer");
+				assert(command.Entity.PendingIndex < created.size());
+
+				pEntity = created[command.Entity.PendingIndex];
+			}
+			else
+				pEntity = GetEntity(command.Entity.Handle);
+
+			if (!pEntity || pEntity->IsDestroyPending())
+				continue;
+
+			if (command.Kind == eCommand::Destroy)
+			{
+				pEntity->Destroy();
+				destroyed.emplace_back(pEntity);
+			}
+			else
+				operations.push_back({ pEntity, command.Kind, command.Queue, command.Slot });
+		}
+
+		// Group the operations by component type and Entity (keeping recorded order within 
+		// each group) and keep only the last operation of each group
+		std::stable_sort(std::begin(operations), std::end(operations), [] (const Operation& a, const Operation& b)
+		{
+			return (a.Queue != b.Queue) ? a.Queue < b.Queue : a.pEntity->GetIndex() < b.pEntity->GetIndex();
+		});
+
+		Epic::STLVector<Target> assigns, erases;
+
+		auto applyQueue = [&] (size_t first, size_t last)
+		{
+			assigns.clear();
+			erases.clear();
+
+			for (size_t i = first; i < last; ++i)
+			{
+				const auto& operation = operations[i];
+
+				if (i + 1 < last && operations[i + 1].pEntity == operation.pEntity)
+					continue;
+
+				if (operation.Kind == eCommand::Assign)
+					assigns.push_back({ operation.pEntity, operation.Slot });
+				else
+					erases.push_back({ operation.pEntity, 0 });
+			}
+
+			auto& pQueue = queues[operations[first].Queue];
+
+			changed.clear();
+			pQueue->ApplyAssigns(m_Storage, assigns.data(), assigns.size(), changed);
+
+			if (!changed.empty())
+			{
+				for (auto& pSystem : m_Systems)
+					pSystem->EntityComponentsAttached(pQueue->GetComponentID(), changed.data(), changed.size());
+			}
+
+			changed.clear();
+			pQueue->ApplyErases(m_Storage, erases.data(), erases.size(), changed);
+
+			if (!changed.empty())
+			{
+				for (auto& pSystem : m_Systems)
+					pSystem->EntityComponentsDetached(pQueue->GetComponentID(), changed.data(), changed.size());
+			}
+		};
+
+		for (size_t first = 0; first < operations.size(); )
+		{
+			size_t last = first + 1;
+			while (last < operations.size() && operations[last].Queue == operations[first].Queue)
+				++last;
+
+			applyQueue(first, last);
+			first = last;
+		}
+
+		// Destroy entities
+		if (!destroyed.empty())
+		{
+			for (auto& pSystem : m_Systems)
+				pSystem->OnEntitiesDestroyed(destroyed.data(), destroyed.size());
+		}
+
+		// Return the (emptied) queues to the buffer so their storage can be reused
+		for (auto& pQueue : queues)
+		{
+			if (pQueue)
+				pQueue->Clear();
+		}
+
+		{ /* CS */
+			std::lock_guard<std::mutex> lock(commands.m_Mutex);
+
+			if (commands.m_Queues.empty())
+				commands.m_Queues.swap(queues);
+		}
+	}
+
 public:
 	void Update()
 	{
 		// Update Systems
-		for (auto& pSystem : m_Systems)
-			pSystem->Update();
+		if (m_UpdateMode == Epic::eEntityUpdateMode::Parallel && m_pThreadPool)
+		{
+			if (m_ScheduleDirty)
+				_BuildSchedule();
 
-		// Update Entity list
-		m_Entities.erase(std::remove_if(
-			std::begin(m_Entities),
-			std::end(m_Entities),
-			[&] (auto& pEntity)
+			// Systems in a wave share a version; none of them reads what another writes
+			for (auto& wave : m_Schedule)
+			{
+				m_Storage.NextVersion();
+				m_pThreadPool->ParallelFor(wave.size(), [&wave] (size_t i) { wave[i]->Update(); });
+
+				for (auto pSystem : wave)
+					pSystem->m_LastRunVersion = m_Storage.GetVersion();
+			}
+		}
+		else
 		{
-			if (pEntity->IsDestroyPending())
+			for (auto& pSystem : m_Systems)
 			{
-				m_NameEntityMap.erase(pEntity->GetName());
-				m_IDEntityMap.erase(pEntity->GetID());
-				return true;
+				m_Storage.NextVersion();
+				pSystem->Update();
+				pSystem->m_LastRunVersion = m_Storage.GetVersion();
 			}
+		}
+
+		// Apply deferred changes.
+		// These (and any changes made before the next Update()) are newer than every system's last run.
+		m_Storage.NextVersion();
+		Apply(m_Commands);
 
-			return false;
-		}), std::end(m_Entities));
+		// Update Entity list
+		for (size_t i = 0; i < m_Entities.size(); )
+		{
+			if (m_Entities[i]->IsDestroyPending())
+				_DestroyEntity(m_Entities[i]);
+			else
+				++i;
+		}
 	}
 
 private:
@@ -0,0 +1,317 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//
+//    This simple ECS system was inspired by Sam Bloomberg's ECS system
+//        available for download at: https://github.com/redxdev/ECS
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Entity.hpp>
+#include <Epic/detail/EntityComponentPool.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <tuple>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	namespace detail
+	{
+		class EntityQueryBase;
+	}
+
+	template<class... Components>
+	class EntityQuery;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityQueryBase
+//	Maintains a packed set of the entities that match a query.
+class Epic::detail::EntityQueryBase : public Epic::detail::EntityComponentPoolObserver
+{
+public:
+	using Type = Epic::detail::EntityQueryBase;
+	using IndexType = Epic::detail::EntityComponentPoolBase::IndexType;
+	using VersionType = Epic::detail::EntityComponentPoolBase::VersionType;
+	using EntityList = Epic::detail::EntityComponentPoolBase::EntityList;
+
+	static constexpr IndexType InvalidIndex = Epic::detail::EntityComponentPoolBase::InvalidIndex;
+
+protected:
+	using IndexList = Epic::STLVector<IndexType>;
+
+protected:
+	IndexList m_Sparse;			// Maps entity indices to dense indices
+	EntityList m_Entities;		// Packed list of matching entities
+
+public:
+	EntityQueryBase() noexcept { }
+
+	EntityQueryBase(const Type&) = delete;
+	EntityQueryBase& operator = (const Type&) = delete;
+
+public:
+	inline size_t Size() const noexcept
+	{
+		return m_Entities.size();
+	}
+
+	inline bool Empty() const noexcept
+	{
+		return m_Entities.empty();
+	}
+
+	// Query whether or not the entity at entityIndex matches this query
+	inline bool Contains(size_t entityIndex) const noexcept
+	{
+		return entityIndex < m_Sparse.size() && m_Sparse[entityIndex] != InvalidIndex;
+	}
+
+	// Retrieve the packed list of matching entities
+	inline const EntityList& GetEntities() const noexcept
+	{
+		return m_Entities;
+	}
+
+	inline auto begin() const noexcept
+	{
+		return std::begin(m_Entities);
+	}
+
+	inline auto end() const noexcept
+	{
+		return std::end(m_Entities);
+	}
+
+protected:
+	void Add(Epic::Entity* pEntity, size_t entityIndex)
+	{
+		if (entityIndex >= m_Sparse.size())
+			m_Sparse.resize(entityIndex + 1, InvalidIndex);
+
+		m_Sparse[entityIndex] = static_cast<IndexType>(m_Entities.size());
+		m_Entities.emplace_back(pEntity);
+	}
+
+	void Remove(size_t entityIndex) noexcept
+	{
+		const size_t dense = m_Sparse[entityIndex];
+		Epic::Entity* pLast = m_Entities.back();
+
+		m_Entities[dense] = pLast;
+		m_Sparse[pLast->GetIndex()] = static_cast<IndexType>(dense);
+		m_Entities.pop_back();
+		m_Sparse[entityIndex] = InvalidIndex;
+	}
+
+public:
+	void OnComponentRemoved(size_t entityIndex) override
+	{
+		if (Contains(entityIndex))
+			Remove(entityIndex);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityQuery<Components...>
+//	A persistent set of the entities that have ALL Components.  Membership is
+//	updated as components are attached and detached, so iterating a query only 
+//	visits matching entities.  Queries are owned by the EntityManager; use 
+//	EntityManager::GetQuery<Components...>() to retrieve one.
+template<class... Components>
+class Epic::EntityQuery : public Epic::detail::EntityQueryBase
+{
+	static_assert(sizeof...(Components) > 0, "EntityQuery requires at least one component type.");
+
+public:
+	using Type = Epic::EntityQuery<Components...>;
+	using Base = Epic::detail::EntityQueryBase;
+
+private:
+	using PoolTuple = std::tuple<Epic::detail::EntityComponentPool<Components>*...>;
+
+private:
+	PoolTuple m_Pools;
+
+public:
+	// ChangedView<Changed>
+	//	The matching entities whose Changed component was attached or changed after a version
+	template<class Changed>
+	class ChangedView
+	{
+	private:
+		using PoolType = Epic::detail::EntityComponentPool<Changed>;
+
+	public:
+		class Iterator
+		{
+		private:
+			const ChangedView* m_pView;
+			size_t m_Index;
+
+		public:
+			Iterator(const ChangedView* pView, size_t index) noexcept
+				: m_pView{ pView }, m_Index{ index }
+			{ 
+				Seek();
+			}
+
+		public:
+			inline Epic::Entity* operator*() const noexcept
+			{
+				return (*m_pView->m_pEntities)[m_Index];
+			}
+
+			inline bool operator == (const Iterator& other) const noexcept
+			{
+				return m_Index == other.m_Index;
+			}
+
+			inline bool operator != (const Iterator& other) const noexcept
+			{
+				return m_Index != other.m_Index;
+			}
+
+			Iterator& operator++ () noexcept
+			{
+				++m_Index;
+				Seek();
+
+				return *this;
+			}
+
+		private:
+			void Seek() noexcept
+			{
+				const auto& entities = *m_pView->m_pEntities;
+
+				while (m_Index < entities.size() &&
+					   m_pView->m_pPool->GetVersion(entities[m_Index]->GetIndex()) <= m_pView->m_Since)
+					++m_Index;
+			}
+		};
+
+	private:
+		const EntityList* m_pEntities;
+		const PoolType* m_pPool;
+		VersionType m_Since;
+
+	public:
+		ChangedView(const EntityList* pEntities, const PoolType* pPool, VersionType since) noexcept
+			: m_pEntities{ pEntities }, m_pPool{ pPool }, m_Since{ since }
+		{ }
+
+	public:
+		inline Iterator begin() const noexcept
+		{
+			// Skip the scan entirely if nothing in the pool has changed
+			return { this, m_pPool->ChangedSince(m_Since) ? 0 : m_pEntities->size() };
+		}
+
+		inline Iterator end() const noexcept
+		{
+			return { this, m_pEntities->size() };
+		}
+	};
+
+public:
+	explicit EntityQuery(Epic::detail::EntityComponentPool<Components>&... pools)
+		: m_Pools{ &pools... }
+	{
+		// Populate from the smallest pool
+		const EntityList* pList = nullptr;
+
+		((pList = (!pList || pools.Size() < pList->size()) ? &pools.GetEntities() : pList), ...);
+
+		for (auto pEntity : *pList)
+		{
+			if (Matches(pEntity->GetIndex()))
+				Add(pEntity, pEntity->GetIndex());
+		}
+
+		(pools.AddObserver(this), ...);
+	}
+
+	~EntityQuery() noexcept
+	{
+		(std::get<Epic::detail::EntityComponentPool<Components>*>(m_Pools)->RemoveObserver(this), ...);
+	}
+
+private:
+	inline bool Matches(size_t entityIndex) const noexcept
+	{
+		return (std::get<Epic::detail::EntityComponentPool<Components>*>(m_Pools)->Has(entityIndex) && ...);
+	}
+
+public:
+	void OnComponentAdded(Epic::Entity* pEntity, size_t entityIndex) override
+	{
+		if (!Contains(entityIndex) && Matches(entityIndex))
+			Add(pEntity, entityIndex);
+	}
+
+public:
+	// Calls 'fn(Entity&, Components&...)' for each matching Entity.
+	// NOTE: Components are not stamped as changed.  Use MarkChanged() after modifying one.
+	template<class Function>
+	void Each(Function&& fn, bool includeDestroyed = false)
+	{
+		for (size_t i = 0; i < m_Entities.size(); ++i)
+		{
+			Epic::Entity* pEntity = m_Entities[i];
+			const size_t index = pEntity->GetIndex();
+
+			if (includeDestroyed || !pEntity->IsDestroyPending())
+				fn(*pEntity, std::get<Epic::detail::EntityComponentPool<Components>*>(m_Pools)->Get(index)...);
+		}
+	}
+
+	// Retrieve a view of the matching entities whose Changed component was
+	// attached or modified after version 'since'.
+	template<class Changed>
+	ChangedView<Changed> ChangedSince(VersionType since) const noexcept
+	{
+		return { &m_Entities, std::get<Epic::detail::EntityComponentPool<Changed>*>(m_Pools), since };
+	}
+
+	// Stamp the Changed component of a matching Entity with the current version
+	template<class Changed>
+	inline void MarkChanged(const Epic::Entity& entity) noexcept
+	{
+		std::get<Epic::detail::EntityComponentPool<Changed>*>(m_Pools)->MarkChanged(entity.GetIndex());
+	}
+
+	// Calls 'fn(Entity&, Components&...)' for each matching Entity whose 
+	// Changed component was attached or modified after version 'since'.
+	template<class Changed, class Function>
+	void EachChanged(VersionType since, Function&& fn, bool includeDestroyed = false)
+	{
+		auto pChangedPool = std::get<Epic::detail::EntityComponentPool<Changed>*>(m_Pools);
+
+		if (!pChangedPool->ChangedSince(since))
+			return;
+
+		for (size_t i = 0; i < m_Entities.size(); ++i)
+		{
+			Epic::Entity* pEntity = m_Entities[i];
+			const size_t index = pEntity->GetIndex();
+
+			if (pChangedPool->GetVersion(index) > since && 
+				(includeDestroyed || !pEntity->IsDestroyPending()))
+				fn(*pEntity, std::get<Epic::detail::EntityComponentPool<Components>*>(m_Pools)->Get(index)...);
+		}
+	}
+};
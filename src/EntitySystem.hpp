@@ -26,25 +26,71 @@
 namespace Epic
 {
 	class EntitySystem;
+
+	struct EntitySystemAccess;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+// EntitySystemAccess
+//	Describes the components an EntitySystem reads and writes during Update().
+struct Epic::EntitySystemAccess
+{
+	const Epic::EntityComponentID* pReads;
+	size_t ReadCount;
+	const Epic::EntityComponentID* pWrites;
+	size_t WriteCount;
+
+	// Query whether or not two systems with these access sets may not run concurrently
+	bool ConflictsWith(const Epic::EntitySystemAccess& other) const noexcept
+	{
+		auto contains = [] (const Epic::EntityComponentID* pIDs, size_t count, Epic::EntityComponentID id)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (pIDs[i] == id)
+					return true;
+			}
+
+			return false;
+		};
+
+		for (size_t i = 0; i < WriteCount; ++i)
+		{
+			if (contains(other.pReads, other.ReadCount, pWrites[i]) ||
+				contains(other.pWrites, other.WriteCount, pWrites[i]))
+				return true;
+		}
+
+		for (size_t i = 0; i < other.WriteCount; ++i)
+		{
+			if (contains(pReads, ReadCount, other.pWrites[i]))
+				return true;
+		}
+
+		return false;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
 // EntitySystem
 class Epic::EntitySystem
 {
 public:
 	using Type = Epic::EntitySystem;
+	using VersionType = Epic::detail::EntityComponentStorage::VersionType;
 
 private:
 	friend class Epic::EntityManager;
 
 private:
 	Epic::EntityManager* m_pEntityManager;
+	VersionType m_LastRunVersion;		// The component version at which Update() last ran
 
 public:
 	EntitySystem(Epic::EntityManager* pEntityManager) noexcept 
-		: m_pEntityManager{ pEntityManager }
+		: m_pEntityManager{ pEntityManager }, m_LastRunVersion{ 0 }
 	{
 		assert(m_pEntityManager);
 	}
@@ -62,6 +108,14 @@ public:
 		return m_pEntityManager;
 	}
 
+	// Retrieve the component version at which this system's Update() last ran (0 if it has not run).
+	// Within Update(), components that changed since the previous run are those that are
+	// ChangedSince(GetLastRunVersion()).  This excludes the system's own changes from that run.
+	inline VersionType GetLastRunVersion() const noexcept
+	{
+		return m_LastRunVersion;
+	}
+
 private:
 	void OnEntityCreated(Epic::Entity* pEntity)
 	{ 
@@ -79,14 +133,67 @@ private:
 		EntityDestroyed(pEntity);
 	}
 
+	void OnEntitiesCreated(Epic::Entity* const* ppEntities, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			ppEntities[i]->ComponentAttached.Connect(this, &Type::EntityComponentAttached);
+			ppEntities[i]->ComponentDetached.Connect(this, &Type::EntityComponentDetached);
+		}
+
+		EntitiesCreated(ppEntities, count);
+	}
+
+	void OnEntitiesDestroyed(Epic::Entity* const* ppEntities, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			ppEntities[i]->ComponentAttached.DisconnectAll(this);
+			ppEntities[i]->ComponentDetached.DisconnectAll(this);
+		}
+
+		EntitiesDestroyed(ppEntities, count);
+	}
+
 public:
 	virtual void Update() = 0;
 
 protected:
 	virtual void InitialUpdate() { };
 
+	// Retrieve the components this system accesses during Update().
+	// Returns false if the system does not declare its access, in which case 
+	// it will never be run concurrently with another system.
+	virtual bool GetAccess(Epic::EntitySystemAccess&) const noexcept { return false; }
+
 	virtual void EntityCreated(Epic::Entity*) { }
 	virtual void EntityDestroyed(Epic::Entity*) { }
-	virtual void EntityComponentAttached(Epic::Entity* pEntity, Epic::EntityComponentID id) { }
-	virtual void EntityComponentDetached(Epic::Entity* pEntity, Epic::EntityComponentID id) { }
+	virtual void EntityComponentAttached(Epic::Entity*, Epic::EntityComponentID) { }
+	virtual void EntityComponentDetached(Epic::Entity*, Epic::EntityComponentID) { }
+
+	// Batched notifications raised when an EntityCommandBuffer is applied.
+	// By default, each forwards to the per-entity notification for every entity.
+	virtual void EntitiesCreated(Epic::Entity* const* ppEntities, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+			EntityCreated(ppEntities[i]);
+	}
+
+	virtual void EntitiesDestroyed(Epic::Entity* const* ppEntities, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+			EntityDestroyed(ppEntities[i]);
+	}
+
+	virtual void EntityComponentsAttached(Epic::EntityComponentID id, Epic::Entity* const* ppEntities, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+			EntityComponentAttached(ppEntities[i], id);
+	}
+
+	virtual void EntityComponentsDetached(Epic::EntityComponentID id, Epic::Entity* const* ppEntities, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+			EntityComponentDetached(ppEntities[i], id);
+	}
 };
@@ -13,13 +13,19 @@
 
 #pragma once
 
+#include <Epic/Delegate.hpp>
 #include <Epic/StringHash.hpp>
 #include <Epic/Memory/Default.hpp>
+#include <Epic/STL/Map.hpp>
+#include <Epic/STL/Set.hpp>
 #include <Epic/STL/Vector.hpp>
 #include <Epic/TMP/Sequence.hpp>
-#include <boost/preprocessor.hpp>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <tuple>
 
 //////////////////////////////////////////////////////////////////////////////
@@ -32,6 +38,15 @@ namespace Epic
 		class EventBase;
 	}
 
+	enum class eEventPriority : int32_t
+	{
+		Lowest = -2000,
+		Low = -1000,
+		Normal = 0,
+		High = 1000,
+		Highest = 2000
+	};
+
 	template<typename Signature>
 	class Event;
 
@@ -41,41 +56,18 @@ namespace Epic
 
 //////////////////////////////////////////////////////////////////////////////
 
-// The following macros are used with the boost preprocessor library to allow for automatic parameter 
-// binding when binding member function pointers to events.  Set BMFP_COUNT to a number that is 
-// less-than or equal to the number of std::placeholders defined for your system.
-
-#define BMFP_COUNT 20
-#define BMFP_PH_DECL(z, n, text) BOOST_PP_COMMA() BOOST_PP_CAT(std::placeholders::_, BOOST_PP_ADD(n, 1))
-#define BMFP_N_DECL(z, n, text)																	\
-	template<class T, class This>																\
-	struct BMFP< ## n ##, T, This>																\
-	{																							\
-		static inline DelegateType Bind(const This* pThis, R(T::* fn)(Args...) const) noexcept	\
-		{  return std::bind(fn, pThis BOOST_PP_REPEAT(n, BMFP_PH_DECL, ~));	 }					\
-		static inline DelegateType Bind(This* pThis, R(T::* fn)(Args...)) noexcept				\
-		{  return std::bind(fn, pThis BOOST_PP_REPEAT(n, BMFP_PH_DECL, ~));	 }					\
-	};
-
-//////////////////////////////////////////////////////////////////////////////
-
 // EventBase
 template<class R, class... Args>
 class Epic::detail::EventBase
 {
 public:
 	using Type = Epic::detail::EventBase<R, Args...>;
-	using DelegateType = std::function<R(Args...)>;
+	using DelegateType = Epic::Delegate<R(Args...)>;
 
 protected:
-	struct EventHandler
-	{
-		using HandleType = uint32_t;
-		using InstanceType = intptr_t;
-
-		HandleType handle;
-		InstanceType instance;
-	};
+	using HandleType = uint32_t;
+	using InstanceType = typename DelegateType::InstanceType;
+	using SequenceType = uint64_t;
 
 	struct MutateQueueEntry
 	{
@@ -89,43 +81,84 @@ protected:
 		};
 
 		MutateQueueEntry(eMutateCommand cmd)
-			: command{ cmd }, handler{ 0, 0 }, delegate{} 
+			: delegate{}, handle{ 0 }, instance{ 0 }, priority{ Epic::eEventPriority::Normal }, command{ cmd }
 		{ }
 
-		MutateQueueEntry(eMutateCommand cmd, const EventHandler& hand, const DelegateType fn)
-			: command{ cmd }, handler{ hand }, delegate{ fn } 
+		MutateQueueEntry(eMutateCommand cmd, const DelegateType& fn, HandleType hand, InstanceType inst, 
+						 Epic::eEventPriority prio = Epic::eEventPriority::Normal)
+			: delegate{ fn }, handle{ hand }, instance{ inst }, priority{ prio }, command{ cmd }
 		{ }
 
 		DelegateType delegate;
-		EventHandler handler;
+		HandleType handle;
+		InstanceType instance;
+		Epic::eEventPriority priority;
 		eMutateCommand command;
 	};
 
+	// Identifies a listener's position in the (sorted) listener list
+	struct ListenerKey
+	{
+		Epic::eEventPriority priority;
+		SequenceType sequence;
+
+		// Listeners are ordered by descending priority, then by order of subscription
+		inline bool operator < (const ListenerKey& other) const noexcept
+		{
+			return (priority != other.priority) ? (priority > other.priority) : (sequence < other.sequence);
+		}
+	};
+
+	// The listener's instance is identified by its delegate (see Delegate::GetInstance()).
+	// Removed listeners are left in place with a null delegate until the list is compacted.
+	struct Listener
+	{
+		DelegateType delegate;
+		HandleType handle;
+		ListenerKey key;
+	};
+
 protected:
-	using Listener = std::pair<EventHandler, DelegateType>;
 	using ListenerList = Epic::STLVector<Listener>;
+	using InstanceIndex = Epic::STLMap<std::pair<InstanceType, HandleType>, ListenerKey>;
+	using HandleIndex = Epic::STLSet<std::pair<HandleType, InstanceType>>;
 	using MutateQueue = Epic::SmallVector<MutateQueueEntry, 2>;
 
 protected:
-	ListenerList m_Listeners;
+	ListenerList m_Listeners;			// Listeners (including removed listeners) in dispatch order
+	InstanceIndex m_InstanceIndex;		// Maps (instance, handle) to listener keys (anonymous listeners are not indexed)
+	HandleIndex m_HandleIndex;			// The (handle, instance) pairs of every indexed listener
 	MutateQueue m_MutateQueue;
-	bool m_IsSuspended;
+	SequenceType m_NextSequence;
+	size_t m_RemovedCount;				// The number of removed listeners awaiting compaction
+	size_t m_SuspendDepth;
+	bool m_IsSorted;
 
 public:
 	inline EventBase() noexcept
-		: m_IsSuspended(false)
+		: m_NextSequence(0), m_RemovedCount(0), m_SuspendDepth(0), m_IsSorted(true)
 	{ }
 
 	inline EventBase(Type& other) noexcept
-		: m_IsSuspended(false),
-		  m_Listeners(other.m_Listeners),
-		  m_MutateQueue(other.m_MutateQueue)
+		: m_Listeners(other.m_Listeners),
+		  m_InstanceIndex(other.m_InstanceIndex),
+		  m_HandleIndex(other.m_HandleIndex),
+		  m_MutateQueue(other.m_MutateQueue),
+		  m_NextSequence(other.m_NextSequence),
+		  m_RemovedCount(other.m_RemovedCount),
+		  m_SuspendDepth(0),
+		  m_IsSorted(other.m_IsSorted)
 	{ }
 
 	inline EventBase(Type&& other) noexcept
-		: m_IsSuspended(std::move(other.m_IsSuspended)),
-		  m_Listeners(std::move(other.m_Listeners)),
-		  m_MutateQueue(std::move(other.m_MutateQueue))
+		: m_Listeners(std::move(other.m_Listeners)),
+		  m_InstanceIndex(std::move(other.m_InstanceIndex)),
+		  m_HandleIndex(std::move(other.m_HandleIndex)),
+		  m_MutateQueue(std::move(other.m_MutateQueue)),
+		  m_NextSequence(other.m_NextSequence),
+		  m_RemovedCount(other.m_RemovedCount),
+		  m_SuspendDepth(other.m_SuspendDepth),
+		  m_IsSorted(other.m_IsSorted)
 	{ }
 
 public:
@@ -135,116 +168,143 @@ public:
 public:
 	explicit inline operator bool() const noexcept
 	{
-		return !m_Listeners.empty();
+		return GetListenerCount() > 0;
 	}
 
 protected:
-	// Subscribe listener without instance or handle
+	// Subscribe listener without handle
 	// If the listener list is currently being processed, the subscription will be queued
 	// and processed during the next Flush operation
-	inline void Subscribe(const DelegateType& delegate) noexcept
+	inline void Subscribe(const DelegateType& delegate, 
+						  const Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(delegate, 0, 0);
+		Subscribe(delegate, 0, priority);
 	}
 
-	// Subscribe listener with instance (null handle)
-	inline void Subscribe(const DelegateType& delegate, const typename EventHandler::InstanceType instance) noexcept
+	// Subscribe listener with handle
+	// The listener's instance is taken from the delegate
+	void Subscribe(const DelegateType& delegate, const HandleType handle, 
+				   const Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(delegate, instance, 0);
-	}
+		if (m_SuspendDepth == 0)
+		{
+			const auto instance = delegate.GetInstance();
+			const ListenerKey key{ priority, m_NextSequence };
 
-	// Subscribe listener with handle (null instance)
-	inline void Subscribe(const DelegateType& delegate, const typename EventHandler::HandleType handle) noexcept
-	{
-		Subscribe(delegate, 0, handle);
-	}
+			if (instance != 0 || handle != 0)
+			{
+				if (!m_InstanceIndex.emplace(std::make_pair(instance, handle), key).second)
+					return;
 
-	// Subscribe listener with instance and handle
-	void Subscribe(const DelegateType& delegate, 
-				   const typename EventHandler::InstanceType instance, 
-				   const typename EventHandler::HandleType handle) noexcept
-	{
-		if (!m_IsSuspended)
-		{
-			if ((instance == 0 && handle == 0) || !HasInstanceAndHandle(instance, handle))
-				m_Listeners.emplace_back(EventHandler{ handle, instance }, delegate);
+				m_HandleIndex.emplace(handle, instance);
+			}
+
+			// Appending keeps the list sorted unless this listener outranks the last one
+			if (!m_Listeners.empty() && key < m_Listeners.back().key)
+				m_IsSorted = false;
+
+			m_Listeners.push_back(Listener{ delegate, handle, key });
+			++m_NextSequence;
 		}
 		else
 		{
-			m_MutateQueue.emplace_back(MutateQueueEntry::Subscribe, EventHandler{ handle, instance }, delegate);
+			m_MutateQueue.emplace_back(MutateQueueEntry::Subscribe, delegate, handle, 0, priority);
 		}
 	}
 
 	// Unsubscribe listener with instance (null handle)
-	inline void Unsubscribe(const typename EventHandler::InstanceType instance) noexcept
+	inline void Unsubscribe(const InstanceType instance) noexcept
 	{
 		Unsubscribe(instance, 0);
 	}
 
 	// Unsubscribe all listeners with handle
-	void Unsubscribe(const typename EventHandler::HandleType handle) noexcept
+	void Unsubscribe(const HandleType handle) noexcept
 	{
-		if (!m_IsSuspended)
+		if (m_SuspendDepth == 0)
 		{
 			// Multiple listeners can match this handle; unsubscribe all of them.
-			m_Listeners.erase(std::remove_if(
-				std::begin(m_Listeners),
-				std::end(m_Listeners),
-				[&](const auto& o) { return o.first.handle == handle; }
-			), std::end(m_Listeners));
+			auto it = m_HandleIndex.lower_bound(std::make_pair(handle, std::numeric_limits<InstanceType>::min()));
+
+			while (it != std::end(m_HandleIndex) && it->first == handle)
+			{
+				auto itInstance = m_InstanceIndex.find(std::make_pair(it->second, handle));
+
+				RemoveListener(itInstance->second);
+				m_InstanceIndex.erase(itInstance);
+				it = m_HandleIndex.erase(it);
+			}
+
+			// Anonymous listeners also have a null handle
+			if (handle == 0)
+				RemoveAnonymousListeners();
 		}
 		else
 		{
 			// Queue the unsubscription
-			m_MutateQueue.emplace_back(MutateQueueEntry::UnsubscribeHandle, EventHandler{ handle, 0 }, DelegateType());
+			m_MutateQueue.emplace_back(MutateQueueEntry::UnsubscribeHandle, DelegateType(), handle, 0);
 		}
 	}
 
 	// Unsubscribe one listener with instance and handle
-	void Unsubscribe(const typename EventHandler::InstanceType instance, const typename EventHandler::HandleType handle) noexcept
+	void Unsubscribe(const InstanceType instance, const HandleType handle) noexcept
 	{
-		if (!m_IsSuspended)
+		if (m_SuspendDepth == 0)
 		{
 			// There can only be one listener that has both this instance and this handle
-			auto it = std::find_if(std::begin(m_Listeners), std::end(m_Listeners),
-				[&](const auto& o) { return o.first.instance == instance && o.first.handle == handle; });
+			auto it = m_InstanceIndex.find(std::make_pair(instance, handle));
 
-			if (it != std::end(m_Listeners))
-				m_Listeners.erase(it);
+			if (it != std::end(m_InstanceIndex))
+			{
+				RemoveListener(it->second);
+				m_HandleIndex.erase(std::make_pair(handle, instance));
+				m_InstanceIndex.erase(it);
+			}
 		}
 		else
 		{
 			// Queue the unsubscription
-			m_MutateQueue.emplace_back(MutateQueueEntry::Unsubscribe, EventHandler{ handle, instance }, DelegateType());
+			m_MutateQueue.emplace_back(MutateQueueEntry::Unsubscribe, DelegateType(), handle, instance);
 		}
 	}
 
 	// Unsubscribe all listeners with instance
-	void UnsubscribeAll(const typename EventHandler::InstanceType instance) noexcept
+	void UnsubscribeAll(const InstanceType instance) noexcept
 	{
-		if (!m_IsSuspended)
+		if (m_SuspendDepth == 0)
 		{
 			// Unsubscribe all listeners that match this instance
-			m_Listeners.erase(std::remove_if(
-				std::begin(m_Listeners),
-				std::end(m_Listeners),
-				[&](const auto& o) { return o.first.instance == instance; }
-			), std::end(m_Listeners));
+			auto it = m_InstanceIndex.lower_bound(std::make_pair(instance, HandleType(0)));
+
+			while (it != std::end(m_InstanceIndex) && it->first.first == instance)
+			{
+				RemoveListener(it->second);
+				m_HandleIndex.erase(std::make_pair(it->first.second, instance));
+				it = m_InstanceIndex.erase(it);
+			}
+
+			// Anonymous listeners also have a null instance
+			if (instance == 0)
+				RemoveAnonymousListeners();
 		}
 		else
 		{
 			// Queue the unsubscription
-			m_MutateQueue.emplace_back(MutateQueueEntry::UnsubscribeInstance, EventHandler{ 0, instance }, DelegateType());
+			m_MutateQueue.emplace_back(MutateQueueEntry::UnsubscribeInstance, DelegateType(), 0, instance);
 		}
 	}
 
 	// Unsubscribe all listeners
 	void UnsubscribeAll() noexcept
 	{
-		if (!m_IsSuspended)
+		if (m_SuspendDepth == 0)
 		{
 			// Unsubscribe every listener
 			m_Listeners.clear();
+			m_InstanceIndex.clear();
+			m_HandleIndex.clear();
+			m_RemovedCount = 0;
+			m_IsSorted = true;
 		}
 		else
 		{
@@ -253,52 +313,115 @@ protected:
 		}
 	}
 
-	// Iterate through listeners to determine if one can be found with the provided instance and handle
-	inline bool HasInstanceAndHandle(const typename EventHandler::InstanceType instance, const typename EventHandler::HandleType handle) noexcept
+	// Determine if a listener can be found with the provided instance and handle
+	inline bool HasInstanceAndHandle(const InstanceType instance, const HandleType handle) const noexcept
 	{
-		return std::find_if(std::begin(m_Listeners), std::end(m_Listeners),
-			[&](const auto& o)
+		return m_InstanceIndex.find(std::make_pair(instance, handle)) != std::end(m_InstanceIndex);
+	}
+
+private:
+	// Null the delegate of the listener identified by key.
+	// The listener is erased when the list is next compacted.
+	void RemoveListener(const ListenerKey& key) noexcept
+	{
+		if (!m_IsSorted)
+			Compact();
+
+		auto it = std::lower_bound(std::begin(m_Listeners), std::end(m_Listeners), key,
+			[](const Listener& listener, const ListenerKey& k) { return listener.key < k; });
+
+		assert(it != std::end(m_Listeners) && it->key.sequence == key.sequence);
+
+		it->delegate = nullptr;
+		++m_RemovedCount;
+
+		// Don't let removed listeners dominate the list
+		if (m_RemovedCount > m_Listeners.size() / 2)
+			Compact();
+	}
+
+	// Remove all listeners that have neither an instance nor a handle
+	void RemoveAnonymousListeners() noexcept
+	{
+		for (auto& listener : m_Listeners)
+		{
+			if (listener.delegate && listener.handle == 0 && listener.delegate.GetInstance() == 0)
 			{
-				return o.first.instance == instance && o.first.handle == handle;
-			}) != std::end(m_Listeners);
+				listener.delegate = nullptr;
+				++m_RemovedCount;
+			}
+		}
 	}
 
-	// Suspend or resume subscribing/unsubscribing new listeners freely
+	// Erase removed listeners and restore dispatch order.
+	// NOTE: This must not be called while the listener list is being processed.
+	void Compact() noexcept
+	{
+		if (m_RemovedCount > 0)
+		{
+			m_Listeners.erase(std::remove_if(
+				std::begin(m_Listeners),
+				std::end(m_Listeners),
+				[](const Listener& listener) { return !listener.delegate; }
+			), std::end(m_Listeners));
+
+			m_RemovedCount = 0;
+		}
+
+		if (!m_IsSorted)
+		{
+			std::stable_sort(std::begin(m_Listeners), std::end(m_Listeners),
+				[](const Listener& a, const Listener& b) { return a.key < b.key; });
+
+			m_IsSorted = true;
+		}
+	}
+
+protected:
+	// Suspend subscribing/unsubscribing new listeners freely.
+	// Suspensions nest; each must be paired with a call to Flush().
 	inline void Suspend(bool shouldSuspend) noexcept
 	{
-		m_IsSuspended = shouldSuspend;
+		if (shouldSuspend)
+		{
+			// Prepare the listener list for processing
+			if (m_SuspendDepth++ == 0)
+				Compact();
+		}
+		else if (m_SuspendDepth > 0)
+			--m_SuspendDepth;
 	}
 
-	// Process mutate queue
+	// Resume subscribing/unsubscribing and process the mutate queue
 	void Flush() noexcept
 	{
 		Suspend(false);
 
-		while (!m_MutateQueue.empty())
-		{
-			// Get the next queue item
-			auto entry = std::move(m_MutateQueue.back());
-			m_MutateQueue.pop_back();
+		if (m_SuspendDepth > 0)
+			return;
 
+		// Process the queue in order (the queue cannot grow while unsuspended)
+		for (auto& entry : m_MutateQueue)
+		{
 			switch (entry.command)
 			{
 			default:
 				break;
 
 			case MutateQueueEntry::Subscribe:
-				Subscribe(entry.delegate, entry.handler.instance, entry.handler.handle);
+				Subscribe(entry.delegate, entry.handle, entry.priority);
 				break;
 
 			case MutateQueueEntry::Unsubscribe:
-				Unsubscribe(entry.handler.instance, entry.handler.handle);
+				Unsubscribe(entry.instance, entry.handle);
 				break;
 
 			case MutateQueueEntry::UnsubscribeHandle:
-				Unsubscribe(entry.handler.handle);
+				Unsubscribe(entry.handle);
 				break;
 
 			case MutateQueueEntry::UnsubscribeInstance:
-				UnsubscribeAll(entry.handler.instance);
+				UnsubscribeAll(entry.instance);
 				break;
 
 			case MutateQueueEntry::UnsubscribeAll:
@@ -306,141 +429,164 @@ protected:
 				break;
 			}
 		}
+
+		m_MutateQueue.clear();
 	}
 
 public:
 	// Returns the number of listeners subscribed to this event
-	inline auto GetListenerCount() const noexcept
+	inline size_t GetListenerCount() const noexcept
 	{
-		return std::size(m_Listeners);
+		return std::size(m_Listeners) - m_RemovedCount;
 	}
 
 public:
+	// Listeners with a higher priority are invoked first.  Listeners with equal
+	// priority are invoked in the order they were connected.
+
 	// Connect a function handler
-	inline void Connect(const DelegateType& delegate) noexcept
+	inline void Connect(const DelegateType& delegate,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(delegate);
+		Subscribe(delegate, priority);
 	}
 
 	// Connect a function handler with a handle
-	inline void Connect(const DelegateType& delegate, Epic::StringHash handle) noexcept
+	inline void Connect(const DelegateType& delegate, Epic::StringHash handle,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(delegate, typename EventHandler::HandleType(handle));
+		Subscribe(delegate, HandleType(handle), priority);
 	}
 
 	// Connect a function object handler
 	template<class Function>
-	inline void Connect(const Function& fn) noexcept
+	inline void Connect(const Function& fn,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(DelegateType(fn));
+		Subscribe(DelegateType(fn), priority);
 	}
 
 	// Connect a function object handler with a handle
 	template<class Function>
-	inline void Connect(const Function& fn, Epic::StringHash handle) noexcept
+	inline void Connect(const Function& fn, Epic::StringHash handle,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(DelegateType(fn), typename EventHandler::HandleType(handle));
+		Subscribe(DelegateType(fn), HandleType(handle), priority);
 	}
 
 	// Connect a static function pointer handler
-	inline void Connect(R(*fn)(Args...)) noexcept
+	inline void Connect(R(*fn)(Args...),
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(DelegateType(fn), reinterpret_cast<EventHandler::InstanceType>(fn));
+		Subscribe(DelegateType(fn), priority);
 	}
 
 	// Connect a static function pointer handler with a handle
-	inline void Connect(R(*fn)(Args...), Epic::StringHash handle) noexcept
+	inline void Connect(R(*fn)(Args...), Epic::StringHash handle,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(DelegateType(fn), 
-				  reinterpret_cast<EventHandler::InstanceType>(fn), 
-				  typename EventHandler::HandleType(handle));
+		Subscribe(DelegateType(fn), HandleType(handle), priority);
 	}
 
 	// Connect a member function pointer handler
 	template<class T, class This>
-	inline void Connect(This* pThis, R(T::* fn)(Args...)) noexcept
+	inline void Connect(This* pThis, R(T::* fn)(Args...),
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(BMFP<sizeof...(Args), T, This>::Bind(pThis, fn),
-				  reinterpret_cast<EventHandler::InstanceType>(pThis));
+		Subscribe(DelegateType(pThis, fn), priority);
 	}
 
 	// Connect a const member function pointer handler
 	template<class T, class This>
-	inline void Connect(const This* pThis, R(T::* fn)(Args...) const) noexcept
+	inline void Connect(const This* pThis, R(T::* fn)(Args...) const,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(BMFP<sizeof...(Args), T, This>::Bind(pThis, fn),
-				  reinterpret_cast<EventHandler::InstanceType>(pThis));
+		Subscribe(DelegateType(pThis, fn), priority);
 	}
 
 	// Connect a member function pointer handler with a handle
 	template<class T, class This>
-	inline void Connect(This* pThis, R(T::* fn)(Args...), Epic::StringHash handle) noexcept
+	inline void Connect(This* pThis, R(T::* fn)(Args...), Epic::StringHash handle,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(BMFP<sizeof...(Args), T, This>::Bind(pThis, fn),
-				  reinterpret_cast<EventHandler::InstanceType>(pThis),
-				  typename EventHandler::HandleType>(handle));
+		Subscribe(DelegateType(pThis, fn), HandleType(handle), priority);
 	}
 
 	// Connect a const member function pointer handler with a handle
 	template<class T, class This>
-	inline void Connect(const This* pThis, R(T::* fn)(Args...) const, Epic::StringHash handle) noexcept
+	inline void Connect(const This* pThis, R(T::* fn)(Args...) const, Epic::StringHash handle,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
+	{
+		Subscribe(DelegateType(pThis, fn), HandleType(handle), priority);
+	}
+
+	// Connect a member function handler that is bound at compile-time
+	template<auto Method, class This>
+	inline void Connect(This* pThis,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Subscribe(BMFP<sizeof...(Args), T, This>::Bind(pThis, fn),
-				  reinterpret_cast<EventHandler::InstanceType>(pThis),
-				  typename EventHandler::HandleType>(handle));
+		Subscribe(DelegateType::template Bind<Method>(pThis), priority);
+	}
+
+	// Connect a member function handler that is bound at compile-time with a handle
+	template<auto Method, class This>
+	inline void Connect(This* pThis, Epic::StringHash handle,
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
+	{
+		Subscribe(DelegateType::template Bind<Method>(pThis), HandleType(handle), priority);
 	}
 
 	// Disconnect all handlers with the supplied handle
 	template<size_t N>
 	inline void Disconnect(const char(&cstr)[N]) noexcept
 	{
-		Unsubscribe(typename EventHandler::HandleType(Epic::Hash(cstr)));
+		Unsubscribe(HandleType(Epic::Hash(cstr)));
 	}
 
 	// Disconnect all handlers with the supplied handle
 	inline void Disconnect(Epic::StringHash handle) noexcept
 	{
-		Unsubscribe(typename EventHandler::HandleType(handle));
+		Unsubscribe(HandleType(handle));
 	}
 
 	// Disconnect a static function pointer handler (this will NOT disconnect listeners that provided a handle)
 	inline void Disconnect(R(*fn)(Args...)) noexcept
 	{
-		Unsubscribe(reinterpret_cast<EventHandler::InstanceType>(fn));
+		Unsubscribe(reinterpret_cast<InstanceType>(fn));
 	}
 
 	// Disconnect a static function pointer handler with a handle
 	inline void Disconnect(R(*fn)(Args...), Epic::StringHash handle) noexcept
 	{
-		Unsubscribe(reinterpret_cast<EventHandler::InstanceType>(fn), typename EventHandler::HandleType(handle));
+		Unsubscribe(reinterpret_cast<InstanceType>(fn), HandleType(handle));
 	}
 
 	// Disconnect a member function pointer handler (this will NOT disconnect listeners that provided a handle)
 	template<class This>
 	inline void Disconnect(const This* pThis) noexcept
 	{
-		Unsubscribe(reinterpret_cast<EventHandler::InstanceType>(pThis));
+		Unsubscribe(reinterpret_cast<InstanceType>(pThis));
 	}
 
 	// Disconnect a member function pointer handler with a handle
 	template<class This>
 	inline void Disconnect(const This* pThis, Epic::StringHash handle) noexcept
 	{
-		Unsubscribe(reinterpret_cast<EventHandler::InstanceType>(pThis),
-					typename EventHandler::HandleType(handle));
+		Unsubscribe(reinterpret_cast<InstanceType>(pThis),
+					HandleType(handle));
 	}
 
 	// Disconnect all static function pointer handlers with this address (even listeners that provided a handle)
 	inline void DisconnectAll(R(*fn)(Args...)) noexcept
 	{
-		UnsubscribeAll(reinterpret_cast<EventHandler::InstanceType>(fn));
+		UnsubscribeAll(reinterpret_cast<InstanceType>(fn));
 	}
 
 	// Disconnect all member function pointer handlers with this instance address (even listeners that provided a handle)
 	template<class This>
 	inline void DisconnectAll(const This* pThis) noexcept
 	{
-		UnsubscribeAll(reinterpret_cast<EventHandler::InstanceType>(pThis));
+		UnsubscribeAll(reinterpret_cast<InstanceType>(pThis));
 	}
 
 	// Disconnect all listeners
@@ -476,7 +622,7 @@ public:
 	template<size_t N>
 	inline Type& operator -= (const char(&cstr)[N]) noexcept
 	{
-		Disconnect(typename EventHandler::HandleType(Epic::Hash(cstr)));
+		Disconnect(HandleType(Epic::Hash(cstr)));
 		return *this;
 	}
 
@@ -501,23 +647,6 @@ public:
 		Disconnect(pThis);
 		return *this;
 	}
-
-private:
-	template<size_t argc, class T, class This>
-	struct BMFP
-	{
-		static inline DelegateType Bind(const This* /* pThis */, R(T::* /* fn */)(Args...) const) noexcept
-		{
-			static_assert(false, "Unable to bind member function pointer!  Are you trying to bind more than BMFP_COUNT parameters?");
-		}
-
-		static inline DelegateType Bind(This* /* pThis */, R(T::* /* fn */)(Args...)) noexcept
-		{
-			static_assert(false, "Unable to bind member function pointer!  Are you trying to bind more than BMFP_COUNT parameters?");
-		}
-	};
-
-	BOOST_PP_REPEAT(BMFP_COUNT, BMFP_N_DECL, ~);
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -562,7 +691,9 @@ protected:
 	using InvocationQueue = Epic::STLVector<Invocation>;
 
 private:
-	InvocationQueue m_Invocations;
+	InvocationQueue m_Invocations;		// Invocations awaiting the next poll
+	InvocationQueue m_Dispatching;		// Invocations being (or waiting to be) dispatched
+	size_t m_DispatchIndex = 0;			// The next invocation in m_Dispatching to be dispatched
 
 public:
 	// Buffer an invocation of the event
@@ -581,8 +712,8 @@ private:
 	template<size_t... Is>
 	void DoInvoke(Invocation& invocation, std::integer_sequence<size_t, Is...>)
 	{
-		for (auto& listener : m_Listeners)
-			listener.second(std::get<Is>(invocation)...);
+		for (auto& listener : this->m_Listeners)
+			listener.delegate(std::get<Is>(invocation)...);
 	}
 
 	template<class Return>
@@ -592,14 +723,83 @@ private:
 		return Return();
 	}
 
-public:
-	// Invoke all pending event invocations
-	void Poll()
+	// Dispatch at most maxCount of the invocations that were pending when this was called.
+	// Invocations buffered by listeners during dispatch are left for the next poll.
+	template<class Predicate>
+	size_t DoPoll(size_t maxCount, Predicate shouldStop)
 	{
 		ScopeSuspend<Type> _suspend(*this);
 
-		for(auto& argPack : m_Invocations)
-			DoInvoke(argPack, Epic::TMP::MakeSequence<size_t, sizeof...(Args)>());
+		const size_t pending = (m_Dispatching.size() - m_DispatchIndex) + m_Invocations.size();
+		const size_t limit = (maxCount < pending) ? maxCount : pending;
+		size_t count = 0;
+
+		while (count < limit)
+		{
+			if (m_DispatchIndex == m_Dispatching.size())
+			{
+				// Swap the buffers (both retain their capacity)
+				m_Dispatching.clear();
+				m_DispatchIndex = 0;
+				std::swap(m_Dispatching, m_Invocations);
+			}
+
+			// Listeners may buffer new invocations, but those go to m_Invocations, 
+			// so this reference remains valid
+			auto& invocation = m_Dispatching[m_DispatchIndex++];
+			++count;
+
+			DoInvoke(invocation, Epic::TMP::MakeSequence<size_t, sizeof...(Args)>());
+
+			if (shouldStop())
+				break;
+		}
+
+		// Release the dispatched arguments early
+		if (m_DispatchIndex == m_Dispatching.size())
+		{
+			m_Dispatching.clear();
+			m_DispatchIndex = 0;
+		}
+
+		return count;
+	}
+
+public:
+	// Retrieve the number of buffered invocations awaiting dispatch
+	inline size_t GetPendingCount() const noexcept
+	{
+		return (m_Dispatching.size() - m_DispatchIndex) + m_Invocations.size();
+	}
+
+	// Invoke all pending event invocations.
+	// Invocations buffered during the poll are dispatched by the next poll.
+	// Returns the number of invocations dispatched.
+	inline size_t Poll()
+	{
+		return DoPoll(std::numeric_limits<size_t>::max(), [] { return false; });
+	}
+
+	// Invoke at most maxCount pending event invocations.
+	// Undispatched invocations are dispatched (in order) by the next poll.
+	// Returns the number of invocations dispatched.
+	inline size_t PollFor(size_t maxCount)
+	{
+		return DoPoll(maxCount, [] { return false; });
+	}
+
+	// Invoke pending event invocations until budget has elapsed.
+	// At least one pending invocation is dispatched per call.
+	// Undispatched invocations are dispatched (in order) by the next poll.
+	// Returns the number of invocations dispatched.
+	template<class Rep, class Period>
+	size_t PollFor(const std::chrono::duration<Rep, Period>& budget)
+	{
+		using ClockType = std::chrono::steady_clock;
+
+		const auto deadline = ClockType::now() + std::chrono::duration_cast<ClockType::duration>(budget);
+
+		return DoPoll(std::numeric_limits<size_t>::max(), [&] { return ClockType::now() >= deadline; });
 	}
 };
 
@@ -642,30 +842,34 @@ public:
 
 	// Connect an event as a handler to this event
 	template<class Return>
-	inline void Connect(Event<Return(Args...)>& event) noexcept
+	inline void Connect(Event<Return(Args...)>& event, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Base::Connect(&event, &Event<Return(Args...)>::ForwardedInvoke<R>);
+		Base::Connect(&event, &Event<Return(Args...)>::template ForwardedInvoke<R>, priority);
 	}
 
 	// Connect an event as a handler to this event with a handle
 	template<class Return>
-	inline void Connect(Event<Return(Args...)>& event, Epic::StringHash handle) noexcept
+	inline void Connect(Event<Return(Args...)>& event, Epic::StringHash handle, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Base::Connect(&event, &Event<Return(Args...)>::ForwardedInvoke<R>, handle);
+		Base::Connect(&event, &Event<Return(Args...)>::template ForwardedInvoke<R>, handle, priority);
 	}
 
 	// Connect a polled event as a handler to this event
 	template<class Return>
-	inline void Connect(PolledEvent<Return(Args...)>& event) noexcept
+	inline void Connect(PolledEvent<Return(Args...)>& event, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Base::Connect(&event, &PolledEvent<Return(Args...)>::ForwardedInvoke<R>);
+		Base::Connect(&event, &PolledEvent<Return(Args...)>::template ForwardedInvoke<R>, priority);
 	}
 	
 	// Connect a polled event as a handler to this event with a handle
 	template<class Return>
-	inline void Connect(PolledEvent<Return(Args...)>& event, Epic::StringHash handle) noexcept
+	inline void Connect(PolledEvent<Return(Args...)>& event, Epic::StringHash handle, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal) noexcept
 	{
-		Base::Connect(&event, &PolledEvent<Return(Args...)>::ForwardedInvoke<R>, handle);
+		Base::Connect(&event, &PolledEvent<Return(Args...)>::template ForwardedInvoke<R>, handle, priority);
 	}
 
 	// Import base Disconnect overloads
@@ -742,8 +946,8 @@ public:
 	{
 		ScopeSuspend<Type> _suspend(*this);
 		
-		for (auto& listener : m_Listeners)
-			listener.second(std::forward<Args>(args)...);
+		for (auto& listener : this->m_Listeners)
+			listener.delegate(std::forward<Args>(args)...);
 	}
 
 	// Invoke the event (handler return values are ignored)
@@ -759,8 +963,8 @@ public:
 		ScopeSuspend<Type> _suspend(*this);
 		Accumulator accum;
 
-		for (auto& listener : m_Listeners)
-			accum.emplace_back(listener.second(std::forward<Args>(args)...));
+		for (auto& listener : this->m_Listeners)
+			accum.emplace_back(listener.delegate(std::forward<Args>(args)...));
 
 		return accum;
 	}
@@ -771,8 +975,8 @@ public:
 	{
 		ScopeSuspend<Type> _suspend(*this);
 
-		for (auto& listener : m_Listeners)
-			*dest++ = listener.second(std::forward<Args>(args)...);
+		for (auto& listener : this->m_Listeners)
+			*dest++ = listener.delegate(std::forward<Args>(args)...);
 	}
 
 	// Listeners will be invoked and their return value fed to the predicate.
@@ -783,9 +987,9 @@ public:
 	{
 		ScopeSuspend<Type> _suspend(*this);
 
-		for (auto& listener : m_Listeners)
+		for (auto& listener : this->m_Listeners)
 		{
-			if (predicate(listener.second(std::forward<Args>(args)...)))
+			if (predicate(listener.delegate(std::forward<Args>(args)...)))
 				return true;
 		}
 
@@ -794,14 +998,14 @@ public:
 
 	// Invoke the event until a listener returns the parameter value
 	// This function returns whether or not a delegate returned the parameter value
-	template<typename RV = std::enable_if_t<!std::is_void<R>::value, R>>
+	template<typename RV = R, typename = std::enable_if_t<!std::is_void<RV>::value>>
 	bool InvokeUntil(const RV& value, Args... args)
 	{
 		ScopeSuspend<Type> _suspend(*this);
 
-		for (auto& listener : m_Listeners)
+		for (auto& listener : this->m_Listeners)
 		{
-			if (value == listener.second(std::forward<Args>(args)...))
+			if (value == listener.delegate(std::forward<Args>(args)...))
 				return true;
 		}
 
@@ -816,9 +1020,9 @@ public:
 	{
 		ScopeSuspend<Type> _suspend(*this);
 
-		for (auto& listener : m_Listeners)
+		for (auto& listener : this->m_Listeners)
 		{
-			if (!predicate(listener.second(std::forward<Args>(args)...)))
+			if (!predicate(listener.delegate(std::forward<Args>(args)...)))
 				return false;
 		}
 
@@ -827,14 +1031,14 @@ public:
 
 	// Invoke the event while delegates return the parameter value
 	// This function returns true if all listeners returned 'value'
-	template<typename RV = std::enable_if_t<!std::is_void<R>::value, R>>
+	template<typename RV = R, typename = std::enable_if_t<!std::is_void<RV>::value>>
 	bool InvokeWhile(const RV& value, Args... args)
 	{
 		ScopeSuspend<Type> _suspend(*this);
 
-		for (auto& listener : m_Listeners)
+		for (auto& listener : this->m_Listeners)
 		{
-			if (value != listener.second(std::forward<Args>(args)...))
+			if (value != listener.delegate(std::forward<Args>(args)...))
 				return false;
 		}
 
@@ -849,10 +1053,3 @@ private:
 		return Return();
 	}
 };
-
-//////////////////////////////////////////////////////////////////////////////
-
-// Undefine the preprocessor macros (clean up)
-#undef BMFP_N_DECL
-#undef BMFP_PH_DECL
-#undef BMFP_COUNT
@@ -0,0 +1,400 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Event.hpp>
+#include <Epic/StringHash.hpp>
+#include <Epic/STL/UniquePtr.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	using EventID = Epic::StringHash::HashType;
+
+	template<class T>
+	struct EventTraits;
+
+	class EventBus;
+
+	namespace detail
+	{
+		class EventTypeIndexer;
+
+		class EventBusChannelBase;
+
+		template<class T>
+		class EventBusChannel;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// MakeEventID()
+namespace Epic::detail
+{
+	template<class E, size_t N>
+	constexpr EventID MakeEventID(const char(&cstr)[N])
+	{
+		return { Epic::Hash<N>(cstr).Value() };
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define MAKE_EVENT(type)	 \
+	template<>																	\
+	struct Epic::EventTraits<type>												\
+	{																			\
+		static constexpr auto ID = Epic::detail::MakeEventID<type>(#type);		\
+	};
+
+//////////////////////////////////////////////////////////////////////////////
+
+template<class T>
+struct Epic::EventTraits
+{
+	static_assert(!std::is_same<T, T>::value, 
+		"EventTraits<T> has not been defined."
+		"Use MAKE_EVENT(T) to define the traits for this event type.");
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EventTypeIndexer
+class Epic::detail::EventTypeIndexer
+{
+private:
+	static size_t NextIndex() noexcept
+	{
+		static std::atomic<size_t> s_NextIndex{ 0 };
+		return s_NextIndex++;
+	}
+
+public:
+	// Retrieve the dense, zero-based index assigned to event type T.
+	// Indices are handed out on first use and are stable for the life of the program.
+	template<class T>
+	static size_t Get() noexcept
+	{
+		static const size_t s_Index = NextIndex();
+		return s_Index;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EventBusChannelBase
+class Epic::detail::EventBusChannelBase
+{
+private:
+	Epic::EventID m_ID;
+	size_t m_TypeIndex;
+
+public:
+	EventBusChannelBase(Epic::EventID id, size_t typeIndex) noexcept
+		: m_ID{ id }, m_TypeIndex{ typeIndex }
+	{ }
+
+	EventBusChannelBase(const EventBusChannelBase&) = delete;
+	EventBusChannelBase& operator = (const EventBusChannelBase&) = delete;
+
+	virtual ~EventBusChannelBase() { }
+
+public:
+	inline Epic::EventID GetID() const noexcept
+	{
+		return m_ID;
+	}
+
+	// Retrieve the EventTypeIndexer index of this channel's record type
+	inline size_t GetTypeIndex() const noexcept
+	{
+		return m_TypeIndex;
+	}
+
+public:
+	// Retrieve the number of records awaiting dispatch
+	virtual size_t GetPendingCount() const noexcept = 0;
+
+	// Set aside the pending records for delivery by Deliver().
+	// Records posted after this are held for the following dispatch.
+	// Returns the number of records set aside.
+	virtual size_t Snapshot() = 0;
+
+	// Deliver the records set aside by Snapshot() to the listeners in a single batch
+	virtual void Deliver() = 0;
+
+	// Deliver all pending records to the listeners in a single batch.
+	// Returns the number of records dispatched.
+	size_t Dispatch()
+	{
+		const size_t count = Snapshot();
+
+		if (count > 0)
+			Deliver();
+
+		return count;
+	}
+
+	// Discard all pending records
+	virtual void Clear() noexcept = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EventBusChannel<T>
+template<class T>
+class Epic::detail::EventBusChannel : public Epic::detail::EventBusChannelBase
+{
+	static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+		"EventBus records must be trivially copyable and trivially destructible.");
+
+public:
+	using Type = Epic::detail::EventBusChannel<T>;
+	using Base = Epic::detail::EventBusChannelBase;
+	using RecordType = T;
+	using DispatchEvent = Epic::Event<void(const T*, size_t)>;
+
+private:
+	using RecordList = Epic::STLVector<T>;
+
+private:
+	RecordList m_Pending;			// Records awaiting the next dispatch
+	RecordList m_Dispatching;		// Records set aside for delivery
+
+public:
+	DispatchEvent Dispatched;		// Invoked with each batch of records
+
+public:
+	EventBusChannel() noexcept
+		: Base{ Epic::EventTraits<T>::ID, Epic::detail::EventTypeIndexer::Get<T>() }
+	{ }
+
+public:
+	inline void Post(const T& record)
+	{
+		m_Pending.emplace_back(record);
+	}
+
+	template<class... Args>
+	inline void Emplace(Args&&... args)
+	{
+		m_Pending.emplace_back(T{ std::forward<Args>(args)... });
+	}
+
+public:
+	size_t GetPendingCount() const noexcept override
+	{
+		return m_Pending.size();
+	}
+
+	size_t Snapshot() override
+	{
+		// Records posted by listeners during delivery go to m_Pending 
+		// and will be delivered by the next dispatch
+		if (m_Dispatching.empty())
+			std::swap(m_Pending, m_Dispatching);
+		else
+		{
+			m_Dispatching.insert(m_Dispatching.end(), m_Pending.begin(), m_Pending.end());
+			m_Pending.clear();
+		}
+
+		return m_Dispatching.size();
+	}
+
+	void Deliver() override
+	{
+		if (m_Dispatching.empty())
+			return;
+
+		Dispatched(m_Dispatching.data(), m_Dispatching.size());
+		m_Dispatching.clear();
+	}
+
+	void Clear() noexcept override
+	{
+		m_Pending.clear();
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EventBus
+//	Routes event records by type.  Producers post plain records to the bus and
+//	listeners subscribe once per event type.  Dispatch() delivers each type's 
+//	pending records to its listeners as one contiguous batch.
+//	Event types must be registered with MAKE_EVENT(T).
+//	NOTE: The bus is not thread-safe.  Use a ConcurrentPolledEvent to forward
+//	      records posted from other threads.
+class Epic::EventBus
+{
+public:
+	using Type = Epic::EventBus;
+
+	template<class T>
+	using ChannelType = Epic::detail::EventBusChannel<T>;
+
+	template<class T>
+	using DispatchEvent = typename ChannelType<T>::DispatchEvent;
+
+private:
+	using ChannelBase = Epic::detail::EventBusChannelBase;
+	using ChannelPtr = Epic::UniquePtr<ChannelBase>;
+	using ChannelList = Epic::STLVector<ChannelPtr>;
+	using ChannelIndex = Epic::STLVector<ChannelBase*>;
+
+private:
+	ChannelList m_Channels;		// Channels in order of creation
+	ChannelIndex m_Slots;		// Channels by EventTypeIndexer index (null if not yet created)
+	ChannelIndex m_Index;		// Channels sorted by EventID
+
+public:
+	EventBus() noexcept = default;
+
+	EventBus(const Type&) = delete;
+	Type& operator = (const Type&) = delete;
+
+private:
+	ChannelIndex::const_iterator FindInsertPos(Epic::EventID id) const noexcept
+	{
+		return std::lower_bound(std::begin(m_Index), std::end(m_Index), id, 
+			[] (const ChannelBase* pChannel, Epic::EventID id) { return pChannel->GetID() < id; });
+	}
+
+	template<class T>
+	ChannelType<T>& _CreateChannel(size_t slot)
+	{
+		const Epic::EventID id = Epic::EventTraits<T>::ID;
+		auto it = FindInsertPos(id);
+
+		// An existing channel with this ID belongs to another event type whose name hashes to the same ID
+		assert((it == std::end(m_Index) || (*it)->GetID() != id || (*it)->GetTypeIndex() == slot) && 
+			"EventBus::GetChannel() - Two event types share an EventID");
+
+		auto pChannel = Epic::MakeImpl<ChannelBase, ChannelType<T>>();
+		auto pResult = static_cast<ChannelType<T>*>(pChannel.get());
+
+		if (slot >= m_Slots.size())
+			m_Slots.resize(slot + 1, nullptr);
+
+		m_Slots[slot] = pResult;
+		m_Index.insert(m_Index.begin() + std::distance(m_Index.cbegin(), it), pResult);
+		m_Channels.emplace_back(std::move(pChannel));
+
+		return *pResult;
+	}
+
+public:
+	// Retrieve the channel for event type T (creating it if necessary)
+	template<class T>
+	ChannelType<T>& GetChannel()
+	{
+		const size_t slot = Epic::detail::EventTypeIndexer::Get<T>();
+
+		if (slot < m_Slots.size() && m_Slots[slot])
+		{
+			assert(m_Slots[slot]->GetTypeIndex() == slot);
+			return *static_cast<ChannelType<T>*>(m_Slots[slot]);
+		}
+
+		return _CreateChannel<T>(slot);
+	}
+
+	// Retrieve the event that is invoked with batches of T records.
+	// Listeners receive (const T* pRecords, size_t count).
+	template<class T>
+	inline DispatchEvent<T>& GetEvent()
+	{
+		return GetChannel<T>().Dispatched;
+	}
+
+	// Connect a batch listener for event type T.
+	// Args... are forwarded to Event::Connect()
+	template<class T, class... Args>
+	inline void Connect(Args&&... args)
+	{
+		GetEvent<T>().Connect(std::forward<Args>(args)...);
+	}
+
+	// Disconnect a batch listener for event type T.
+	// Args... are forwarded to Event::Disconnect()
+	template<class T, class... Args>
+	inline void Disconnect(Args&&... args)
+	{
+		GetEvent<T>().Disconnect(std::forward<Args>(args)...);
+	}
+
+public:
+	// Queue a record for the next dispatch
+	template<class T>
+	inline void Post(const T& record)
+	{
+		GetChannel<T>().Post(record);
+	}
+
+	// Queue a record for the next dispatch.
+	// Args... are forwarded to T's aggregate initializer
+	template<class T, class... Args>
+	inline void Emplace(Args&&... args)
+	{
+		GetChannel<T>().Emplace(std::forward<Args>(args)...);
+	}
+
+public:
+	// Retrieve the number of records awaiting dispatch
+	size_t GetPendingCount() const noexcept
+	{
+		size_t count = 0;
+
+		for (auto& pChannel : m_Channels)
+			count += pChannel->GetPendingCount();
+
+		return count;
+	}
+
+	// Deliver the pending records of each event type to that type's listeners, 
+	// in order of channel creation.
+	// Every channel's pending records are set aside before any are delivered, so records 
+	// posted during dispatch (to any channel, including newly created ones) are delivered
+	// by the next dispatch.
+	// Returns the number of records dispatched.
+	size_t Dispatch()
+	{
+		const size_t channelCount = m_Channels.size();
+		size_t count = 0;
+
+		for (size_t i = 0; i < channelCount; ++i)
+			count += m_Channels[i]->Snapshot();
+
+		for (size_t i = 0; i < channelCount; ++i)
+			m_Channels[i]->Deliver();
+
+		return count;
+	}
+
+	// Discard all pending records
+	void Clear() noexcept
+	{
+		for (auto& pChannel : m_Channels)
+			pChannel->Clear();
+	}
+};
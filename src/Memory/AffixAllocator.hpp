@@ -20,6 +20,7 @@
 #include <cassert>
 #include <cstdint>
 #include <algorithm>
+#include <limits>
 #include <type_traits>
 
 //////////////////////////////////////////////////////////////////////////////
@@ -78,19 +79,19 @@ public:
 	constexpr AffixAllocator()
 		noexcept(std::is_nothrow_default_constructible<A>::value) = default;
 
-	template<typename = std::enable_if_t<std::is_copy_constructible<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_copy_constructible<A>::value, Dummy>>
 	constexpr AffixAllocator(const Type& obj)
 		noexcept(std::is_nothrow_copy_constructible<A>::value)
 		: m_Allocator{ obj.m_Allocator }
 	{ }
 
-	template<typename = std::enable_if_t<std::is_move_constructible<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<A>::value, Dummy>>
 	constexpr AffixAllocator(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<A>::value)
 		: m_Allocator{ std::move(obj.m_Allocator) }
 	{ }
 
-	template<typename = std::enable_if_t<std::is_copy_assignable<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_copy_assignable<A>::value, Dummy>>
 	AffixAllocator& operator = (const Type& obj)
 		noexcept(std::is_nothrow_copy_assignable<A>::value)
 	{
@@ -99,7 +100,7 @@ public:
 		return *this;
 	}
 
-	template<typename = std::enable_if_t<std::is_move_assignable<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_assignable<A>::value, Dummy>>
 	AffixAllocator& operator = (Type&& obj)
 		noexcept(std::is_nothrow_move_assignable<A>::value)
 	{
@@ -167,7 +168,7 @@ public:
 public:
 	/* Returns a block of uninitialized memory.
 	   The memory will be surrounded by constructed Affix objects. */
-	template<typename = std::enable_if_t<detail::CanAllocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocate<A>::value, Dummy>>
 	Blk Allocate(size_t sz) noexcept
 	{
 		// Verify that the requested size isn't zero.
@@ -197,7 +198,7 @@ public:
 
 	/* Returns a block of uninitialized memory (aligned to 'alignment').
 	   The memory will be surrounded by constructed Affix objects. */
-	template<typename = std::enable_if_t<detail::CanAllocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAligned<A>::value, Dummy>>
 	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
 	{
 		// Verify that the alignment is acceptable
@@ -235,7 +236,7 @@ public:
 
 	/* Attempts to reallocate the memory of blk to the new size sz.
 	   The Affix objects will be moved as necessary. */
-	template<typename = std::enable_if_t<detail::CanReallocate<A>::value && detail::AffixBuffer<Suffix>::CanStore>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocate<A>::value && detail::AffixBuffer<Suffix>::CanStore, Dummy>>
 	bool Reallocate(Blk& blk, size_t sz)
 	{
 		// If the block isn't valid, delegate to Allocate
@@ -284,7 +285,7 @@ public:
 	/* Attempts to reallocate the memory of blk to the new size 'sz' (aligned to 'alignment').
 	   It must have been allocated through AllocateAligned().
 	   The Affix objects will be moved as necessary. */
-	template<typename = std::enable_if_t<detail::CanReallocateAligned<A>::value && detail::AffixBuffer<Suffix>::CanStore>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocateAligned<A>::value && detail::AffixBuffer<Suffix>::CanStore, Dummy>>
 	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = Alignment)
 	{
 		// Verify that the alignment is acceptable
@@ -346,10 +347,46 @@ public:
 		return true;
 	}
 
+	/* Attempts to grow blk in place by delta bytes.
+	   The Suffix object and alignment memento will be moved as necessary. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanExpand<A>::value && detail::AffixBuffer<Suffix>::CanStore, Dummy>>
+	bool Expand(Blk& blk, size_t delta)
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		// Verify that the new size is within our allowed bounds
+		if (delta > MaxAllocSize - blk.Size)
+			return false;
+
+		const AlignmentMemento memento = *ClientToAlignmentMementoPtr(blk);
+
+		// Move the Suffix object to the stack
+		auto pSuffix = GetSuffixObject(blk);
+		detail::AffixBuffer<Suffix> suffix{ pSuffix };
+
+		// Expand the block
+		Blk affixedBlk = ClientToAffixedBlock(blk, memento);
+
+		if (!m_Allocator.Expand(affixedBlk, delta))
+		{
+			suffix.Restore(pSuffix);
+			return false;
+		}
+
+		// Place the Suffix object and the alignment memento
+		suffix.Restore(AffixedToSuffixPtr(affixedBlk));
+		*AffixedToAlignmentMementoPtr(affixedBlk) = memento;
+
+		blk = AffixedToClientBlock(affixedBlk, memento);
+
+		return true;
+	}
+
 public:
 	/* Frees the memory for blk.
 	   The surrounding Affix objects will also be destroyed. */
-	template<typename = std::enable_if_t<detail::CanDeallocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocate<A>::value, Dummy>>
 	void Deallocate(const Blk& blk)
 	{
 		if (!blk) return;
@@ -358,8 +395,8 @@ public:
 			"Attempted to free a block that was not allocated by this allocator");
 
 		// Deconstruct the affix objects
-		if (HasPrefix) GetPrefixObject(blk)->~Prefix();
-		if (HasSuffix) GetSuffixObject(blk)->~Suffix();
+		if constexpr (HasPrefix) GetPrefixObject(blk)->~Prefix();
+		if constexpr (HasSuffix) GetSuffixObject(blk)->~Suffix();
 
 		// Deallocate the affixed block		
 		m_Allocator.Deallocate(ClientToAffixedBlock(blk, static_cast<AlignmentMemento>(Alignment)));
@@ -367,7 +404,7 @@ public:
 
 	/* Frees the memory for blk. It must have been allocated through AllocateAligned().
 	   The surrounding Affix objects will also be destroyed. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAligned<A>::value, Dummy>>
 	void DeallocateAligned(const Blk& blk)
 	{
 		if (!blk) return;
@@ -381,8 +418,8 @@ public:
 			"Either this block was not allocated aligned or the heap has been corrupted");
 
 		// Deconstruct the affix objects
-		if (HasPrefix) GetPrefixObject(blk)->~Prefix();
-		if (HasSuffix) GetSuffixObject(blk)->~Suffix();
+		if constexpr (HasPrefix) GetPrefixObject(blk)->~Prefix();
+		if constexpr (HasSuffix) GetSuffixObject(blk)->~Suffix();
 
 		// Deallocate the affixed block
 		m_Allocator.DeallocateAligned(ClientToAffixedBlock(blk, *ClientToAlignmentMementoPtr(blk)));
@@ -13,7 +13,10 @@
 
 #include "AlignedMallocator.hpp"
 #include "detail/AllocatorHelpers.hpp"
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -32,10 +35,17 @@ Blk AlignedMallocator::AllocateAligned(size_t sz, size_t alignment) const noexce
 	if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
 		return{ nullptr, 0 };
 
+#if defined(_MSC_VER)
 	// Delegate to _aligned_malloc
 	auto p = ::_aligned_malloc(sz, alignment);
 	if (!p)
 		return{ nullptr, 0 };
+#else
+	// Delegate to posix_memalign (which requires at least pointer alignment)
+	void* p = nullptr;
+	if (::posix_memalign(&p, std::max(alignment, sizeof(void*)), sz) != 0)
+		return{ nullptr, 0 };
+#endif
 
 	return{ p, sz };
 }
@@ -50,6 +60,7 @@ bool AlignedMallocator::ReallocateAligned(Blk& blk, size_t sz, size_t alignment)
 	// Verify that the requested size is within our allowed bounds
 	if (sz < MinAllocSize || sz > MaxAllocSize) return false;
 
+#if defined(_MSC_VER)
 	// Attempt to reallocate the block
 	auto p = ::_aligned_realloc(blk.Ptr, sz, alignment);
 
@@ -58,6 +69,26 @@ bool AlignedMallocator::ReallocateAligned(Blk& blk, size_t sz, size_t alignment)
 
 	// Replace the block's pointer and size
 	blk = { p, sz };
+#else
+	// There is no aligned realloc, so move the block to a new allocation
+	if (sz == 0)
+	{
+		::free(blk.Ptr);
+		blk = { nullptr, 0 };
+		return true;
+	}
+
+	auto newBlk = AllocateAligned(sz, alignment);
+	if (!newBlk) return false;
+
+	if (blk)
+	{
+		std::memcpy(newBlk.Ptr, blk.Ptr, std::min(blk.Size, sz));
+		::free(blk.Ptr);
+	}
+
+	blk = newBlk;
+#endif
 
 	return true;
 }
@@ -67,5 +98,9 @@ void AlignedMallocator::DeallocateAligned(const Blk& blk)
 	if (!blk) return;
 
 	assert(Owns(blk) && "AlignedMallocator::DeallocateAligned - Attempted to free a block that was not allocated by this allocator");
+#if defined(_MSC_VER)
 	::_aligned_free(blk.Ptr);
+#else
+	::free(blk.Ptr);
+#endif
 }
@@ -16,7 +16,10 @@
 #include <Epic/Memory/MemoryBlock.hpp>
 #include <cstdint>
 #include <cstddef>
-#include <malloc.h>
+
+#if defined(_MSC_VER)
+	#include <malloc.h>
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -36,7 +39,11 @@ public:
 public:
 	static constexpr size_t Alignment = alignof(std::max_align_t);
 	static constexpr size_t MinAllocSize = 0;
+#if defined(_MSC_VER)
 	static constexpr size_t MaxAllocSize = _HEAP_MAXREQ;
+#else
+	static constexpr size_t MaxAllocSize = SIZE_MAX;
+#endif
 	static constexpr bool IsShareable = true;
 
 public:
@@ -49,7 +56,7 @@ public:
 
 public:
 	/* Returns whether or not this allocator is responsible for the block Blk. */
-	constexpr bool Owns(const Blk& blk) const noexcept
+	constexpr bool Owns(const Blk&) const noexcept
 	{
 		// We don't track allocated blocks and don't discriminate based on block size.
 		// Therefore, we can only return true here.
@@ -57,17 +64,18 @@ public:
 	}
 
 public:
-	/* Returns a block of uninitialized memory (using ::_aligned_malloc).
+	/* Returns a block of uninitialized memory (using ::_aligned_malloc or ::posix_memalign).
 	   If sz is zero, the returned block's pointer is null. */
 	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) const noexcept;
 
 	/* Attempts to reallocate the memory of blk (aligned to alignment) to the new size sz (using ::_realloc_malloc)
 	   If the block's pointer is null, this is equivalent to calling AllocateAligned(sz, alignment)
 	   If sz is zero, the returned block's pointer is malloc-implementation-specific.
-	   Note: According to ::_realloc_malloc, it is an error to reallocate memory and change the alignment of a block. */
+	   Note: According to ::_realloc_malloc, it is an error to reallocate memory and change the alignment of a block.
+	   Note: Where ::_aligned_realloc is unavailable, the block is always moved to a new allocation. */
 	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = Alignment) const;
 
 public:
-	/* Frees the memory for blk (using ::_aligned_free). */
+	/* Frees the memory for blk (using ::_aligned_free or ::free). */
 	void DeallocateAligned(const Blk& blk);
 };
@@ -15,6 +15,7 @@
 
 #include <Epic/Memory/detail/AllocatorHelpers.hpp>
 #include <Epic/Memory/MemoryBlock.hpp>
+#include <cassert>
 #include <cstdint>
 #include <memory>
 
@@ -85,6 +86,12 @@ public:
 		return (blk.Ptr >= _Memory && blk.Ptr < _End());
 	}
 
+	/* Returns the range of memory from which this allocator's blocks are allocated. */
+	constexpr Blk GetRegion() const noexcept
+	{
+		return{ const_cast<char*>(_Memory), MemorySize };
+	}
+
 public:
 	/* Returns a block of uninitialized memory (aligned to alignment).
 	   If sz is zero, the returned block's pointer is null. */
@@ -136,6 +143,26 @@ public:
 		return blk;
 	}
 
+public:
+	/* Attempts to grow blk in place by delta bytes.
+	   Only the last allocated block can grow. */
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		assert(Owns(blk) && "AlignedStackAllocator::Expand - Attempted to expand a block that was not allocated by this allocator");
+
+		// Verify that this block was the last allocated block and that there's room after it
+		if (static_cast<char*>(blk.Ptr) + blk.Size != _pCursor || delta > _Remaining())
+			return false;
+
+		_pCursor += delta;
+		blk.Size += delta;
+
+		return true;
+	}
+
 public:
 	/* Frees all of this allocator's memory */
 	void DeallocateAll() noexcept
@@ -58,19 +58,19 @@ public:
 	constexpr AlignmentAllocator()
 		noexcept(std::is_nothrow_default_constructible<A>::value && std::is_nothrow_default_constructible<U>::value) = default;
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_copy_constructible<A>, std::is_copy_constructible<U>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_copy_constructible<A>, std::is_copy_constructible<U>>, Dummy>>
 	constexpr AlignmentAllocator(const Type& obj)
 		noexcept(std::is_nothrow_copy_constructible<A>::value && std::is_nothrow_copy_constructible<U>::value)
 		: m_AAllocator{ obj.m_AAllocator }, m_UAllocator{ obj.m_UAllocator }
 	{ }
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_move_constructible<A>, std::is_move_constructible<U>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_move_constructible<A>, std::is_move_constructible<U>>, Dummy>>
 	constexpr AlignmentAllocator(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<A>::value && std::is_nothrow_move_constructible<U>::value)
 		: m_AAllocator{ std::move(obj.m_AAllocator) }, m_UAllocator{ std::move(obj.m_UAllocator) }
 	{ }
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_copy_assignable<A>, std::is_copy_assignable<U>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_copy_assignable<A>, std::is_copy_assignable<U>>, Dummy>>
 	AlignmentAllocator& operator = (const Type& obj)
 		noexcept(std::is_nothrow_copy_assignable<A>::value && std::is_nothrow_copy_assignable<U>::value)
 	{
@@ -80,7 +80,7 @@ public:
 		return *this;
 	}
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_move_assignable<A>, std::is_move_assignable<U>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_move_assignable<A>, std::is_move_assignable<U>>, Dummy>>
 	AlignmentAllocator& operator = (Type&& obj)
 		noexcept(std::is_nothrow_move_assignable<A>::value && std::is_nothrow_move_assignable<U>::value)
 	{
@@ -114,7 +114,7 @@ public:
 
 	/* Attempts to reallocate the memory of blk to the new size sz.
 	   Uses the unaligned allocator. */
-	template<typename = std::enable_if_t<detail::CanReallocate<U>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocate<U>::value, Dummy>>
 	bool Reallocate(Blk& blk, size_t sz)
 	{
 		return m_UAllocator.Reallocate(blk, sz);
@@ -122,7 +122,7 @@ public:
 
 	/* Attempts to reallocate the memory of blk (aligned to alignment) to the new size sz.
 	   Uses the aligned allocator. */
-	template<typename = std::enable_if_t<detail::CanReallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocateAligned<A>::value, Dummy>>
 	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = A::Alignment)
 	{
 		return m_AAllocator.ReallocateAligned(blk, sz, alignment);
@@ -130,7 +130,7 @@ public:
 
 	/* Returns a block of uninitialized memory.
 	   Its size is all of the remaining memory in the unaligned allocator. */
-	template<typename = std::enable_if_t<detail::CanAllocateAll<U>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAll<U>::value, Dummy>>
 	Blk AllocateAll() noexcept
 	{
 		return m_UAllocator.AllocateAll();
@@ -138,7 +138,7 @@ public:
 
 	/* Returns a block of uninitialized memory.
 	   Its size is all of the remaining memory in the aligned allocator (aligned to alignment). */
-	template<typename = std::enable_if_t<detail::CanAllocateAll<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAll<A>::value, Dummy>>
 	Blk AllocateAllAligned(size_t alignment = A::Alignment) noexcept
 	{
 		return m_AAllocator.AllocateAllAligned(alignment);
@@ -146,21 +146,21 @@ public:
 
 public:
 	/* Frees the memory for blk.  Uses the unaligned allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocate<U>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocate<U>::value, Dummy>>
 	void Deallocate(const Blk& blk)
 	{
 		m_UAllocator.Deallocate(blk);
 	}
 
 	/* Frees the memory for blk.  Uses the aligned allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAligned<A>::value, Dummy>>
 	void DeallocateAligned(const Blk& blk)
 	{
 		m_AAllocator.DeallocateAligned(blk);
 	}
 
 	/* Frees all of the memory of both allocators. */
-	template<typename = std::enable_if_t<std::conjunction_v<detail::CanDeallocateAll<U>, detail::CanDeallocateAll<A>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<detail::CanDeallocateAll<U>, detail::CanDeallocateAll<A>>, Dummy>>
 	void DeallocateAll() noexcept
 	{
 		m_AAllocator.DeallocateAll();
@@ -169,14 +169,14 @@ public:
 
 public:
 	/* Frees all of the memory of the aligned allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<A>::value, Dummy>>
 	void DeallocateAllAligned() noexcept
 	{
 		m_AAllocator.DeallocateAll();
 	}
 
 	/* Frees all of the memory of the unaligned allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<U>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<U>::value, Dummy>>
 	void DeallocateAllUnaligned() noexcept
 	{
 		m_UAllocator.DeallocateAll();
@@ -73,12 +73,12 @@ namespace Epic::detail
 		using Center = std::tuple_element_t<N, std::tuple<Buckets...>>;
 		
 		using Left = typename SegBucketListFilter<
-			SegBucketIndexLess<N>::Predicate, 
+			SegBucketIndexLess<N>::template Predicate, 
 			TMP::IndexListFor<Buckets...>, 
 			Buckets...>::Type;
 		
 		using Right = typename SegBucketListFilter<
-			SegBucketIndexGreater<N>::Predicate, 
+			SegBucketIndexGreater<N>::template Predicate, 
 			TMP::IndexListFor<Buckets...>, 
 			Buckets...>::Type;
 
@@ -27,12 +27,18 @@
 
 namespace Epic
 {
+	enum class eCascadingOwnership
+	{
+		Linear,		// Owns() walks the node list
+		Sorted		// Owns() binary searches an address-sorted index of node regions
+	};
+
 	namespace detail
 	{
-		template<class AllocatorTemplate, bool IsShared, class NodeAllocator>
+		template<class AllocatorTemplate, bool IsShared, class NodeAllocator, Epic::eCascadingOwnership Ownership>
 		class CascadingAllocatorBase;
 
-		template<class AllocatorTemplate, bool IsShared, class NodeAllocator>
+		template<class AllocatorTemplate, bool IsShared, class NodeAllocator, Epic::eCascadingOwnership Ownership>
 		class CascadingAllocatorImpl;
 
 		template<class Allocator>
@@ -53,20 +59,20 @@ struct Epic::detail::CascadingAllocatorNode
 	
 	CascadingAllocatorNode() 
 		noexcept(std::is_nothrow_default_constructible<Allocator>::value)
-		: m_Allocator{ }, m_pNext{ nullptr }, m_AllocatedSize{ 0 } 
+		: m_pNext{ nullptr }, m_AllocatedSize{ 0 }, m_Allocator{ } 
 	{ }
 
 	explicit CascadingAllocatorNode(size_t sz)
 		noexcept(std::is_nothrow_default_constructible<Allocator>::value)
-		: m_Allocator{ }, m_pNext{ nullptr }, m_AllocatedSize{ sz }
+		: m_pNext{ nullptr }, m_AllocatedSize{ sz }, m_Allocator{ }
 	{ }
 
 	CascadingAllocatorNode(const CascadingAllocatorNode<Allocator>&) = delete;
 
-	template<typename = std::enable_if_t<std::is_move_constructible<Allocator>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<Allocator>::value, Dummy>>
 	CascadingAllocatorNode(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<Allocator>::value)
-		: m_Allocator{ std::move(obj.m_Allocator) }, m_pNext{ nullptr }, m_AllocatedSize{ 0 }
+		: m_pNext{ nullptr }, m_AllocatedSize{ 0 }, m_Allocator{ std::move(obj.m_Allocator) }
 	{
 		std::swap(m_pNext, obj.m_pNext);
 		std::swap(m_AllocatedSize, obj.m_AllocatedSize);
@@ -91,16 +97,18 @@ struct Epic::detail::CalcCascadingAllocatorNodeSize
 
 //////////////////////////////////////////////////////////////////////////////
 
-/// CascadingAllocatorBase<A, IsShared, NodeA>
-template<class A, bool IsShared, class NodeA>
+/// CascadingAllocatorBase<A, IsShared, NodeA, Ownership>
+template<class A, bool IsShared, class NodeA, Epic::eCascadingOwnership Ownership>
 class Epic::detail::CascadingAllocatorBase
 {
 	static_assert(std::is_default_constructible<A>::value, "The template allocator must be default-constructible.");
 	static_assert(std::is_default_constructible<NodeA>::value, "The node allocator must be default-constructible.");
 	static_assert(!IsShared || (IsShared && NodeA::IsShareable), "The node allocator must be shareable.");
+	static_assert(Ownership == Epic::eCascadingOwnership::Linear || detail::CanGetRegion<A>::value,
+		"A sorted cascading allocator requires a template allocator that reports its region (GetRegion).");
 
 public:
-	using Type = Epic::detail::CascadingAllocatorBase<A, IsShared, NodeA>;
+	using Type = Epic::detail::CascadingAllocatorBase<A, IsShared, NodeA, Ownership>;
 
 protected:
 	using NodeType = CascadingAllocatorNode<A>;
@@ -113,25 +121,63 @@ private:
 	static_assert(NodeSize <= NodeA::MaxAllocSize, "This node allocator's maximum allocation size is too low to hold the allocator nodes.");
 	static_assert(NodeSize >= NodeA::MinAllocSize, "This node allocator's minimum allocation size is too high to hold the allocator nodes.");
 
+private:
+	static constexpr bool IsSorted = (Ownership == Epic::eCascadingOwnership::Sorted);
+
+	// The number of nodes that may be pushed ahead of the region index before it is rebuilt
+	static constexpr size_t MaxUnindexedNodes = 8;
+
+	// Shared indices are retired rather than freed, so they are rebuilt geometrically: only once 
+	// the unindexed nodes number at least 1/IndexGrowthDivisor of the indexed nodes.  The retired 
+	// indices then hold at most IndexGrowthDivisor + 1 entries per node in total.
+	static constexpr size_t IndexGrowthDivisor = 4;
+
+	struct RegionEntry
+	{
+		uintptr_t Begin;
+		uintptr_t End;
+		NodeType* pNode;
+	};
+
+	/*	An immutable, address-sorted snapshot of the node regions.
+		Nodes pushed after pNewest are not indexed and must be searched linearly. 
+		The entries immediately follow the header. */
+	struct RegionIndex
+	{
+		RegionIndex* pRetired;		// The index this one superseded
+		NodeType* pNewest;			// The newest node covered by this index
+		Blk Mem;					// The block holding this index
+		size_t Count;				// The number of entries
+		size_t NodeCount;			// The number of nodes covered by this index
+	};
+
+	using IndexPtr = std::conditional_t<IsShared, std::atomic<RegionIndex*>, Epic::NullAtomic<RegionIndex*>>;
+	using FlagType = std::conditional_t<IsShared, std::atomic<bool>, Epic::NullAtomic<bool>>;
+
 private:
 	NodePtr m_pAllocNodes;
+	IndexPtr m_pIndex;
+	FlagType m_IsIndexing;
 	NodeAllocatorType m_NodeAllocator;
 	
 public:
 	constexpr CascadingAllocatorBase()
 		noexcept(std::is_nothrow_default_constructible<NodeA>::value)
-		: m_NodeAllocator{ }, m_pAllocNodes{ nullptr }
+		: m_pAllocNodes{ nullptr }, m_pIndex{ nullptr }, m_IsIndexing{ false }, m_NodeAllocator{ }
 	{ }
 
 	constexpr CascadingAllocatorBase(const Type& obj) = delete;
 
-	template<typename = std::enable_if_t<std::is_move_constructible<NodeA>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<NodeA>::value, Dummy>>
 	constexpr CascadingAllocatorBase(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<NodeA>::value)
-		: m_NodeAllocator{ std::move(obj.m_NodeAllocator) }, 
-		  m_pAllocNodes{ obj.m_pAllocNodes }
+		: m_pAllocNodes{ obj.m_pAllocNodes.load() }, 
+		  m_pIndex{ obj.m_pIndex.load() }, 
+		  m_IsIndexing{ false },
+		  m_NodeAllocator{ std::move(obj.m_NodeAllocator) }
 	{
-		obj.m_pAllocNodes = nullptr;
+		obj.m_pAllocNodes.store(nullptr);
+		obj.m_pIndex.store(nullptr);
 	}
 
 	CascadingAllocatorBase& operator = (const Type& obj) = delete;
@@ -142,20 +188,168 @@ public:
 		DestroyNodes();
 	}
 
+private:
+	static RegionEntry* GetEntries(RegionIndex* pIndex) noexcept
+	{
+		return reinterpret_cast<RegionEntry*>(pIndex + 1);
+	}
+
+	static const RegionEntry* GetEntries(const RegionIndex* pIndex) noexcept
+	{
+		return reinterpret_cast<const RegionEntry*>(pIndex + 1);
+	}
+
+	Blk AllocateFromNodeAllocator(size_t sz) noexcept
+	{
+		if constexpr (CanAllocate<NodeA>::value)
+			return m_NodeAllocator.Allocate(sz);
+		else if constexpr (CanAllocateAligned<NodeA>::value)
+			return m_NodeAllocator.AllocateAligned(sz, NodeA::Alignment);
+		else
+			return{ nullptr, 0 };
+	}
+
+	void DeallocateToNodeAllocator(const Blk& blk)
+	{
+		if constexpr (CanDeallocate<NodeA>::value)
+			m_NodeAllocator.Deallocate(blk);
+		else if constexpr (CanDeallocateAligned<NodeA>::value)
+			m_NodeAllocator.DeallocateAligned(blk);
+	}
+
+	/* Rebuilds the region index once enough nodes have been pushed ahead of it.
+	   Only one thread rebuilds at a time; the others keep searching the unindexed nodes. */
+	void UpdateIndex() noexcept
+	{
+		RegionIndex* pOldIndex = m_pIndex.load(std::memory_order_acquire);
+		NodeType* pNewest = m_pAllocNodes.load(std::memory_order_acquire);
+		NodeType* pIndexed = pOldIndex ? pOldIndex->pNewest : nullptr;
+
+		size_t unindexed = 0;
+		for (auto pNode = pNewest; pNode && pNode != pIndexed; pNode = pNode->m_pNext)
+			++unindexed;
+
+		size_t threshold = MaxUnindexedNodes;
+
+		if constexpr (IsShared)
+		{
+			if (pOldIndex)
+				threshold = std::max(threshold, pOldIndex->NodeCount / IndexGrowthDivisor);
+		}
+
+		if (unindexed < threshold)
+			return;
+
+		if (m_IsIndexing.exchange(true, std::memory_order_acquire))
+			return;
+
+		// Another thread may have published an index while the nodes were counted
+		pOldIndex = m_pIndex.load(std::memory_order_acquire);
+		pNewest = m_pAllocNodes.load(std::memory_order_acquire);
+
+		size_t count = 0;
+		for (auto pNode = pNewest; pNode; pNode = pNode->m_pNext)
+			++count;
+
+		Blk blk = AllocateFromNodeAllocator(sizeof(RegionIndex) + count * sizeof(RegionEntry));
+
+		// If the node allocator cannot hold the index, the new nodes remain unindexed
+		if (blk)
+		{
+			auto pIndex = ::new (blk.Ptr) RegionIndex{ nullptr, pNewest, blk, 0, count };
+			auto pEntries = GetEntries(pIndex);
+
+			for (auto pNode = pNewest; pNode; pNode = pNode->m_pNext)
+			{
+				const Blk region = pNode->m_Allocator.GetRegion();
+				if (!region) continue;
+
+				const auto begin = reinterpret_cast<uintptr_t>(region.Ptr);
+				pEntries[pIndex->Count++] = { begin, begin + region.Size, pNode };
+			}
+
+			std::sort(pEntries, pEntries + pIndex->Count, 
+				[] (const RegionEntry& a, const RegionEntry& b) { return a.Begin < b.Begin; });
+
+			// A shared index may still be searched by other threads, so it is retired
+			// rather than freed. Retired indices are freed along with the nodes.
+			if constexpr (IsShared)
+				pIndex->pRetired = pOldIndex;
+			else if (pOldIndex)
+				DeallocateToNodeAllocator(pOldIndex->Mem);
+
+			m_pIndex.store(pIndex, std::memory_order_release);
+		}
+
+		m_IsIndexing.store(false, std::memory_order_release);
+	}
+
+	void DestroyIndex()
+	{
+		/* Must not be called while thread safety is still required. */
+
+		RegionIndex* pIndex = m_pIndex.load(std::memory_order_acquire);
+
+		while (pIndex)
+		{
+			auto pRetired = pIndex->pRetired;
+
+			if constexpr (!CanDeallocateAll<NodeA>::value)
+				DeallocateToNodeAllocator(pIndex->Mem);
+
+			pIndex = pRetired;
+		}
+
+		m_pIndex.store(nullptr, std::memory_order_release);
+	}
+
 protected:
 	NodeType* FindOwner(const Blk& blk) const noexcept
 	{
-		auto pNode = GetNodeList();
-
-		while (pNode)
+		if constexpr (IsSorted)
 		{
-			if (pNode->m_Allocator.Owns(blk))
-				return pNode;
+			// The index is loaded first so that the node list is at least as new as it
+			const RegionIndex* pIndex = m_pIndex.load(std::memory_order_acquire);
+			const NodeType* pIndexed = pIndex ? pIndex->pNewest : nullptr;
 
-			pNode = pNode->m_pNext;
+			// Search the nodes that were pushed after the index was built
+			auto pNode = GetNodeList();
+
+			for (; pNode && pNode != pIndexed; pNode = pNode->m_pNext)
+			{
+				if (pNode->m_Allocator.Owns(blk))
+					return pNode;
+			}
+
+			if (!pIndex)
+				return nullptr;
+
+			// Find the last region that begins at or before the block
+			const auto pEntries = GetEntries(pIndex);
+			const auto address = reinterpret_cast<uintptr_t>(blk.Ptr);
+
+			auto pPos = std::upper_bound(pEntries, pEntries + pIndex->Count, address,
+				[] (uintptr_t value, const RegionEntry& entry) { return value < entry.Begin; });
+
+			if (pPos == pEntries || address >= (pPos - 1)->End)
+				return nullptr;
+
+			return (pPos - 1)->pNode;
 		}
+		else
+		{
+			auto pNode = GetNodeList();
 
-		return nullptr;
+			while (pNode)
+			{
+				if (pNode->m_Allocator.Owns(blk))
+					return pNode;
+
+				pNode = pNode->m_pNext;
+			}
+
+			return nullptr;
+		}
 	}
 
 	NodeType* GetNodeList() const noexcept
@@ -165,13 +359,8 @@ protected:
 
 	NodeType* CreateNode() noexcept
 	{
-		Blk blk;
-
 		// Allocate a block to place the new node		
-		if constexpr (CanAllocate<NodeA>::value)
-			blk = m_NodeAllocator.Allocate(NodeSize);
-		else if constexpr (CanAllocateAligned<NodeA>::value)
-			blk = m_NodeAllocator.AllocateAligned(NodeSize, NodeA::Alignment);
+		Blk blk = AllocateFromNodeAllocator(NodeSize);
 
 		// Verify the block
 		if (!blk) 
@@ -187,6 +376,9 @@ protected:
 		pNode->m_pNext = m_pAllocNodes.load();
 		while (!m_pAllocNodes.compare_exchange_weak(pNode->m_pNext, pNode));
 
+		if constexpr (IsSorted)
+			UpdateIndex();
+
 		return pNode;
 	}
 
@@ -194,6 +386,8 @@ protected:
 	{
 		/* Must not be called while thread safety is still required. */
 		
+		DestroyIndex();
+
 		NodeType* pNode;
 
 		while ((pNode = m_pAllocNodes.load(std::memory_order_acquire)) != nullptr)
@@ -204,14 +398,7 @@ protected:
 			pNode->~CascadingAllocatorNode();
 
 			if constexpr (!CanDeallocateAll<NodeA>::value)
-			{
-				Blk blk{ pNode, nodesz };
-
-				if constexpr (CanDeallocate<NodeA>::value)
-					m_NodeAllocator.Deallocate(blk);
-				else if constexpr (CanDeallocateAligned<NodeA>::value)
-					m_NodeAllocator.DeallocateAligned(blk);
-			}
+				DeallocateToNodeAllocator(Blk{ pNode, nodesz });
 
 			m_pAllocNodes.store(pNextNode, std::memory_order_release);
 		}
@@ -230,15 +417,16 @@ protected:
 	}
 };
 
-/// CascadingAllocatorBase<A, IsShared, void>
-template<class A, bool IsShared>
-class Epic::detail::CascadingAllocatorBase<A, IsShared, void>
+/// CascadingAllocatorBase<A, IsShared, void, Ownership>
+template<class A, bool IsShared, Epic::eCascadingOwnership Ownership>
+class Epic::detail::CascadingAllocatorBase<A, IsShared, void, Ownership>
 {
 	static_assert(std::is_default_constructible<A>::value, "The template allocator must be default-constructible.");
 	static_assert(std::is_move_constructible<A>::value, "The template allocator must be move-constructible when not using a node allocator.");
+	static_assert(Ownership == Epic::eCascadingOwnership::Linear, "A sorted cascading allocator requires a node allocator to hold its index.");
 
 public:
-	using Type = Epic::detail::CascadingAllocatorBase<A, IsShared, void>;
+	using Type = Epic::detail::CascadingAllocatorBase<A, IsShared, void, Ownership>;
 
 protected:
 	using NodeType = CascadingAllocatorNode<A>;
@@ -365,16 +553,16 @@ protected:
 
 //////////////////////////////////////////////////////////////////////////////
 
-/// CascadingAllocatorImpl<A, IsShared, NodeA>
-template<class A, bool IsShared, class NodeA>
-class Epic::detail::CascadingAllocatorImpl : public Epic::detail::CascadingAllocatorBase<A, IsShared, NodeA>
+/// CascadingAllocatorImpl<A, IsShared, NodeA, Ownership>
+template<class A, bool IsShared, class NodeA, Epic::eCascadingOwnership Ownership>
+class Epic::detail::CascadingAllocatorImpl : public Epic::detail::CascadingAllocatorBase<A, IsShared, NodeA, Ownership>
 {
 public:
 	static_assert(!IsShared || (IsShared && A::IsShareable), "The template allocator must be shareable.");
 
 public:
-	using Type = Epic::detail::CascadingAllocatorImpl<A, IsShared, NodeA>;
-	using Base = Epic::detail::CascadingAllocatorBase<A, IsShared, NodeA>;
+	using Type = Epic::detail::CascadingAllocatorImpl<A, IsShared, NodeA, Ownership>;
+	using Base = Epic::detail::CascadingAllocatorBase<A, IsShared, NodeA, Ownership>;
 	using AllocatorType = A;
 	using NodeAllocatorType = NodeA;
 	
@@ -384,30 +572,96 @@ public:
 	static constexpr size_t MaxAllocSize = A::MaxAllocSize;
 	static constexpr bool IsShareable = IsShared;
 
+private:
+	using NodeType = typename Base::NodeType;
+
+	/*	The node that last satisfied a request on this thread.
+		The hint belongs to the allocator whose identifier matches ID. Identifiers are never reused
+		and are replaced whenever the nodes are destroyed or moved, so a matching hint always
+		refers to a live node of this allocator. */
+	struct NodeHint
+	{
+		uint64_t ID;
+		NodeType* pNode;
+	};
+
+private:
+	uint64_t m_ID;		// Identifies this allocator's node list to the thread hints
+
 public:
-	constexpr CascadingAllocatorImpl()
-		noexcept(std::is_nothrow_default_constructible<Base>::value) = default;
+	CascadingAllocatorImpl()
+		noexcept(std::is_nothrow_default_constructible<Base>::value)
+		: Base{ }, m_ID{ NextID() }
+	{ }
 
 	constexpr CascadingAllocatorImpl(const Type& obj) = delete;
 
-	template<typename = std::enable_if_t<std::is_move_constructible<Base>::value>>
-	constexpr CascadingAllocatorImpl(Type&& obj)
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<Base>::value, Dummy>>
+	CascadingAllocatorImpl(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<Base>::value)
-		: Base(std::move(obj))
-	{ }
+		: Base(std::move(obj)), m_ID{ NextID() }
+	{ 
+		obj.m_ID = NextID();
+	}
 
 	CascadingAllocatorImpl& operator = (const Type& obj) = delete;
 	CascadingAllocatorImpl& operator = (Type&& obj) = delete;
 	
 private:
+	static uint64_t NextID() noexcept
+	{
+		static std::atomic<uint64_t> s_NextID{ 1 };
+		return s_NextID.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static NodeHint& ThreadHint() noexcept
+	{
+		static thread_local NodeHint t_Hint{ 0, nullptr };
+		return t_Hint;
+	}
+
+	inline NodeType* GetHint() const noexcept
+	{
+		const auto& hint = ThreadHint();
+		return (hint.ID == m_ID) ? hint.pNode : nullptr;
+	}
+
+	inline void SetHint(NodeType* pNode) const noexcept
+	{
+		ThreadHint() = { m_ID, pNode };
+	}
+
+	/* Finds the node that owns blk, trying this thread's hint first. */
+	NodeType* FindOwnerNode(const Blk& blk) const noexcept
+	{
+		if (auto pHint = GetHint(); pHint && pHint->m_Allocator.Owns(blk))
+			return pHint;
+
+		return this->FindOwner(blk);
+	}
+
 	Blk TryAllocate(size_t sz) noexcept
 	{
 		if constexpr (detail::CanAllocate<A>::value)
 		{
-			for (auto pNode = GetNodeList(); pNode; pNode = pNode->m_pNext)
+			auto pHint = GetHint();
+
+			if (pHint)
 			{
+				if (Blk result = pHint->m_Allocator.Allocate(sz); result)
+					return result;
+			}
+
+			for (auto pNode = this->GetNodeList(); pNode; pNode = pNode->m_pNext)
+			{
+				if (pNode == pHint) 
+					continue;
+
 				if (Blk result = pNode->m_Allocator.Allocate(sz); result)
+				{
+					SetHint(pNode);
 					return result;
+				}
 			}
 		}
 
@@ -418,10 +672,24 @@ private:
 	{
 		if constexpr (detail::CanAllocateAligned<A>::value)
 		{
-			for (auto pNode = GetNodeList(); pNode; pNode = pNode->m_pNext)
+			auto pHint = GetHint();
+
+			if (pHint)
+			{
+				if (Blk result = pHint->m_Allocator.AllocateAligned(sz, alignment); result)
+					return result;
+			}
+
+			for (auto pNode = this->GetNodeList(); pNode; pNode = pNode->m_pNext)
 			{
+				if (pNode == pHint) 
+					continue;
+
 				if (Blk result = pNode->m_Allocator.AllocateAligned(sz, alignment); result)
+				{
+					SetHint(pNode);
 					return result;
+				}
 			}
 		}
 
@@ -432,12 +700,12 @@ public:
 	/* Returns whether or not this allocator is responsible for the block Blk. */
 	inline bool Owns(const Blk& blk) const noexcept
 	{
-		return blk && (FindOwner(blk) != nullptr);
+		return blk && (FindOwnerNode(blk) != nullptr);
 	}
 
 public:
 	/* Returns a block of uninitialized memory. */
-	template<typename = std::enable_if_t<detail::CanAllocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocate<A>::value, Dummy>>
 	Blk Allocate(size_t sz) noexcept
 	{
 		// Verify that the requested size is within our allowed bounds
@@ -449,7 +717,7 @@ public:
 
 		if (!result)
 		{
-			CreateNode();
+			this->CreateNode();
 			result = TryAllocate(sz);
 		}
 
@@ -457,7 +725,7 @@ public:
 	}
 
 	/* Returns a block of uninitialized memory (aligned to alignment). */
-	template<typename = std::enable_if_t<detail::CanAllocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAligned<A>::value, Dummy>>
 	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
 	{
 		// Verify that the alignment is acceptable
@@ -473,7 +741,7 @@ public:
 
 		if (!result)
 		{
-			CreateNode();
+			this->CreateNode();
 			result = TryAllocateAligned(sz, alignment);
 		}
 
@@ -481,7 +749,7 @@ public:
 	}
 
 	/* Attempts to reallocate the memory of blk to the new size sz. */
-	template<typename = std::enable_if_t<detail::CanAllocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocate<A>::value, Dummy>>
 	bool Reallocate(Blk& blk, size_t sz)
 	{
 		// If the block isn't valid, delegate to Allocate
@@ -508,7 +776,7 @@ public:
 		// First, attempt to reallocate it via the owning allocator
 		if constexpr (detail::CanReallocate<A>::value)
 		{
-			auto pNode = FindOwner(blk);
+			auto pNode = FindOwnerNode(blk);
 			assert(pNode && "CascadingAllocator::Reallocate - Attempted to reallocate a block that was not allocated through this allocator");
 
 			if (pNode->m_Allocator.Reallocate(blk, sz))
@@ -521,7 +789,7 @@ public:
 	}
 
 	/* Attempts to reallocate the memory of blk (aligned to alignment) to the new size sz. */
-	template<typename = std::enable_if_t<detail::CanAllocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAligned<A>::value, Dummy>>
 	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = A::Alignment)
 	{
 		// Verify that the alignment is acceptable
@@ -552,7 +820,7 @@ public:
 		// First, attempt to reallocate it via the owning allocator
 		if constexpr (detail::CanReallocateAligned<A>::value)
 		{
-			auto pNode = FindOwner(blk);
+			auto pNode = FindOwnerNode(blk);
 			assert(pNode && "CascadingAllocator::ReallocateAligned - Attempted to reallocate a block that was not allocated through this allocator");
 
 			if (pNode->m_Allocator.ReallocateAligned(blk, sz, alignment))
@@ -561,43 +829,48 @@ public:
 
 		// Now attempt to reallocate using a helper.
 		// This could result in the allocation being moved to another node.
-		return detail::AlignedReallocator<Type>::ReallocateAlignedViaCopy(*this, blk, sz, alignment);
+		return detail::Reallocator<Type>::ReallocateAlignedViaCopy(*this, blk, sz, alignment);
 	}
 
 public:
 	/* Frees the memory for blk. */
-	template<typename = std::enable_if_t<detail::CanDeallocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocate<A>::value, Dummy>>
 	void Deallocate(const Blk& blk)
 	{
 		if (!blk) return;
 
-		auto pNode = FindOwner(blk);
+		auto pNode = FindOwnerNode(blk);
 		assert(pNode && "CascadingAllocator::Deallocate - Attempted to deallocate a block that was not allocated by this allocator");
 
 		pNode->m_Allocator.Deallocate(blk);
+		SetHint(pNode);
 	}
 
 	/* Frees the memory for blk. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAligned<A>::value, Dummy>>
 	void DeallocateAligned(const Blk& blk)
 	{
 		if (!blk) return;
 
-		auto pNode = FindOwner(blk);
+		auto pNode = FindOwnerNode(blk);
 		assert(pNode && "CascadingAllocator::DeallocateAligned - Attempted to deallocate a block that was not allocated by this allocator");
 
 		pNode->m_Allocator.DeallocateAligned(blk);
+		SetHint(pNode);
 	}
 
 	/* Frees all of the allocated memory in all allocator nodes.
 	   If this allocator is not shared, the allocator chain will also be destroyed. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<A>::value, Dummy>>
 	void DeallocateAll() noexcept
 	{
-		DeallocateAllInNodes();
+		this->DeallocateAllInNodes();
 		
-		if(!IsShared)
-			DestroyNodes();
+		if (!IsShared)
+		{
+			this->DestroyNodes();
+			m_ID = NextID();
+		}
 	}
 };
 
@@ -613,9 +886,11 @@ namespace Epic
 
 namespace Epic
 {
-	template<class AllocatorTemplate, class NodeAllocator = void>
-	using CascadingAllocator = Epic::detail::CascadingAllocatorImpl<AllocatorTemplate, false, NodeAllocator>;
+	template<class AllocatorTemplate, class NodeAllocator = void, 
+		Epic::eCascadingOwnership Ownership = Epic::eCascadingOwnership::Linear>
+	using CascadingAllocator = Epic::detail::CascadingAllocatorImpl<AllocatorTemplate, false, NodeAllocator, Ownership>;
 
-	template<class AllocatorTemplate, class NodeAllocator = void>
-	using SharedCascadingAllocator = Epic::detail::CascadingAllocatorImpl<AllocatorTemplate, true, NodeAllocator>;
+	template<class AllocatorTemplate, class NodeAllocator = void, 
+		Epic::eCascadingOwnership Ownership = Epic::eCascadingOwnership::Linear>
+	using SharedCascadingAllocator = Epic::detail::CascadingAllocatorImpl<AllocatorTemplate, true, NodeAllocator, Ownership>;
 }
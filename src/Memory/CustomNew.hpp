@@ -119,7 +119,7 @@ private:
 
 public:
 	// Called by the usual single-object new-expressions for allocating an object (of the derived type).
-	__declspec(allocator) inline static void* operator new (size_t sz)
+	EPIC_ALLOCATOR_DECL inline static void* operator new (size_t sz)
 	{
 		return _Allocate(sz);
 	}
@@ -131,7 +131,7 @@ public:
 	}
 
 	// Called by the usual array new[]-expressions if allocating an array of objects (of the derived type).
-	__declspec(allocator) inline static void* operator new[] (size_t sz)
+	EPIC_ALLOCATOR_DECL inline static void* operator new[] (size_t sz)
 	{
 		return _Allocate(sz);
 	}
@@ -24,7 +24,7 @@
 
 namespace Epic
 {
-	template<class PrimaryAllocator, class FallbackAllocator>
+	template<class PrimaryAllocator, class SecondaryAllocator>
 	class FallbackAllocator;
 }
 
@@ -56,19 +56,19 @@ public:
 	constexpr FallbackAllocator()
 		noexcept(std::is_nothrow_default_constructible<P>::value && std::is_nothrow_default_constructible<F>::value) = default;
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_copy_constructible<P>, std::is_copy_constructible<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_copy_constructible<P>, std::is_copy_constructible<F>>, Dummy>>
 	constexpr FallbackAllocator(const Type& obj)
 		noexcept(std::is_nothrow_copy_constructible<P>::value && std::is_nothrow_copy_constructible<F>::value)
 		: m_PAllocator{ obj.m_PAllocator }, m_FAllocator{ obj.m_FAllocator }
 	{ }
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_move_constructible<P>, std::is_move_constructible<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_move_constructible<P>, std::is_move_constructible<F>>, Dummy>>
 	constexpr FallbackAllocator(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<P>::value && std::is_nothrow_move_constructible<F>::value)
 		: m_PAllocator{ std::move(obj.m_PAllocator) }, m_FAllocator{ std::move(obj.m_FAllocator) }
 	{ }
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_copy_assignable<P>, std::is_copy_assignable<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_copy_assignable<P>, std::is_copy_assignable<F>>, Dummy>>
 	FallbackAllocator& operator = (const Type& obj)
 		noexcept(std::is_nothrow_copy_assignable<P>::value && std::is_nothrow_copy_assignable<F>::value)
 	{
@@ -78,7 +78,7 @@ public:
 		return *this;
 	}
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_move_assignable<P>, std::is_move_assignable<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_move_assignable<P>, std::is_move_assignable<F>>, Dummy>>
 	FallbackAllocator& operator = (Type&& obj)
 		noexcept(std::is_nothrow_move_assignable<P>::value && std::is_nothrow_move_assignable<F>::value)
 	{
@@ -99,7 +99,7 @@ public:
 	/* Returns a block of uninitialized memory.
 	   Attempts to allocate using the Primary allocator.  The Fallback allocator is used 
 	   if the Primary allocator returns a null pointer. */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanAllocate<P>, detail::CanAllocate<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanAllocate<P>, detail::CanAllocate<F>>, Dummy>>
 	Blk Allocate(size_t sz) noexcept
 	{
 		if constexpr (detail::CanAllocate<P>::value)
@@ -115,7 +115,7 @@ public:
 	/* Returns a block of uninitialized memory (aligned to alignment).
 	   Attempts to allocate using the Primary allocator.  The Fallback allocator is used 
 	   if the Primary allocator returns a null pointer. */
-	template<typename = std::enable_if_t<std::conjunction_v<detail::CanAllocateAligned<P>, detail::CanAllocateAligned<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<detail::CanAllocateAligned<P>, detail::CanAllocateAligned<F>>, Dummy>>
 	Blk AllocateAligned(size_t sz, size_t alignment = 0) noexcept
 	{
 		Blk result = m_PAllocator.AllocateAligned(sz, (alignment == 0) ? P::Alignment : alignment);
@@ -127,7 +127,7 @@ public:
 	}
 
 	/* Attempts to reallocate the memory of blk to the new size sz. */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanReallocate<P>, detail::CanReallocate<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanReallocate<P>, detail::CanReallocate<F>>, Dummy>>
 	bool Reallocate(Blk& blk, size_t sz)
 	{
 		if (m_PAllocator.Owns(blk))
@@ -147,7 +147,7 @@ public:
 	}
 
 	/* Attempts to reallocate the memory of blk (aligned to alignment) to the new size sz. */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanReallocateAligned<P>, detail::CanReallocateAligned<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanReallocateAligned<P>, detail::CanReallocateAligned<F>>, Dummy>>
 	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = 0)
 	{
 		if (m_PAllocator.Owns(blk))
@@ -166,9 +166,29 @@ public:
 		}
 	}
 
+	/* Attempts to grow blk in place by delta bytes. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanExpand<P>, detail::CanExpand<F>>, Dummy>>
+	bool Expand(Blk& blk, size_t delta)
+	{
+		if (m_PAllocator.Owns(blk))
+		{
+			if constexpr (detail::CanExpand<P>::value)
+				return m_PAllocator.Expand(blk, delta);
+			else
+				return false;
+		}
+		else
+		{
+			if constexpr (detail::CanExpand<F>::value)
+				return m_FAllocator.Expand(blk, delta);
+			else
+				return false;
+		}
+	}
+
 public:
 	/* Frees the memory for blk. */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanDeallocate<P>, detail::CanDeallocate<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanDeallocate<P>, detail::CanDeallocate<F>>, Dummy>>
 	void Deallocate(const Blk& blk)
 	{
 		if (m_PAllocator.Owns(blk))
@@ -188,9 +208,9 @@ public:
 	}
 
 	/* Frees the memory for blk (blk needs to have been allocated with AllocateAligned). */
-	template<typename = std::enable_if_t<std::conjunction_v<
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<
 		detail::CanAllocateAligned<P>, detail::CanAllocateAligned<F>, 
-		std::disjunction<detail::CanDeallocateAligned<P>, detail::CanDeallocateAligned<F>>>>>
+		std::disjunction<detail::CanDeallocateAligned<P>, detail::CanDeallocateAligned<F>>>, Dummy>>
 	void DeallocateAligned(const Blk& blk)
 	{
 		if (m_PAllocator.Owns(blk))
@@ -210,7 +230,7 @@ public:
 	}
 
 	/* Frees all of the memory in both allocators. */
-	template<typename = std::enable_if_t<std::conjunction_v<detail::CanDeallocateAll<P>, detail::CanDeallocateAll<F>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<detail::CanDeallocateAll<P>, detail::CanDeallocateAll<F>>, Dummy>>
 	void DeallocateAll() noexcept
 	{
 		m_PAllocator.DeallocateAll();
@@ -219,14 +239,14 @@ public:
 
 public:
 	/* Frees all of the memory in the primary allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<P>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<P>::value, Dummy>>
 	void DeallocateAllPrimary() noexcept
 	{
 		m_PAllocator.DeallocateAll();
 	}
 
 	/* Frees all of the memory in the fallback allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<F>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<F>::value, Dummy>>
 	void DeallocateAllFallback() noexcept
 	{
 		m_FAllocator.DeallocateAll();
@@ -60,19 +60,19 @@ public:
 	constexpr ForceAlignAllocator() 
 		noexcept(std::is_nothrow_default_constructible<A>::value) = default;
 
-	template<typename = std::enable_if_t<std::is_copy_constructible<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_copy_constructible<A>::value, Dummy>>
 	constexpr ForceAlignAllocator(const Type& obj)
 		noexcept(std::is_nothrow_copy_constructible<A>::value)
 		: m_Allocator{ obj.m_Allocator }
 	{ }
 
-	template<typename = std::enable_if_t<std::is_move_constructible<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<A>::value, Dummy>>
 	constexpr ForceAlignAllocator(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<A>::value)
 		: m_Allocator{ std::move(obj.m_Allocator) }
 	{ }
 
-	template<typename = std::enable_if_t<std::is_copy_assignable<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_copy_assignable<A>::value, Dummy>>
 	ForceAlignAllocator& operator = (const Type& obj)
 		noexcept(std::is_nothrow_copy_assignable<A>::value)
 	{
@@ -81,7 +81,7 @@ public:
 		return *this;
 	}
 
-	template<typename = std::enable_if_t<std::is_move_assignable<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_assignable<A>::value, Dummy>>
 	ForceAlignAllocator& operator = (Type&& obj)
 		noexcept(std::is_nothrow_move_assignable<A>::value)
 	{
@@ -111,7 +111,7 @@ public:
 			if (auto blk = m_Allocator.AllocateAligned(sz, Alignment); blk)
 				return blk;
 			else
-				return { nullptr 0 };
+				return { nullptr, 0 };
 		}
 
 		else if constexpr (detail::CanAllocate<A>::value)
@@ -144,7 +144,7 @@ public:
 
 	/* Returns a block of uninitialized memory (aligned to alignment).
 	   ForcedAlignment will not be enforced. */
-	template<typename = std::enable_if_t<detail::CanAllocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAligned<A>::value, Dummy>>
 	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
 	{
 		return m_Allocator.AllocateAligned(sz, alignment);
@@ -179,7 +179,7 @@ public:
 
 	/* Attempts to reallocate the memory of blk (aligned to alignment) to the new size sz. 
 	   ForcedAlignment will not be enforced. */
-	template<typename = std::enable_if_t<detail::CanReallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocateAligned<A>::value, Dummy>>
 	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = Alignment)
 	{
 		return m_Allocator.ReallocateAligned(blk, sz, alignment);
@@ -187,7 +187,7 @@ public:
 
 	/* Returns a block of uninitialized memory equal to the total remaining amount
 	   of available memory (aligned to ForcedAlignment). */
-	template<typename = std::enable_if_t<detail::CanAllocateAll<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAll<A>::value, Dummy>>
 	Blk AllocateAll() noexcept
 	{
 		// Allocate the block
@@ -238,7 +238,7 @@ public:
 	/* Returns a block of unitialized memory equal to the total remaining amount 
 	   of available memory (aligned to alignment).
 	   ForcedAlignment will not be enforced. */
-	template<typename = std::enable_if_t<detail::CanAllocateAllAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAllAligned<A>::value, Dummy>>
 	Blk AllocateAllAligned(size_t alignment = Alignment) noexcept
 	{
 		return m_Allocator.AllocateAllAligned(alignment);
@@ -277,14 +277,14 @@ public:
 
 	/* Frees the memory for blk. This should only be called if AllocateAligned() 
 	   or AllocateAllAligned() was used to allocate blk. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAligned<A>::value, Dummy>>
 	void DeallocateAligned(const Blk& blk)
 	{
 		m_Allocator.DeallocateAligned(blk);
 	}
 
 	/* Frees all of the memory of the allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<A>::value, Dummy>>
 	void DeallocateAll() noexcept
 	{
 		m_Allocator.DeallocateAll();
@@ -0,0 +1,531 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Memory/detail/AllocatorHelpers.hpp>
+#include <Epic/Memory/detail/AllocatorTraits.hpp>
+#include <Epic/Memory/MemoryBlock.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<class Allocator, size_t PageSize = 64 * 1024, size_t FrameCount = 2>
+	class FrameArena;
+
+	namespace detail
+	{
+		struct FrameArenaTag;
+	}
+
+	template<class Arena, class Tag = Epic::detail::FrameArenaTag>
+	class FrameArenaAllocator;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// FrameArena<A, PageSz, FrameCnt>
+//	A linear (pointer bump) allocator made of chained pages acquired from A.
+//	Allocations are made from the current frame and are reclaimed all at once when 
+//	the frame is reused; NextFrame() cycles through FrameCnt frames, so memory allocated 
+//	during the previous FrameCnt - 1 frames remains valid.
+//	Pages are retained across frames and only returned to A when the arena is destroyed.
+template<class A, size_t PageSz, size_t FrameCnt>
+class Epic::FrameArena
+{
+	static_assert(std::is_default_constructible<A>::value, "The frame arena backing allocator must be default-constructible.");
+	static_assert(detail::CanAllocate<A>::value || detail::CanAllocateAligned<A>::value,
+		"The frame arena backing allocator must be able to perform allocations.");
+	static_assert(FrameCnt > 0, "A frame arena must have at least one frame.");
+
+public:
+	using Type = Epic::FrameArena<A, PageSz, FrameCnt>;
+	using AllocatorType = A;
+
+private:
+	struct Page
+	{
+		Page* pNext;
+		Blk Mem;
+	};
+
+	struct Frame
+	{
+		Page* pFirst;				// This frame's page chain
+		Page* pCurrent;				// The page currently being allocated from (null if none)
+		unsigned char* pCursor;		// The next free byte in pCurrent
+	};
+
+public:
+	static constexpr size_t Alignment = detail::DefaultAlignment;
+	static constexpr size_t PageSize = PageSz;
+	static constexpr size_t FrameCount = FrameCnt;
+	static constexpr bool IsShareable = false;
+
+private:
+	static constexpr bool IsAligned = (A::Alignment % Alignment) != 0;
+	static constexpr size_t PageHeaderSize = detail::RoundToAligned(sizeof(Page), Alignment);
+
+	static_assert(!IsAligned || detail::CanAllocateAligned<A>::value,
+		"The frame arena backing allocator must support aligned allocations if its alignment is less than the arena's alignment.");
+	static_assert(PageSize > PageHeaderSize, "The frame arena page size is too small.");
+	static_assert(A::MaxAllocSize > PageHeaderSize, "The frame arena backing allocator's maximum allocation size is too small.");
+
+public:
+	static constexpr size_t MinAllocSize = 0;
+	static constexpr size_t MaxAllocSize = A::MaxAllocSize - PageHeaderSize;
+
+public:
+	/// Marker
+	struct Marker
+	{
+		Page* pPage;
+		unsigned char* pCursor;
+		size_t FrameIndex;
+	};
+
+private:
+	A m_Allocator;
+	Frame m_Frames[FrameCount];
+	size_t m_FrameIndex;
+
+public:
+	FrameArena() noexcept(std::is_nothrow_default_constructible<A>::value)
+		: m_Allocator{ }, m_FrameIndex{ 0 }
+	{
+		for (auto& frame : m_Frames)
+			frame = { nullptr, nullptr, nullptr };
+	}
+
+	FrameArena(const Type&) = delete;
+	FrameArena(Type&&) = delete;
+
+	FrameArena& operator = (const Type&) = delete;
+	FrameArena& operator = (Type&&) = delete;
+
+	~FrameArena()
+	{
+		FreePages();
+	}
+
+private:
+	static inline unsigned char* GetPageBegin(const Page* pPage) noexcept
+	{
+		return const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(pPage) + PageHeaderSize);
+	}
+
+	static inline unsigned char* GetPageEnd(const Page* pPage) noexcept
+	{
+		return static_cast<unsigned char*>(pPage->Mem.Ptr) + pPage->Mem.Size;
+	}
+
+	static inline size_t GetRemaining(const Frame& frame) noexcept
+	{
+		return frame.pCurrent ? static_cast<size_t>(GetPageEnd(frame.pCurrent) - frame.pCursor) : 0;
+	}
+
+	/* Moves frame to a page with room for sz bytes, reusing a retained page if possible. */
+	bool AdvancePage(Frame& frame, size_t sz) noexcept
+	{
+		Page* pCandidate = frame.pCurrent ? frame.pCurrent->pNext : frame.pFirst;
+
+		if (!pCandidate || static_cast<size_t>(GetPageEnd(pCandidate) - GetPageBegin(pCandidate)) < sz)
+		{
+			// Allocate a new page (oversized requests receive a dedicated page)
+			if (sz > MaxAllocSize)
+				return false;
+
+			const size_t pageSize = std::max(PageSize, sz + PageHeaderSize);
+			Blk mem;
+
+			if constexpr (IsAligned)
+				mem = m_Allocator.AllocateAligned(pageSize, Alignment);
+			else
+				mem = m_Allocator.Allocate(pageSize);
+
+			if (!mem)
+				return false;
+
+			// Link the new page in after the current page
+			pCandidate = ::new (mem.Ptr) Page{ nullptr, mem };
+
+			if (frame.pCurrent)
+			{
+				pCandidate->pNext = frame.pCurrent->pNext;
+				frame.pCurrent->pNext = pCandidate;
+			}
+			else
+			{
+				pCandidate->pNext = frame.pFirst;
+				frame.pFirst = pCandidate;
+			}
+		}
+
+		frame.pCurrent = pCandidate;
+		frame.pCursor = GetPageBegin(pCandidate);
+
+		return true;
+	}
+
+	static inline void ResetFrame(Frame& frame) noexcept
+	{
+		frame.pCurrent = frame.pFirst;
+		frame.pCursor = frame.pFirst ? GetPageBegin(frame.pFirst) : nullptr;
+	}
+
+	void FreePages()
+	{
+		for (auto& frame : m_Frames)
+		{
+			while (frame.pFirst)
+			{
+				Page* pNext = frame.pFirst->pNext;
+				const Blk mem = frame.pFirst->Mem;
+
+				if constexpr (IsAligned)
+				{
+					if constexpr (detail::CanDeallocateAligned<A>::value)
+						m_Allocator.DeallocateAligned(mem);
+				}
+				else
+				{
+					if constexpr (detail::CanDeallocate<A>::value)
+						m_Allocator.Deallocate(mem);
+				}
+
+				frame.pFirst = pNext;
+			}
+
+			frame = { nullptr, nullptr, nullptr };
+		}
+	}
+
+	/* Returns whether or not blk is the most recent allocation made from the current frame */
+	inline bool IsLastAllocation(const Blk& blk) const noexcept
+	{
+		const Frame& frame = m_Frames[m_FrameIndex];
+		return static_cast<unsigned char*>(blk.Ptr) + detail::RoundToAligned(blk.Size, Alignment) == frame.pCursor;
+	}
+
+public:
+	/* Returns whether or not this allocator is responsible for the block Blk. */
+	bool Owns(const Blk& blk) const noexcept
+	{
+		for (const auto& frame : m_Frames)
+		{
+			for (const Page* pPage = frame.pFirst; pPage; pPage = pPage->pNext)
+			{
+				if (blk.Ptr >= GetPageBegin(pPage) && blk.Ptr < GetPageEnd(pPage))
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+public:
+	/* Returns a block of uninitialized memory from the current frame.
+	   If sz is zero, the returned block's pointer is null. */
+	Blk Allocate(size_t sz) noexcept
+	{
+		// Verify that the requested size is within our allowed bounds
+		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
+			return{ nullptr, 0 };
+
+		// Round the requested size up so that subsequent allocations remain aligned
+		const size_t sznew = detail::RoundToAligned(sz, Alignment);
+		Frame& frame = m_Frames[m_FrameIndex];
+
+		if (sznew > GetRemaining(frame) && !AdvancePage(frame, sznew))
+			return{ nullptr, 0 };
+
+		// Bump the cursor and return the allocation
+		Blk result = { frame.pCursor, sz };
+		frame.pCursor += sznew;
+
+		return result;
+	}
+
+	/* Returns a block of uninitialized memory from the current frame (aligned to alignment).
+	   If sz is zero, the returned block's pointer is null. */
+	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
+	{
+		// Verify that the alignment is acceptable
+		if (!detail::IsGoodAlignment(alignment))
+			return{ nullptr, 0 };
+
+		// Verify that the requested size is within our allowed bounds
+		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
+			return{ nullptr, 0 };
+
+		if (alignment <= Alignment)
+			return Allocate(sz);
+
+		const size_t sznew = detail::RoundToAligned(sz, Alignment);
+		Frame& frame = m_Frames[m_FrameIndex];
+
+		// Attempt to align within the current page, then within a fresh page
+		void* pAligned = frame.pCursor;
+		size_t space = GetRemaining(frame);
+
+		if (!frame.pCurrent || !std::align(alignment, sznew, pAligned, space))
+		{
+			if (!AdvancePage(frame, sznew + alignment))
+				return{ nullptr, 0 };
+
+			pAligned = frame.pCursor;
+			space = GetRemaining(frame);
+
+			if (!std::align(alignment, sznew, pAligned, space))
+				return{ nullptr, 0 };
+		}
+
+		// Bump the cursor and return the allocation
+		frame.pCursor = static_cast<unsigned char*>(pAligned) + sznew;
+
+		return{ pAligned, sz };
+	}
+
+	/* Attempts to reallocate the memory of blk to the new size sz.
+	   The most recent allocation is resized in place if its page has room. */
+	bool Reallocate(Blk& blk, size_t sz)
+	{
+		// If the block isn't valid, delegate to Allocate
+		if (!blk)
+			return (bool)(blk = Allocate(sz));
+
+		// If the requested size is zero, delegate to Deallocate
+		if (sz == 0)
+		{
+			Deallocate(blk);
+			blk = { nullptr, 0 };
+			return true;
+		}
+
+		// Verify that the new requested size is within our allowed bounds
+		if (sz < MinAllocSize || sz > MaxAllocSize)
+			return false;
+
+		assert(Owns(blk) && "FrameArena::Reallocate - Attempted to reallocate a block that was not allocated by this allocator");
+
+		const size_t szold = detail::RoundToAligned(blk.Size, Alignment);
+		const size_t sznew = detail::RoundToAligned(sz, Alignment);
+
+		// The block already has room
+		if (sznew <= szold && !IsLastAllocation(blk))
+		{
+			blk.Size = sz;
+			return true;
+		}
+
+		// Resize the most recent allocation in place
+		Frame& frame = m_Frames[m_FrameIndex];
+
+		if (IsLastAllocation(blk) && sznew <= szold + GetRemaining(frame))
+		{
+			frame.pCursor = static_cast<unsigned char*>(blk.Ptr) + sznew;
+			blk.Size = sz;
+			return true;
+		}
+
+		// Normal reallocation
+		return detail::Reallocator<Type>::ReallocateViaCopy(*this, blk, sz);
+	}
+
+	/* Attempts to grow blk in place by delta bytes.
+	   Only the most recent allocation can grow, and only within its page. */
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		// Verify that the new size is within our allowed bounds
+		if (delta > MaxAllocSize - blk.Size)
+			return false;
+
+		assert(Owns(blk) && "FrameArena::Expand - Attempted to expand a block that was not allocated by this allocator");
+
+		const size_t szold = detail::RoundToAligned(blk.Size, Alignment);
+		const size_t sznew = detail::RoundToAligned(blk.Size + delta, Alignment);
+
+		// The block already has room
+		if (sznew == szold)
+		{
+			blk.Size += delta;
+			return true;
+		}
+
+		Frame& frame = m_Frames[m_FrameIndex];
+
+		if (!IsLastAllocation(blk) || sznew > szold + GetRemaining(frame))
+			return false;
+
+		frame.pCursor = static_cast<unsigned char*>(blk.Ptr) + sznew;
+		blk.Size += delta;
+
+		return true;
+	}
+
+public:
+	/* If blk was the most recent allocation, it will be freed.
+	   Otherwise, its memory is reclaimed when its frame is reused. */
+	void Deallocate(const Blk& blk)
+	{
+		if (!blk) return;
+
+		assert(Owns(blk) && "FrameArena::Deallocate - Attempted to free a block that was not allocated by this allocator");
+
+		if (IsLastAllocation(blk))
+			m_Frames[m_FrameIndex].pCursor = static_cast<unsigned char*>(blk.Ptr);
+	}
+
+	/* If blk was the most recent allocation, it will be freed.
+	   Otherwise, its memory is reclaimed when its frame is reused. */
+	void DeallocateAligned(const Blk& blk)
+	{
+		Deallocate(blk);
+	}
+
+	/* Reclaims the memory of every frame.  Pages are retained. */
+	void DeallocateAll() noexcept
+	{
+		for (auto& frame : m_Frames)
+			ResetFrame(frame);
+	}
+
+public:
+	/* Ends the current frame and begins the next.
+	   The frame being reused is reset; the previous FrameCount - 1 frames remain valid. */
+	void NextFrame() noexcept
+	{
+		m_FrameIndex = (m_FrameIndex + 1) % FrameCount;
+		ResetFrame(m_Frames[m_FrameIndex]);
+	}
+
+	/* Returns the index of the current frame */
+	inline size_t GetFrameIndex() const noexcept
+	{
+		return m_FrameIndex;
+	}
+
+	/* Returns a marker for the current position in the current frame */
+	Marker Mark() const noexcept
+	{
+		const Frame& frame = m_Frames[m_FrameIndex];
+		return{ frame.pCurrent, frame.pCursor, m_FrameIndex };
+	}
+
+	/* Reclaims all memory allocated from the current frame since marker was taken.
+	   The marker must have been taken during the current frame. */
+	void Rewind(const Marker& marker) noexcept
+	{
+		assert(marker.FrameIndex == m_FrameIndex && "FrameArena::Rewind - The marker belongs to a different frame");
+
+		Frame& frame = m_Frames[m_FrameIndex];
+
+		if (!marker.pPage)
+			ResetFrame(frame);
+		else
+		{
+			frame.pCurrent = marker.pPage;
+			frame.pCursor = marker.pCursor;
+		}
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// FrameArenaAllocator<FA, Tag>
+//	A stateless handle to the calling thread's FA frame arena (one per thread and Tag).
+//	This allows a frame arena to back STL containers, e.g.
+//		Epic::STLVector<int, Epic::FrameArenaAllocator<MyFrameArena>> temps;
+//	while each thread's frame loop calls:
+//		Epic::FrameArenaAllocator<MyFrameArena>::Arena().NextFrame();
+//	NOTE: FrameArena is not thread-safe, so every thread allocates from its own arena.
+//	      Memory must be released on the thread that allocated it and does not outlive
+//	      that thread.
+template<class FA, class Tag_>
+class Epic::FrameArenaAllocator
+{
+	static_assert(std::is_default_constructible<FA>::value, "The frame arena must be default-constructible.");
+
+public:
+	using Type = Epic::FrameArenaAllocator<FA, Tag_>;
+	using ArenaType = FA;
+	using Tag = Tag_;
+
+public:
+	static constexpr size_t Alignment = FA::Alignment;
+	static constexpr size_t MinAllocSize = FA::MinAllocSize;
+	static constexpr size_t MaxAllocSize = FA::MaxAllocSize;
+	static constexpr bool IsShareable = FA::IsShareable;
+
+public:
+	/* Returns whether or not the arena is responsible for the block Blk. */
+	inline bool Owns(const Blk& blk) const noexcept
+	{
+		return Arena().Owns(blk);
+	}
+
+public:
+	/* Returns a block of uninitialized memory from the arena's current frame. */
+	inline Blk Allocate(size_t sz) noexcept
+	{
+		return Arena().Allocate(sz);
+	}
+
+	/* Returns a block of uninitialized memory from the arena's current frame (aligned to alignment). */
+	inline Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
+	{
+		return Arena().AllocateAligned(sz, alignment);
+	}
+
+	/* Attempts to reallocate the memory of blk to the new size sz. */
+	inline bool Reallocate(Blk& blk, size_t sz)
+	{
+		return Arena().Reallocate(blk, sz);
+	}
+
+	/* Attempts to grow blk in place if it was the arena's most recent allocation. */
+	inline bool Expand(Blk& blk, size_t delta)
+	{
+		return Arena().Expand(blk, delta);
+	}
+
+public:
+	/* Frees blk if it was the arena's most recent allocation. */
+	inline void Deallocate(const Blk& blk)
+	{
+		Arena().Deallocate(blk);
+	}
+
+	/* Frees blk if it was the arena's most recent allocation. */
+	inline void DeallocateAligned(const Blk& blk)
+	{
+		Arena().DeallocateAligned(blk);
+	}
+
+public:
+	/* Returns the calling thread's arena */
+	static FA& Arena() noexcept
+	{
+		static thread_local FA t_Arena;
+		return t_Arena;
+	}
+};
@@ -18,9 +18,12 @@
 #include <Epic/Memory/MemoryBlock.hpp>
 #include <Epic/TMP/Utility.hpp>
 #include <Epic/NullMutex.hpp>
+#include <Epic/Preprocessor.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <type_traits>
@@ -29,11 +32,22 @@
 
 namespace Epic
 {
+	enum class eFreelistOwnership
+	{
+		Linear,		// Owns() walks the chunk list
+		Sorted,		// Owns() binary searches a sorted index of chunk addresses
+		Aligned		// Chunks are aligned to a power-of-two boundary; Owns() masks and hashes the chunk address
+	};
+
 	namespace detail
 	{
 		struct FreelistBlock;
 
-		template<class Allocator, bool IsShared, size_t BatchSize, size_t BlockSize, size_t MinAllocationSize = 0, size_t Align = 0>
+		class FreelistStack;
+		class AtomicFreelistStack;
+
+		template<class Allocator, bool IsShared, size_t BatchSize, size_t BlockSize, size_t MinAllocationSize = 0, size_t Align = 0, bool IsLockFree = false,
+			Epic::eFreelistOwnership Ownership = Epic::eFreelistOwnership::Linear>
 		class FreelistAllocatorImpl;
 	}
 }
@@ -47,16 +61,132 @@ struct Epic::detail::FreelistBlock
 
 //////////////////////////////////////////////////////////////////////////////
 
-/// FreelistAllocatorImpl<A, IsShared, BatchSz, Max, Min, Align>
-template<class A, bool IsShared, size_t BatchSz, size_t Max, size_t Min, size_t Align>
+/// FreelistStack
+class Epic::detail::FreelistStack
+{
+private:
+	FreelistBlock* m_pHead;
+
+public:
+	constexpr FreelistStack() noexcept
+		: m_pHead{ nullptr }
+	{ }
+
+public:
+	/* Removes and returns the head block (or null if the stack is empty). */
+	FreelistBlock* Pop() noexcept
+	{
+		FreelistBlock* pBlock = m_pHead;
+
+		if (pBlock)
+			m_pHead = pBlock->pNext;
+
+		return pBlock;
+	}
+
+	/* Pushes the chain of blocks pFirst..pLast (linked through pNext). */
+	void Push(FreelistBlock* pFirst, FreelistBlock* pLast) noexcept
+	{
+		pLast->pNext = m_pHead;
+		m_pHead = pFirst;
+	}
+
+	/* Empties the stack, returning the previous head block. */
+	FreelistBlock* Release() noexcept
+	{
+		FreelistBlock* pBlock = m_pHead;
+		m_pHead = nullptr;
+
+		return pBlock;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// AtomicFreelistStack
+//	A Treiber stack whose head pointer is paired with a version tag.
+//	Every successful exchange increments the tag, so a head that was popped and
+//	pushed back between another thread's load and CAS no longer compares equal (ABA).
+//	NOTE: This requires a double-width CAS to be lock-free; on targets that lack one,
+//	std::atomic will fall back to an internal lock.
+class Epic::detail::AtomicFreelistStack
+{
+private:
+	struct alignas(2 * sizeof(void*)) TaggedHead
+	{
+		FreelistBlock* pBlock;
+		uintptr_t Tag;
+	};
+
+private:
+	std::atomic<TaggedHead> m_Head;
+
+public:
+	AtomicFreelistStack() noexcept
+		: m_Head{ TaggedHead{ nullptr, 0 } }
+	{ }
+
+public:
+	/* Removes and returns the head block (or null if the stack is empty). */
+	EPIC_NO_SANITIZE_THREAD FreelistBlock* Pop() noexcept
+	{
+		TaggedHead head = m_Head.load(std::memory_order_acquire);
+
+		while (head.pBlock)
+		{
+			// NOTE: Blocks are never returned to the backing allocator while the stack 
+			// is in use, so reading pNext from a block that was just taken by another 
+			// thread is harmless; the tag will have changed and the CAS will fail.
+			// That thread may already be writing to the block, which ThreadSanitizer 
+			// would report, so Pop() is excluded from instrumentation.
+			const TaggedHead next{ head.pBlock->pNext, head.Tag + 1 };
+
+			if (m_Head.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire))
+				return head.pBlock;
+		}
+
+		return nullptr;
+	}
+
+	/* Pushes the chain of blocks pFirst..pLast (linked through pNext). */
+	void Push(FreelistBlock* pFirst, FreelistBlock* pLast) noexcept
+	{
+		TaggedHead head = m_Head.load(std::memory_order_relaxed);
+		TaggedHead next;
+
+		do
+		{
+			pLast->pNext = head.pBlock;
+			next = { pFirst, head.Tag + 1 };
+		} 
+		while (!m_Head.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	/* Empties the stack, returning the previous head block. */
+	FreelistBlock* Release() noexcept
+	{
+		TaggedHead head = m_Head.load(std::memory_order_relaxed);
+
+		while (!m_Head.compare_exchange_weak(head, TaggedHead{ nullptr, head.Tag + 1 }, 
+			std::memory_order_acq_rel, std::memory_order_relaxed));
+
+		return head.pBlock;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// FreelistAllocatorImpl<A, IsShared, BatchSz, Max, Min, Align, IsLockFree, Ownership>
+template<class A, bool IsShared, size_t BatchSz, size_t Max, size_t Min, size_t Align, bool IsLockFree, Epic::eFreelistOwnership Ownership>
 class Epic::detail::FreelistAllocatorImpl
 {
 	static_assert(std::is_default_constructible<A>::value, "The freelist backing allocator must be default-constructible.");
 	static_assert(detail::CanAllocate<A>::value || detail::CanAllocateAligned<A>::value, 
 		"The freelist backing allocator must be able to perform allocations.");
+	static_assert(!IsLockFree || IsShared, "A lock-free freelist must be shared.");
 	
 public:
-	using Type = Epic::detail::FreelistAllocatorImpl<A, IsShared, BatchSz, Max, Min>;
+	using Type = Epic::detail::FreelistAllocatorImpl<A, IsShared, BatchSz, Max, Min, Align, IsLockFree, Ownership>;
 	using AllocatorType = A;
 
 private:
@@ -67,6 +197,8 @@ private:
 	};
 
 	static constexpr bool IsAligned = (Align != 0) && (Align != A::Alignment);
+	static constexpr bool IsChunkAligned = (Ownership == Epic::eFreelistOwnership::Aligned);
+	static constexpr bool IsIndexed = (Ownership != Epic::eFreelistOwnership::Linear);
 
 public:
 	static constexpr size_t Alignment = IsAligned ? Align : A::Alignment;
@@ -81,6 +213,8 @@ public:
 		"A freelist's alignment can only differ from the backing allocator's alignment if the allocator supports aligned allocations.");
 	static_assert(!IsAligned || (BlockSize % Alignment) == 0,
 		"A freelist can only align if its block size is a multiple of the alignment.");
+	static_assert(!IsChunkAligned || detail::CanAllocateAligned<A>::value,
+		"A freelist can only align its chunks if the backing allocator supports aligned allocations.");
 
 private:
 	static constexpr size_t ChunkInfoBlocks = (sizeof(PoolChunk) + BlockSize - 1) / BlockSize;
@@ -90,33 +224,50 @@ public:
 
 private:
 	static constexpr size_t ChunkSize = BatchSize * BlockSize;
+	static constexpr size_t ChunkAlignment = IsChunkAligned ? 
+		std::max(detail::RoundToPowerOfTwo(ChunkSize), Alignment) : Alignment;
+	static constexpr size_t MinIndexCapacity = 16;
 
 private:
 	using MutexType = std::conditional_t<IsShared, std::mutex, Epic::NullMutex>;
+	using StackType = std::conditional_t<IsLockFree, detail::AtomicFreelistStack, detail::FreelistStack>;
 
 private:
 	AllocatorType m_Allocator;
 	PoolChunk* m_pChunks;
-	FreelistBlock* m_pFreeList;
-	mutable MutexType m_Mutex;
+	Blk m_Index;					// Sorted: ascending chunk addresses; Aligned: open-addressed table of chunk addresses
+	size_t m_IndexCount;			// The number of chunks in m_Index
+	StackType m_FreeList;
+	mutable MutexType m_Mutex;		// When lock-free, only guards chunk growth and m_pChunks
 	
 public:
 	FreelistAllocatorImpl() noexcept(std::is_nothrow_default_constructible<A>::value)
-		: m_Allocator{ }, m_pChunks{ nullptr }, m_pFreeList{ nullptr }  
+		: m_Allocator{ }, m_pChunks{ nullptr }, m_Index{ nullptr, 0 }, m_IndexCount{ 0 }, m_FreeList{ }  
 	{ }
 
 	FreelistAllocatorImpl(const Type&) = delete;
 
 	/* Move constructor is disabled in a shared context if the backing allocator is not shared */
-	template<typename = std::enable_if_t<std::is_move_constructible<A>::value && (!IsShared || (IsShared && A::IsShareable))>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<A>::value && (!IsShared || (IsShared && A::IsShareable)), Dummy>>
 	FreelistAllocatorImpl(Type&& obj) noexcept(std::is_nothrow_move_constructible<A>::value)
-		: m_Allocator{ std::move(obj.m_Allocator) }, m_pChunks{ nullptr }, m_pFreeList{ nullptr }
+		: m_Allocator{ std::move(obj.m_Allocator) }, m_pChunks{ nullptr }, m_Index{ nullptr, 0 }, m_IndexCount{ 0 }, m_FreeList{ }
 	{
 		{	/* CS */
 			std::lock_guard<MutexType> lock(obj.m_Mutex);
 
 			std::swap(m_pChunks, obj.m_pChunks);
-			std::swap(m_pFreeList, obj.m_pFreeList);
+			std::swap(m_Index, obj.m_Index);
+			std::swap(m_IndexCount, obj.m_IndexCount);
+			
+			FreelistBlock* pHead = obj.m_FreeList.Release();
+			if (pHead)
+			{
+				FreelistBlock* pTail = pHead;
+				while (pTail->pNext) 
+					pTail = pTail->pNext;
+
+				m_FreeList.Push(pHead, pTail);
+			}
 		}
 	}
 
@@ -129,39 +280,161 @@ public:
 	}
 
 private:
+	Blk AllocateBacking(size_t sz, size_t alignment) noexcept
+	{
+		if constexpr ((IsAligned || IsChunkAligned) && detail::CanAllocateAligned<A>::value)
+			return m_Allocator.AllocateAligned(sz, alignment);
+		
+		else if constexpr (!(IsAligned || IsChunkAligned) && detail::CanAllocate<A>::value)
+			return m_Allocator.Allocate(sz);
+
+		else
+			return{ nullptr, 0 };
+	}
+
+	void DeallocateBacking(const Blk& blk)
+	{
+		if constexpr (IsAligned || IsChunkAligned)
+		{
+			if constexpr (detail::CanDeallocateAligned<A>::value)
+				m_Allocator.DeallocateAligned(blk);
+		}
+		else
+		{
+			if constexpr (detail::CanDeallocate<A>::value)
+				m_Allocator.Deallocate(blk);
+		}
+	}
+
+private:
+	static inline size_t GetIndexCapacity(const Blk& index) noexcept
+	{
+		return index.Size / sizeof(uintptr_t);
+	}
+
+	/* Returns the starting slot of the chunk at address in the open-addressed index */
+	static inline size_t GetIndexSlot(uintptr_t address, size_t capacity) noexcept
+	{
+		return (address / ChunkAlignment) & (capacity - 1);
+	}
+
+	/* Inserts a chunk address into an index.  The index must have room for it. */
+	static void InsertIndex(Blk& index, size_t& count, uintptr_t address) noexcept
+	{
+		auto pIndex = static_cast<uintptr_t*>(index.Ptr);
+
+		if constexpr (IsChunkAligned)
+		{
+			const size_t capacity = GetIndexCapacity(index);
+			size_t slot = GetIndexSlot(address, capacity);
+
+			while (pIndex[slot] != 0)
+				slot = (slot + 1) & (capacity - 1);
+
+			pIndex[slot] = address;
+		}
+		else
+		{
+			auto pPos = std::upper_bound(pIndex, pIndex + count, address);
+			std::memmove(pPos + 1, pPos, (pIndex + count - pPos) * sizeof(uintptr_t));
+			*pPos = address;
+		}
+
+		++count;
+	}
+
+	/* Ensures that the index has room for one more chunk */
+	bool ReserveIndex() noexcept
+	{
+		const size_t capacity = GetIndexCapacity(m_Index);
+
+		// The open-addressed index is kept at most half full
+		const size_t required = IsChunkAligned ? 2 * (m_IndexCount + 1) : (m_IndexCount + 1);
+		if (required <= capacity)
+			return true;
+
+		const size_t newCapacity = std::max(MinIndexCapacity, 2 * capacity);
+		Blk newIndex = AllocateBacking(newCapacity * sizeof(uintptr_t), A::Alignment);
+		if (!newIndex)
+			return false;
+
+		newIndex.Size = newCapacity * sizeof(uintptr_t);
+		std::memset(newIndex.Ptr, 0, newIndex.Size);
+
+		size_t newCount = 0;
+
+		if (m_Index)
+		{
+			auto pIndex = static_cast<const uintptr_t*>(m_Index.Ptr);
+
+			if constexpr (IsChunkAligned)
+			{
+				for (size_t i = 0; i < capacity; ++i)
+				{
+					if (pIndex[i] != 0)
+						InsertIndex(newIndex, newCount, pIndex[i]);
+				}
+			}
+			else
+			{
+				std::memcpy(newIndex.Ptr, pIndex, m_IndexCount * sizeof(uintptr_t));
+				newCount = m_IndexCount;
+			}
+
+			DeallocateBacking(m_Index);
+		}
+
+		m_Index = newIndex;
+		m_IndexCount = newCount;
+
+		return true;
+	}
+
 	bool AllocateChunk() noexcept
 	{
-		// Allocate a chunk of memory from the backing allocator
-		Blk chunk;
+		// Make room to index the new chunk
+		if constexpr (IsIndexed)
+		{
+			if (!ReserveIndex())
+				return false;
+		}
 
-		if constexpr (IsAligned && detail::CanAllocateAligned<A>::value)
-			chunk = m_Allocator.AllocateAligned(ChunkSize, Alignment);
-		
-		else if constexpr (!IsAligned && detail::CanAllocate<A>::value)
-			chunk = m_Allocator.Allocate(ChunkSize);
+		// Allocate a chunk of memory from the backing allocator
+		Blk chunk = AllocateBacking(ChunkSize, ChunkAlignment);
 
 		if (!chunk) 
 			return false;
 
+		if constexpr (IsIndexed)
+			InsertIndex(m_Index, m_IndexCount, reinterpret_cast<uintptr_t>(chunk.Ptr));
+
 		// Embed management info into the chunk (at the beginning)
 		PoolChunk* pNewChunk = new(chunk.Ptr) PoolChunk;
 		pNewChunk->Mem = chunk;
 		pNewChunk->pNext = m_pChunks;
 		m_pChunks = pNewChunk;
 
-		// Break the remaining chunk space into free blocks and add them to the freelist
+		// Break the remaining chunk space into a chain of free blocks and add it to the freelist
 		constexpr size_t remainingBlocks = BatchSize - ChunkInfoBlocks;
 		auto pFreeBlocks = reinterpret_cast<unsigned char*>(chunk.Ptr) + (ChunkInfoBlocks * BlockSize);
 		
+		FreelistBlock* pFirst = nullptr;
+		FreelistBlock* pLast = nullptr;
+
 		for (size_t i = 0; i < remainingBlocks; ++i)
 		{
 			FreelistBlock* pNewBlock = new(pFreeBlocks) FreelistBlock;
-			pNewBlock->pNext = m_pFreeList;
-			m_pFreeList = pNewBlock;
+			pNewBlock->pNext = pFirst;
+			pFirst = pNewBlock;
+
+			if (!pLast) 
+				pLast = pNewBlock;
 
 			pFreeBlocks += BlockSize;
 		}
 
+		m_FreeList.Push(pFirst, pLast);
+
 		return true;
 	}
 
@@ -177,50 +450,74 @@ private:
 			while (m_pChunks)
 			{
 				auto pNext = m_pChunks->pNext;
-
-				if constexpr (IsAligned)
-				{
-					if constexpr (detail::CanDeallocateAligned<A>::value)
-						m_Allocator.DeallocateAligned(m_pChunks->Mem);
-				}
-				else
-				{
-					if constexpr (detail::CanDeallocate<A>::value)
-						m_Allocator.Deallocate(m_pChunks->Mem);
-				}
-
+				DeallocateBacking(m_pChunks->Mem);
 				m_pChunks = pNext;
 			}
+
+			if (m_Index)
+				DeallocateBacking(m_Index);
 		}
 
-		m_pFreeList = nullptr;
+		m_Index = { nullptr, 0 };
+		m_IndexCount = 0;
+
+		m_FreeList.Release();
 	}
 
 	Blk PopBlock() noexcept
 	{
-		// Verify there's a block to pop
-		if (!m_pFreeList)
-			return{ nullptr, 0 };
+		// Take the head block (if there is one)
+		FreelistBlock* pBlock = m_FreeList.Pop();
 
-		// Take the head block
-		Blk result{ m_pFreeList, BlockSize };
-		m_pFreeList = m_pFreeList->pNext;
+		if (!pBlock)
+			return{ nullptr, 0 };
 
-		return result;
+		return{ pBlock, BlockSize };
 	}
 
-	void PushBlock(const Blk& blk) noexcept
+	/* Pops a block, growing the freelist if it is empty.
+	   When lock-free, the lock is only taken to grow. */
+	Blk PopOrGrow() noexcept
 	{
-		if (!blk) return;
+		if constexpr (IsLockFree)
+		{
+			Blk result = PopBlock();
+			if (result)
+				return result;
+		}
+
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			// Another thread may have grown the freelist while waiting for the lock
+			Blk result = PopBlock();
+
+			if (!result)
+			{
+				AllocateChunk();
+				result = PopBlock();
+			}
+
+			return result;
+		}
+	}
 
+	static FreelistBlock* ToFreelistBlock(const Blk& blk) noexcept
+	{
 		// If the blk was allocated aligned, the alignment must be removed
 		const size_t alignPad = BlockSize - blk.Size;
 		auto pPtr = reinterpret_cast<unsigned char*>(blk.Ptr) - alignPad;
 
+		return reinterpret_cast<FreelistBlock*>(pPtr);
+	}
+
+	void PushBlock(const Blk& blk) noexcept
+	{
+		if (!blk) return;
+
 		// Push the adjusted pointer
-		auto pNewHead = reinterpret_cast<FreelistBlock*>(pPtr);
-		pNewHead->pNext = m_pFreeList;
-		m_pFreeList = pNewHead;
+		auto pNewHead = ToFreelistBlock(blk);
+		m_FreeList.Push(pNewHead, pNewHead);
 	}
 
 public:
@@ -236,11 +533,42 @@ private:
 	/* Non-locking Owns */
 	bool _Owns(const Blk& blk) const noexcept
 	{
+		if constexpr (IsChunkAligned)
+		{
+			if (m_IndexCount == 0)
+				return false;
+
+			// The owning chunk (if any) begins at the preceding chunk alignment boundary
+			const auto pIndex = static_cast<const uintptr_t*>(m_Index.Ptr);
+			const size_t capacity = GetIndexCapacity(m_Index);
+			const uintptr_t address = reinterpret_cast<uintptr_t>(blk.Ptr) & ~uintptr_t(ChunkAlignment - 1);
+
+			for (size_t slot = GetIndexSlot(address, capacity); pIndex[slot] != 0; slot = (slot + 1) & (capacity - 1))
+			{
+				if (pIndex[slot] == address)
+					return true;
+			}
+
+			return false;
+		}
+		else if constexpr (IsIndexed)
+		{
+			// Find the last chunk that begins at or before the block
+			const auto pIndex = static_cast<const uintptr_t*>(m_Index.Ptr);
+			const uintptr_t address = reinterpret_cast<uintptr_t>(blk.Ptr);
+			
+			auto pPos = std::upper_bound(pIndex, pIndex + m_IndexCount, address);
+			if (pPos == pIndex)
+				return false;
+
+			return address < *(pPos - 1) + ChunkSize;
+		}
+
 		const PoolChunk* pChunk = m_pChunks;
 
 		while (pChunk)
 		{
-			auto pEnd = static_cast<const void*>(reinterpret_cast<const unsigned char*>(pChunk->Mem.Ptr) + pChunk->Mem.Size));
+			auto pEnd = static_cast<const void*>(reinterpret_cast<const unsigned char*>(pChunk->Mem.Ptr) + pChunk->Mem.Size);
 
 			if (blk.Ptr >= pChunk->Mem.Ptr && blk.Ptr < pEnd)
 				return true;
@@ -260,20 +588,7 @@ public:
 		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
 			return{ nullptr, 0 };
 
-		{	/* CS */
-			std::lock_guard<MutexType> lock(m_Mutex);
-
-			// Try to pop a block
-			Blk result = PopBlock();
-
-			if (!result)
-			{
-				AllocateChunk();
-				result = PopBlock();
-			}
-
-			return result;
-		}
+		return PopOrGrow();
 	}
 
 	/* Returns a block of uninitialized memory at least as big as sz (aligned to alignment).
@@ -288,37 +603,66 @@ public:
 		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
 			return{ nullptr, 0 };
 
-		{	/* CS */
-			std::lock_guard<MutexType> lock(m_Mutex);
+		// Try to pop a block
+		Blk result = PopOrGrow();
 
-			// Try to pop a block
-			Blk result = PopBlock();
+		// Attempt to calculate an aligned pointer within the block.
+		// NOTE: std::align will fail for invalid blocks, so no need to validate it
+		size_t space = result.Size;
+		void* pAligned = result.Ptr;
 
-			if (!result)
-			{
-				AllocateChunk();
-				result = PopBlock();
-			}
+		if (std::align(alignment, sz, pAligned, space))
+		{
+			// Alignment succeeded
+			result = { pAligned, space };
+		}
+		else
+		{
+			// Alignment failed; return the block to the freelist.
+			PushBlock(result);
+			result = { nullptr, 0 };
+		}
+
+		return result;
+	}
 
-			// Attempt to calculate an aligned pointer within the block.
-			// NOTE: std::align will fail for invalid blocks, so no need to validate it
-			size_t space = result.Size;
-			void* pAligned = result.Ptr;
+	/* Writes up to count blocks of uninitialized memory (each BlockSize bytes) to pBlocks
+	   while holding the lock only once. Returns the number of blocks written. */
+	size_t AllocateBatch(Blk* pBlocks, size_t count) noexcept
+	{
+		size_t allocated = 0;
 
-			if (std::align(alignment, sz, pAligned, space))
+		if constexpr (IsLockFree)
+		{
+			while (allocated < count)
 			{
-				// Alignment succeeded
-				result = { pAligned, space };
+				Blk result = PopOrGrow();
+				if (!result) break;
+
+				pBlocks[allocated++] = result;
 			}
-			else
+		}
+		else
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			while (allocated < count)
 			{
-				// Alignment failed; return the block to the freelist.
-				PushBlock(result);
-				result = { nullptr, 0 };
-			}
+				Blk result = PopBlock();
 
-			return result;
+				if (!result)
+				{
+					if (!AllocateChunk())
+						break;
+
+					continue;
+				}
+
+				pBlocks[allocated++] = result;
+			}
 		}
+
+		return allocated;
 	}
 
 public:
@@ -327,6 +671,12 @@ public:
 	{
 		if (!blk) return;
 
+		if constexpr (IsLockFree)
+		{
+			assert(Owns(blk) && "FreelistAllocator::Deallocate - Attempted to free a block that was not allocated by this allocator");
+			PushBlock(blk);
+		}
+		else
 		{	/* CS */
 			std::lock_guard<MutexType> lock(m_Mutex);
 
@@ -340,6 +690,12 @@ public:
 	{
 		if (!blk) return;
 
+		if constexpr (IsLockFree)
+		{
+			assert(Owns(blk) && "FreelistAllocator::DeallocateAligned - Attempted to free a block that was not allocated by this allocator");
+			PushBlock(blk);
+		}
+		else
 		{	/* CS */
 			std::lock_guard<MutexType> lock(m_Mutex);
 
@@ -348,7 +704,49 @@ public:
 		}
 	}
 
-	/* Frees all of this allocator's memory */
+	/* Reclaims the memory of count blocks back into the freelist
+	   while holding the lock only once. */
+	void DeallocateBatch(const Blk* pBlocks, size_t count)
+	{
+		if constexpr (IsLockFree)
+		{
+			// Link the blocks into a chain and push it with a single exchange
+			FreelistBlock* pFirst = nullptr;
+			FreelistBlock* pLast = nullptr;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (!pBlocks[i]) continue;
+
+				assert(Owns(pBlocks[i]) && "FreelistAllocator::DeallocateBatch - Attempted to free a block that was not allocated by this allocator");
+				
+				FreelistBlock* pBlock = ToFreelistBlock(pBlocks[i]);
+				pBlock->pNext = pFirst;
+				pFirst = pBlock;
+
+				if (!pLast) 
+					pLast = pBlock;
+			}
+
+			if (pFirst)
+				m_FreeList.Push(pFirst, pLast);
+		}
+		else
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (!pBlocks[i]) continue;
+
+				assert(_Owns(pBlocks[i]) && "FreelistAllocator::DeallocateBatch - Attempted to free a block that was not allocated by this allocator");
+				PushBlock(pBlocks[i]);
+			}
+		}
+	}
+
+	/* Frees all of this allocator's memory.
+	   NOTE: When lock-free, no other thread may be using the allocator. */
 	void DeallocateAll() noexcept
 	{
 		{	/* CS */
@@ -363,39 +761,75 @@ public:
 
 namespace Epic
 {
-	/// FreelistAllocator<Allocator, BatchSize, BlockSize, MinAllocationSize>
-	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t MinAllocationSize = 0>
+	/// FreelistAllocator<Allocator, BatchSize, BlockSize, MinAllocationSize, Ownership>
+	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t MinAllocationSize = 0,
+		Epic::eFreelistOwnership Ownership = Epic::eFreelistOwnership::Linear>
 	using FreelistAllocator = 
 		detail::FreelistAllocatorImpl<Allocator, false, BatchSize,
 			Epic::TMP::StaticMax<BlockSize, sizeof(detail::FreelistBlock), MinAllocationSize>::value,
 			MinAllocationSize,
-			0>;
+			0,
+			false,
+			Ownership>;
 
-	/// SharedFreelistAllocator<Allocator, BatchSize, BlockSize, MinAllocationSize>
-	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t MinAllocationSize = 0>
+	/// SharedFreelistAllocator<Allocator, BatchSize, BlockSize, MinAllocationSize, Ownership>
+	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t MinAllocationSize = 0,
+		Epic::eFreelistOwnership Ownership = Epic::eFreelistOwnership::Linear>
 	using SharedFreelistAllocator = 
 		detail::FreelistAllocatorImpl<Allocator, true, BatchSize,
 			Epic::TMP::StaticMax<BlockSize, sizeof(detail::FreelistBlock), MinAllocationSize>::value,
 			MinAllocationSize,
-			0>;
+			0,
+			false,
+			Ownership>;
+
+	/// LockFreeFreelistAllocator<Allocator, BatchSize, BlockSize, MinAllocationSize, Ownership>
+	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t MinAllocationSize = 0,
+		Epic::eFreelistOwnership Ownership = Epic::eFreelistOwnership::Linear>
+	using LockFreeFreelistAllocator = 
+		detail::FreelistAllocatorImpl<Allocator, true, BatchSize,
+			Epic::TMP::StaticMax<BlockSize, sizeof(detail::FreelistBlock), MinAllocationSize>::value,
+			MinAllocationSize,
+			0,
+			true,
+			Ownership>;
 
-	/// AlignedFreelistAllocator<Allocator, false, BatchSize, BlockSize, Alignment, MinAllocationSize>
-	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t Alignment = 0, size_t MinAllocationSize = 0>
+	/// AlignedFreelistAllocator<Allocator, false, BatchSize, BlockSize, Alignment, MinAllocationSize, Ownership>
+	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t Alignment = 0, size_t MinAllocationSize = 0,
+		Epic::eFreelistOwnership Ownership = Epic::eFreelistOwnership::Linear>
 	using AlignedFreelistAllocator =
 		detail::FreelistAllocatorImpl<Allocator, false, BatchSize,
 			detail::RoundToAligned(
 				Epic::TMP::StaticMax<BlockSize, sizeof(detail::FreelistBlock), MinAllocationSize>::value, 
 				(Alignment == 0) ? Allocator::Alignment : Alignment),
 			MinAllocationSize,
-			Alignment>;
+			Alignment,
+			false,
+			Ownership>;
 
-	/// SharedAlignedFreelistAllocator<Allocator, false, BatchSize, BlockSize, Alignment, MinAllocationSize>
-	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t Alignment = 0, size_t MinAllocationSize = 0>
+	/// SharedAlignedFreelistAllocator<Allocator, false, BatchSize, BlockSize, Alignment, MinAllocationSize, Ownership>
+	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t Alignment = 0, size_t MinAllocationSize = 0,
+		Epic::eFreelistOwnership Ownership = Epic::eFreelistOwnership::Linear>
 	using SharedAlignedFreelistAllocator =
 		detail::FreelistAllocatorImpl<Allocator, true, BatchSize,
 			detail::RoundToAligned(
 				Epic::TMP::StaticMax<BlockSize, sizeof(detail::FreelistBlock), MinAllocationSize>::value, 
 				(Alignment == 0) ? Allocator::Alignment : Alignment),
 			MinAllocationSize,
-			Alignment>;
+			Alignment,
+			false,
+			Ownership>;
+
+	/// LockFreeAlignedFreelistAllocator<Allocator, BatchSize, BlockSize, Alignment, MinAllocationSize, Ownership>
+	template<class Allocator, size_t BatchSize, size_t BlockSize, size_t Alignment = 0, size_t MinAllocationSize = 0,
+		Epic::eFreelistOwnership Ownership = Epic::eFreelistOwnership::Linear>
+	using LockFreeAlignedFreelistAllocator =
+		detail::FreelistAllocatorImpl<Allocator, true, BatchSize,
+			detail::RoundToAligned(
+				Epic::TMP::StaticMax<BlockSize, sizeof(detail::FreelistBlock), MinAllocationSize>::value, 
+				(Alignment == 0) ? Allocator::Alignment : Alignment),
+			MinAllocationSize,
+			Alignment,
+			true,
+			Ownership>;
 }
@@ -77,35 +77,42 @@ public:
 
 public:
 	/* Returns a block of uninitialized memory. */
-	template<typename = std::enable_if_t<detail::CanAllocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocate<A>::value, Dummy>>
 	Blk Allocate(size_t sz) noexcept
 	{
 		return m_pAllocator->Allocate(sz);
 	}
 
 	/* Returns a block of uninitialized memory (aligned to alignment). */
-	template<typename = std::enable_if_t<detail::CanAllocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAligned<A>::value, Dummy>>
 	Blk AllocateAligned(size_t sz, size_t alignment = A::Alignment) noexcept
 	{
 		return m_pAllocator->AllocateAligned(sz, alignment);
 	}
 
 	/* Attempts to reallocate the memory of blk to the new size sz. */
-	template<typename = std::enable_if_t<detail::CanReallocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocate<A>::value, Dummy>>
 	bool Reallocate(Blk& blk, size_t sz)
 	{
 		return m_pAllocator->Reallocate(blk, sz);
 	}
 
 	/* Attempts to reallocate the memory of blk (aligned to alignment) to the new size sz. */
-	template<typename = std::enable_if_t<detail::CanReallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocateAligned<A>::value, Dummy>>
 	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = A::Alignment)
 	{
 		return m_pAllocator->ReallocateAligned(blk, sz, alignment);
 	}
 
+	/* Attempts to grow blk in place by delta bytes. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanExpand<A>::value, Dummy>>
+	bool Expand(Blk& blk, size_t delta)
+	{
+		return m_pAllocator->Expand(blk, delta);
+	}
+
 	/* Returns a block of uninitialized memory. */
-	template<typename = std::enable_if_t<detail::CanAllocateAll<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAll<A>::value, Dummy>>
 	Blk AllocateAll() noexcept
 	{
 		return m_pAllocator->AllocateAll();
@@ -113,21 +120,21 @@ public:
 
 public:
 	/* Frees the memory for blk. */
-	template<typename = std::enable_if_t<detail::CanDeallocate<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocate<A>::value, Dummy>>
 	void Deallocate(const Blk& blk)
 	{
 		m_pAllocator->Deallocate(blk);
 	}
 
 	/* Frees the memory for blk. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAligned<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAligned<A>::value, Dummy>>
 	void DeallocateAligned(const Blk& blk)
 	{
 		m_pAllocator->DeallocateAligned(blk);
 	}
 
 	/* Frees all of the allocator's memory. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<A>::value, Dummy>>
 	void DeallocateAll() noexcept
 	{
 		m_pAllocator->DeallocateAll();
@@ -81,7 +81,7 @@ public:
 
 	HeapAllocatorImpl(const Type&) = delete;
 
-	template<typename = std::enable_if_t<std::is_move_constructible<PolicyType>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<PolicyType>::value, Dummy>>
 	HeapAllocatorImpl(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<PolicyType>::value)
 		: PolicyType{ std::move(obj) }
@@ -97,9 +97,15 @@ public:
 		return PolicyType::Owns(blk);
 	}
 
+	/* Returns the range of memory from which this allocator's blocks are allocated. */
+	constexpr Blk GetRegion() const noexcept
+	{
+		return PolicyType::GetRegion();
+	}
+
 public:
 	/* Returns a block of uninitialized memory at least as big as sz. */
-	template<typename = std::enable_if_t<detail::CanAllocate<PolicyType>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocate<PolicyType>::value, Dummy>>
 	Blk Allocate(size_t sz) noexcept
 	{
 		// Verify that the requested size is within our allowed bounds
@@ -110,7 +116,7 @@ public:
 	}
 
 	/* Attempts to reallocate the memory of blk to the new size sz. */
-	template<typename = std::enable_if_t<detail::CanReallocate<PolicyType>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocate<PolicyType>::value, Dummy>>
 	bool Reallocate(Blk& blk, size_t sz)
 	{
 		// If the block isn't valid, delegate to Allocate
@@ -137,9 +143,25 @@ public:
 		return PolicyType::Reallocate(blk, sz);
 	}
 
+	/* Attempts to grow blk in place by delta bytes. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanExpand<PolicyType>::value, Dummy>>
+	bool Expand(Blk& blk, size_t delta)
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		// Verify that the new size is within our allowed bounds
+		if (delta > MaxAllocSize - blk.Size)
+			return false;
+
+		assert(Owns(blk) && "HeapAllocator::Expand - Attempted to expand a block that was not allocated by this allocator");
+
+		return PolicyType::Expand(blk, delta);
+	}
+
 	/* Returns a block of uninitialized memory.
 	   Its size is all of the remaining memory. */
-	template<typename = std::enable_if_t<detail::CanAllocateAll<PolicyType>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAll<PolicyType>::value, Dummy>>
 	Blk AllocateAll() noexcept
 	{
 		return PolicyType::AllocateAll();
@@ -147,7 +169,7 @@ public:
 
 public:
 	/* Reclaims blk's memory back into the heap. */
-	template<typename = std::enable_if_t<detail::CanDeallocate<PolicyType>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocate<PolicyType>::value, Dummy>>
 	void Deallocate(const Blk& blk)
 	{
 		if (!blk) return;
@@ -157,7 +179,7 @@ public:
 	}
 
 	/* Frees all of the memory back into the heap. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<PolicyType>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<PolicyType>::value, Dummy>>
 	void DeallocateAll() noexcept
 	{
 		PolicyType::DeallocateAll();
@@ -210,7 +232,7 @@ public:
 
 	StaticHeapPolicy(const Type&) = delete;
 
-	template<typename = std::enable_if_t<std::is_move_constructible<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<A>::value, Dummy>>
 	StaticHeapPolicy(Type&& obj) noexcept(std::is_nothrow_move_constructible<A>::value)
 		: m_Allocator{ std::move(obj.m_Allocator) }, 
 		  m_Heap{ obj.m_Heap }, 
@@ -286,6 +308,11 @@ public:
 		return (pBlk >= pHeapStart) && (pBlk < pHeapEnd);
 	}
 
+	Blk GetRegion() const noexcept
+	{
+		return{ m_Heap.Ptr, m_Heap ? BlkSz * BlkCnt : 0 };
+	}
+
 	Blk Allocate(size_t sz) noexcept
 	{
 		// Attempt to reserve memory
@@ -304,6 +331,36 @@ public:
 		return{ nullptr, 0 };
 	}
 
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		const size_t curBlocksReq = (blk.Size + BlkSz - 1) / BlkSz;
+		const size_t newBlocksReq = (blk.Size + delta + BlkSz - 1) / BlkSz;
+		const size_t addBlocks = newBlocksReq - curBlocksReq;
+
+		if (addBlocks == 0)
+		{
+			blk.Size += delta;
+			return true;
+		}
+
+		// Blocks are handed out in order, so only the most recent allocation can grow
+		auto pBlockEnd = reinterpret_cast<unsigned char*>(blk.Ptr) + (BlkSz * curBlocksReq);
+		size_t blocksAvail = m_BlocksAvailable.load(std::memory_order_acquire);
+
+		while (blocksAvail >= addBlocks && GetBlockPointer(blocksAvail) == pBlockEnd)
+		{
+			// If the CAS succeeds, the additional blocks have been reserved
+			// If the CAS fails, blocksAvail will have been updated
+			if (m_BlocksAvailable.compare_exchange_weak(blocksAvail, blocksAvail - addBlocks))
+			{
+				blk.Size += delta;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	Blk AllocateAll() noexcept
 	{
 		// Attempt to reserve remaining memory
@@ -521,20 +578,21 @@ private:
 
 private:
 	A m_Allocator;
+	size_t m_NextFit;		// The block at which the next search for free blocks begins
 	mutable MutexType m_Mutex;
 
 protected:
 	LinearHeapPolicyImpl() noexcept(std::is_nothrow_default_constructible<A>::value)
-		: m_Allocator{ }, StoragePolicyType{ }
+		: StoragePolicyType{ }, m_Allocator{ }, m_NextFit{ 0 }
 	{ 
-		AllocateHeap(m_Allocator);
+		this->AllocateHeap(m_Allocator);
 	}
 
 	LinearHeapPolicyImpl(const Type&) = delete;
 
-	template<typename = std::enable_if_t<std::is_move_constructible<A>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<A>::value, Dummy>>
 	LinearHeapPolicyImpl(Type&& obj) noexcept(std::is_nothrow_move_constructible<A>::value)
-		: m_Allocator{std::move(obj.m_Allocator)}, StoragePolicyType{ std::move(obj) }
+		: StoragePolicyType{ std::move(obj) }, m_Allocator{std::move(obj.m_Allocator)}, m_NextFit{ 0 }
 	{ 
 		/* m_Allocator can be moved without locking since it's only used for preallocation. */
 		/* m_Heap requires a lock to move to ensure the heap pointer is never torn during a read. */
@@ -542,7 +600,8 @@ protected:
 		{	/* CS */
 			std::lock_guard<MutexType> lock(obj.m_Mutex);
 
-			std::swap(m_Heap, obj.m_Heap);
+			std::swap(this->m_Heap, obj.m_Heap);
+			std::swap(m_NextFit, obj.m_NextFit);
 		}
 	}
 
@@ -551,13 +610,13 @@ protected:
 
 	~LinearHeapPolicyImpl()
 	{
-		FreeHeap(m_Allocator);
+		this->FreeHeap(m_Allocator);
 	}
 
 protected:
 	constexpr void* GetBlockPointer(size_t block) const noexcept
 	{
-		return static_cast<void*>(reinterpret_cast<unsigned char*>(m_Heap.Ptr) + (BlkSz * block));
+		return static_cast<void*>(reinterpret_cast<unsigned char*>(this->m_Heap.Ptr) + (BlkSz * block));
 	}
 
 	constexpr size_t GetBlock(const void * const ptr) const noexcept
@@ -575,31 +634,39 @@ public:
 	{
 		/* m_Heap is never changed in a shared context, so no lock is required. */
 		auto pBlk = reinterpret_cast<const unsigned char*>(blk.Ptr);
-		auto pHeapStart = reinterpret_cast<const unsigned char*>(m_Heap.Ptr);
+		auto pHeapStart = reinterpret_cast<const unsigned char*>(this->m_Heap.Ptr);
 		auto pHeapEnd = reinterpret_cast<const unsigned char*>(GetBlockPointer(BlkCnt));
 
 		return (pBlk >= pHeapStart) && (pBlk < pHeapEnd);
 	}
 
+	Blk GetRegion() const noexcept
+	{
+		/* m_Heap is never changed in a shared context, so no lock is required. */
+		return{ this->m_Heap.Ptr, this->m_Heap ? BlkSz * BlkCnt : 0 };
+	}
+
 	Blk Allocate(size_t sz) noexcept
 	{
 		{	/* CS */
 			std::lock_guard<MutexType> lock(m_Mutex);
 			
 			// Verify heap memory
-			if (!m_Heap) return{ nullptr, 0 };
+			if (!this->m_Heap) return{ nullptr, 0 };
 
 			// Find a region of free blocks large enough to hold this allocation
-			auto pBitmap = GetBitmapPointer();
+			// (next fit: resume searching where the previous allocation ended)
+			auto pBitmap = this->GetBitmapPointer();
 
 			const size_t blocksReq = BytesToBlockSize(sz);
-			const size_t block = pBitmap->FindAvailable(blocksReq);
+			const size_t block = pBitmap->FindAvailable(blocksReq, m_NextFit);
 
 			if (block >= BlkCnt) return{ nullptr, 0 };
 
 			// Allocate the blocks
 			Blk blk{ GetBlockPointer(block), sz };
 			pBitmap->Set(block, blocksReq, true);
+			m_NextFit = block + blocksReq;
 
 			return blk;
 		}
@@ -612,7 +679,7 @@ public:
 			
 			assert(Owns(blk) && "LinearHeapInternalStoragePolicy::Reallocate - Attempted to reallocate a block that was not allocated by this allocator");
 
-			auto pBitmap = GetBitmapPointer();
+			auto pBitmap = this->GetBitmapPointer();
 
 			const size_t curBlock = GetBlock(blk.Ptr);
 			const size_t curBlocksReq = BytesToBlockSize(blk.Size);
@@ -629,14 +696,8 @@ public:
 			if (sz > blk.Size)
 			{
 				// Try in-place expansion
-				const size_t addBlocks = newBlocksReq - curBlocksReq;
-				if (pBitmap->HasAvailable(curBlock + curBlocksReq, addBlocks))
-				{
-					blk.Size = sz;
-					pBitmap->Set(curBlock + curBlocksReq, addBlocks, true);
-
+				if (Expand(blk, sz - blk.Size))
 					return true;
-				}
 
 				// Normal reallocation
 				return detail::Reallocator<Type>::ReallocateViaCopy(*this, blk, sz);
@@ -651,6 +712,34 @@ public:
 		}
 	}
 
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			const size_t curBlock = GetBlock(blk.Ptr);
+			const size_t curBlocksReq = BytesToBlockSize(blk.Size);
+			const size_t newBlocksReq = BytesToBlockSize(blk.Size + delta);
+
+			// Claim the neighbouring blocks if they're free
+			if (newBlocksReq > curBlocksReq)
+			{
+				auto pBitmap = this->GetBitmapPointer();
+				const size_t addBlocks = newBlocksReq - curBlocksReq;
+
+				if (curBlock + newBlocksReq > BlkCnt || 
+					!pBitmap->HasAvailable(curBlock + curBlocksReq, addBlocks))
+					return false;
+
+				pBitmap->Set(curBlock + curBlocksReq, addBlocks, true);
+			}
+
+			blk.Size += delta;
+
+			return true;
+		}
+	}
+
 public:
 	void Deallocate(const Blk& blk)
 	{
@@ -659,11 +748,11 @@ public:
 		{	/* CS */
 			std::lock_guard<MutexType> lock(m_Mutex);
 			
-			if (!m_Heap) return;
+			if (!this->m_Heap) return;
 
 			assert(Owns(blk) && "LinearHeapInternalStoragePolicy::Deallocate - Attempted to free a block that was not allocated by this allocator");
 
-			auto pBitmap = GetBitmapPointer();
+			auto pBitmap = this->GetBitmapPointer();
 			const size_t block = GetBlock(blk.Ptr);
 			const size_t blocksReq = BytesToBlockSize(blk.Size);
 
@@ -676,12 +765,13 @@ public:
 		{	/* CS */
 			std::lock_guard<MutexType> lock(m_Mutex);
 		
-			if (!m_Heap) return;
+			if (!this->m_Heap) return;
 
-			auto pBitmap = GetBitmapPointer();
-			const size_t bitmapBlocks = BytesToBlockSize(BitmapSize);
+			auto pBitmap = this->GetBitmapPointer();
+			const size_t bitmapBlocks = BytesToBlockSize(StoragePolicy::BitmapSize);
 
 			pBitmap->Unset(bitmapBlocks, BlkCnt - bitmapBlocks);
+			m_NextFit = 0;
 		}
 	}
 };
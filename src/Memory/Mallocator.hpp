@@ -48,7 +48,7 @@ public:
 
 public:
 	/* Returns whether or not this allocator is responsible for the block Blk. */
-	constexpr bool Owns(const Blk& blk) const noexcept
+	constexpr bool Owns(const Blk&) const noexcept
 	{
 		// We don't track allocated blocks and don't discriminate based on block size.
 		// Therefore, we can only return true here.
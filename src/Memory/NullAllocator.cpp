@@ -34,12 +34,14 @@ Blk NullAllocator::AllocateAligned(size_t /*sz*/, size_t /*alignment*/) const no
 bool NullAllocator::Reallocate(Blk& blk, size_t /*sz*/) const
 {
 	assert(blk.Ptr == nullptr && "NullAllocator::Reallocate - blk.Ptr must be null");
+	(void)blk;
 	return true;
 }
 
 bool NullAllocator::ReallocateAligned(Blk& blk, size_t /*sz*/, size_t /*alignment*/) const
 {
 	assert(blk.Ptr == nullptr && "NullAllocator::ReallocateAligned - blk.Ptr must be null");
+	(void)blk;
 	return true;
 }
 
@@ -56,11 +58,13 @@ Blk NullAllocator::AllocateAllAligned(size_t /*alignment*/) const noexcept
 void NullAllocator::Deallocate(Blk blk) const
 {
 	assert(blk.Ptr == nullptr && "NullAllocator::Deallocate - blk.Ptr must be null");
+	(void)blk;
 }
 
 void NullAllocator::DeallocateAligned(Blk blk) const
 {
 	assert(blk.Ptr == nullptr && "NullAllocator::DeallocateAligned - blk.Ptr must be null");
+	(void)blk;
 }
 
 void NullAllocator::DeallocateAll() const noexcept 
@@ -61,19 +61,19 @@ public:
 	constexpr SegregatorAllocator()
 		noexcept(std::is_nothrow_default_constructible<S>::value && std::is_nothrow_default_constructible<L>::value) = default;
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_copy_constructible<S>, std::is_copy_constructible<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_copy_constructible<S>, std::is_copy_constructible<L>>, Dummy>>
 	constexpr SegregatorAllocator(const Type& obj)
 		noexcept(std::is_nothrow_copy_constructible<S>::value && std::is_nothrow_copy_constructible<L>::value)
 		: m_SAllocator{ obj.m_SAllocator }, L{ obj.m_LAllocator }
 	{ }
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_move_constructible<S>, std::is_move_constructible<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_move_constructible<S>, std::is_move_constructible<L>>, Dummy>>
 	constexpr SegregatorAllocator(Type&& obj)
 		noexcept(std::is_nothrow_move_constructible<S>::value && std::is_nothrow_move_constructible<L>::value)
 		: m_SAllocator{ std::move(obj.m_SAllocator) }, m_LAllocator{ std::move(obj.m_LAllocator) }
 	{ }
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_copy_assignable<S>, std::is_copy_assignable<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_copy_assignable<S>, std::is_copy_assignable<L>>, Dummy>>
 	SegregatorAllocator& operator = (const Type& obj)
 		noexcept(std::is_nothrow_copy_assignable<S>::value && std::is_nothrow_copy_assignable<L>::value)
 	{
@@ -83,7 +83,7 @@ public:
 		return *this;
 	}
 
-	template<typename = std::enable_if_t<std::conjunction_v<std::is_move_assignable<S>, std::is_move_assignable<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<std::is_move_assignable<S>, std::is_move_assignable<L>>, Dummy>>
 	SegregatorAllocator& operator = (Type&& obj)
 		noexcept(std::is_nothrow_move_assignable<S>::value && std::is_nothrow_move_assignable<L>::value)
 	{
@@ -104,7 +104,7 @@ public:
 	/* Returns a block of uninitialized memory.
 	   The small allocator is used if sz is less than the threshold.
 	   Otherwise, the large allocator is used. */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanAllocate<S>, detail::CanAllocate<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanAllocate<S>, detail::CanAllocate<L>>, Dummy>>
 	Blk Allocate(size_t sz) noexcept
 	{
 		if constexpr (detail::CanAllocate<S>::value && detail::CanAllocate<L>::value)
@@ -128,7 +128,7 @@ public:
 	/* Returns a block of uninitialized memory (aligned to alignment).
 	   The small allocator is used if sz is less than the threshold.
 	   Otherwise, the large allocator is used. */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanAllocateAligned<S>, detail::CanAllocateAligned<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanAllocateAligned<S>, detail::CanAllocateAligned<L>>, Dummy>>
 	Blk AllocateAligned(size_t sz, size_t alignment = 0) noexcept
 	{
 		if constexpr (detail::CanAllocateAligned<S>::value && detail::CanAllocateAligned<L>::value)
@@ -299,9 +299,33 @@ public:
 		return true;
 	}
 
+	/* Attempts to grow blk in place by delta bytes.
+	   A block cannot grow from the small allocator into the large allocator. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanExpand<S>, detail::CanExpand<L>>, Dummy>>
+	bool Expand(Blk& blk, size_t delta)
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		if (blk.Size < T)
+		{
+			if constexpr (detail::CanExpand<S>::value)
+				return (delta < T - blk.Size) && m_SAllocator.Expand(blk, delta);
+			else
+				return false;
+		}
+		else
+		{
+			if constexpr (detail::CanExpand<L>::value)
+				return m_LAllocator.Expand(blk, delta);
+			else
+				return false;
+		}
+	}
+
 public:
 	/* Frees the memory for blk. */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanDeallocate<S>, detail::CanDeallocate<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanDeallocate<S>, detail::CanDeallocate<L>>, Dummy>>
 	void Deallocate(const Blk& blk)
 	{
 		if (blk.Size < T)
@@ -317,7 +341,7 @@ public:
 	}
 
 	/* Frees the memory for blk (blk needs to have been allocated with AllocateAligned) */
-	template<typename = std::enable_if_t<std::disjunction_v<detail::CanDeallocateAligned<S>, detail::CanDeallocateAligned<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::disjunction_v<detail::CanDeallocateAligned<S>, detail::CanDeallocateAligned<L>>, Dummy>>
 	void DeallocateAligned(const Blk& blk)
 	{
 		if (blk.Size < T)
@@ -333,7 +357,7 @@ public:
 	}
 
 	/* Frees all of the memory of both allocators. */
-	template<typename = std::enable_if_t<std::conjunction_v<detail::CanDeallocateAll<S>, detail::CanDeallocateAll<L>>>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::conjunction_v<detail::CanDeallocateAll<S>, detail::CanDeallocateAll<L>>, Dummy>>
 	void DeallocateAll() noexcept
 	{
 		m_SAllocator.DeallocateAll();
@@ -342,14 +366,14 @@ public:
 
 public:
 	/* Frees all of the memory in the small allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<S>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<S>::value, Dummy>>
 	void DeallocateAllSmall() noexcept
 	{
 		m_SAllocator.DeallocateAll();
 	}
 
 	/* Frees all of the memory in the large allocator. */
-	template<typename = std::enable_if_t<detail::CanDeallocateAll<L>::value>>
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<L>::value, Dummy>>
 	void DeallocateAllLarge() noexcept
 	{
 		m_LAllocator.DeallocateAll();
@@ -0,0 +1,612 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Memory/detail/AllocatorHelpers.hpp>
+#include <Epic/Memory/detail/AllocatorTraits.hpp>
+#include <Epic/Memory/MemoryBlock.hpp>
+#include <Epic/NullMutex.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	namespace detail
+	{
+		template<class Allocator, bool IsShared, size_t... SizeClasses>
+		class SlabAllocatorImpl;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// SlabAllocatorImpl<A, IsShared, SizeClasses...>
+//	A segregated allocator over a fixed set of block sizes.
+//	Requests are mapped to the smallest size class that fits through a constexpr lookup
+//	table (one load, no branching per class).  Each class draws its blocks from slabs of 
+//	SlabSize bytes acquired from A at SlabSize alignment, so the slab owning a block is
+//	found by masking its address.  A slab hands out blocks from its intrusive freelist
+//	(or its untouched tail) and tracks occupancy in a bitmap.
+//	An empty slab is returned to A unless it is the only slab of its class with free blocks.
+//	Slabs are doubly linked and indexed by address, so releasing a slab and Owns() take
+//	constant time regardless of how many slabs are live.
+template<class A, bool IsShared, size_t... SizeClasses>
+class Epic::detail::SlabAllocatorImpl
+{
+	static_assert(std::is_default_constructible<A>::value, "The slab backing allocator must be default-constructible.");
+	static_assert(detail::CanAllocateAligned<A>::value && detail::CanDeallocateAligned<A>::value,
+		"The slab backing allocator must be able to perform aligned allocations and deallocations.");
+	static_assert(!IsShared || (IsShared && A::IsShareable), "The slab backing allocator must be shareable.");
+	static_assert(sizeof...(SizeClasses) > 0 && sizeof...(SizeClasses) < 256, "Invalid number of size classes.");
+
+public:
+	using Type = Epic::detail::SlabAllocatorImpl<A, IsShared, SizeClasses...>;
+	using AllocatorType = A;
+
+private:
+	static constexpr size_t ClassCount = sizeof...(SizeClasses);
+	static constexpr std::array<size_t, ClassCount> ClassSizes = { SizeClasses... };
+
+	static constexpr bool IsAscending() noexcept
+	{
+		for (size_t i = 1; i < ClassCount; ++i)
+			if (ClassSizes[i] <= ClassSizes[i - 1]) return false;
+
+		return true;
+	}
+
+	static constexpr size_t CommonAlignment() noexcept
+	{
+		// The largest power of two (up to the default alignment) that divides every size class
+		size_t result = detail::DefaultAlignment;
+		
+		for (size_t sz : ClassSizes)
+			while (sz % result != 0) result >>= 1;
+
+		return result;
+	}
+
+	static_assert(IsAscending(), "The size classes must be listed in ascending order.");
+	static_assert(ClassSizes[0] >= sizeof(void*), "The smallest size class must be able to hold a pointer.");
+
+public:
+	static constexpr size_t Alignment = CommonAlignment();
+	static constexpr size_t MinAllocSize = 0;
+	static constexpr size_t MaxAllocSize = ClassSizes[ClassCount - 1];
+	static constexpr bool IsShareable = IsShared;
+
+private:
+	static constexpr size_t HeaderReserve = 1024;
+	static constexpr size_t MinBlocksPerSlab = 8;
+
+public:
+	static constexpr size_t SlabSize = std::max(size_t(64 * 1024), 
+		detail::RoundToPowerOfTwo(HeaderReserve + MinBlocksPerSlab * MaxAllocSize));
+
+private:
+	using BitmapWord = uint64_t;
+
+	static constexpr size_t BitsPerWord = sizeof(BitmapWord) * 8;
+	static constexpr size_t BitmapWords = (SlabSize / ClassSizes[0] + BitsPerWord - 1) / BitsPerWord;
+
+	struct Slab
+	{
+		Slab* pNext;				// The next slab of this size class
+		Slab* pPrev;				// The previous slab of this size class
+		Slab* pNextPartial;			// The next slab of this size class with free blocks
+		Slab* pPrevPartial;			// The previous slab of this size class with free blocks
+		void* pFree;				// The head of this slab's freelist
+		unsigned char* pUnused;		// The start of the never-allocated tail
+		uint32_t FreeCount;			// The number of blocks that are free (including the tail)
+		uint32_t ClassIndex;		// The size class of this slab's blocks
+		BitmapWord Occupied[BitmapWords];	// Bit n is set while block n is allocated
+	};
+
+	static constexpr size_t FirstBlockOffset = detail::RoundToAligned(sizeof(Slab), detail::DefaultAlignment);
+
+	static constexpr size_t BlockCount(size_t index) noexcept
+	{
+		return (SlabSize - FirstBlockOffset) / ClassSizes[index];
+	}
+
+	static_assert(BlockCount(ClassCount - 1) >= MinBlocksPerSlab, "The slab header is too large.");
+
+	// Requests are quantized to Alignment; every class size is a multiple of it
+	static constexpr size_t Quantum = Alignment;
+	static constexpr size_t LookupSize = MaxAllocSize / Quantum + 1;
+
+	static constexpr std::array<uint8_t, LookupSize> MakeLookupTable() noexcept
+	{
+		std::array<uint8_t, LookupSize> table{ };
+		size_t index = 0;
+
+		for (size_t q = 0; q < LookupSize; ++q)
+		{
+			while (ClassSizes[index] < q * Quantum) ++index;
+			table[q] = static_cast<uint8_t>(index);
+		}
+
+		return table;
+	}
+
+	static constexpr std::array<uint8_t, LookupSize> LookupTable = MakeLookupTable();
+
+	static inline size_t ClassOf(size_t sz) noexcept
+	{
+		assert(sz <= MaxAllocSize);
+		return LookupTable[(sz + Quantum - 1) / Quantum];
+	}
+
+private:
+	using MutexType = std::conditional_t<IsShared, std::mutex, Epic::NullMutex>;
+
+	struct SizeClass
+	{
+		Slab* pSlabs = nullptr;		// Every slab of this class
+		Slab* pPartial = nullptr;	// The slabs of this class with free blocks
+	};
+
+	static constexpr size_t MinIndexCapacity = 16;
+
+private:
+	A m_Allocator;
+	SizeClass m_Classes[ClassCount];
+	Blk m_Index;					// Open-addressed table of slab addresses
+	size_t m_IndexCount;			// The number of slabs in m_Index
+	mutable MutexType m_Mutex;
+
+public:
+	SlabAllocatorImpl() noexcept(std::is_nothrow_default_constructible<A>::value)
+		: m_Allocator{ }, m_Index{ nullptr, 0 }, m_IndexCount{ 0 }
+	{ }
+
+	SlabAllocatorImpl(const Type&) = delete;
+	SlabAllocatorImpl(Type&&) = delete;
+
+	SlabAllocatorImpl& operator = (const Type&) = delete;
+	SlabAllocatorImpl& operator = (Type&&) = delete;
+
+	~SlabAllocatorImpl()
+	{
+		DeallocateAll();
+
+		if (m_Index)
+			m_Allocator.DeallocateAligned(m_Index);
+	}
+
+private:
+	static inline Slab* SlabOf(const void* p) noexcept
+	{
+		return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(p) & ~(uintptr_t)(SlabSize - 1));
+	}
+
+	static inline unsigned char* FirstBlock(Slab* pSlab) noexcept
+	{
+		return reinterpret_cast<unsigned char*>(pSlab) + FirstBlockOffset;
+	}
+
+	static inline size_t BlockIndex(Slab* pSlab, const void* p) noexcept
+	{
+		return static_cast<size_t>(static_cast<const unsigned char*>(p) - FirstBlock(pSlab)) / ClassSizes[pSlab->ClassIndex];
+	}
+
+	static inline bool IsOccupied(Slab* pSlab, size_t block) noexcept
+	{
+		return (pSlab->Occupied[block / BitsPerWord] & (BitmapWord(1) << (block % BitsPerWord))) != 0;
+	}
+
+	static inline void SetOccupied(Slab* pSlab, size_t block, bool value) noexcept
+	{
+		if (value)
+			pSlab->Occupied[block / BitsPerWord] |= BitmapWord(1) << (block % BitsPerWord);
+		else
+			pSlab->Occupied[block / BitsPerWord] &= ~(BitmapWord(1) << (block % BitsPerWord));
+	}
+
+	static inline size_t GetIndexCapacity(const Blk& index) noexcept
+	{
+		return index.Size / sizeof(uintptr_t);
+	}
+
+	/* Returns the starting slot of the slab at address in the open-addressed index */
+	static inline size_t GetIndexSlot(uintptr_t address, size_t capacity) noexcept
+	{
+		return (address / SlabSize) & (capacity - 1);
+	}
+
+	/* Inserts a slab address into an index.  The index must have room for it. */
+	static void InsertIndex(Blk& index, size_t& count, uintptr_t address) noexcept
+	{
+		auto pIndex = static_cast<uintptr_t*>(index.Ptr);
+		const size_t capacity = GetIndexCapacity(index);
+		size_t slot = GetIndexSlot(address, capacity);
+
+		while (pIndex[slot] != 0)
+			slot = (slot + 1) & (capacity - 1);
+
+		pIndex[slot] = address;
+		++count;
+	}
+
+	/* Removes a slab address from the index */
+	void EraseIndex(uintptr_t address) noexcept
+	{
+		auto pIndex = static_cast<uintptr_t*>(m_Index.Ptr);
+		const size_t capacity = GetIndexCapacity(m_Index);
+		size_t slot = GetIndexSlot(address, capacity);
+
+		while (pIndex[slot] != address)
+			slot = (slot + 1) & (capacity - 1);
+
+		// Shift later entries of the probe run back so that lookups need no tombstones
+		for (size_t next = (slot + 1) & (capacity - 1); pIndex[next] != 0; next = (next + 1) & (capacity - 1))
+		{
+			const size_t home = GetIndexSlot(pIndex[next], capacity);
+
+			// Move the entry unless its home lies cyclically within (slot, next]
+			if (((next - home) & (capacity - 1)) >= ((next - slot) & (capacity - 1)))
+			{
+				pIndex[slot] = pIndex[next];
+				slot = next;
+			}
+		}
+
+		pIndex[slot] = 0;
+		--m_IndexCount;
+	}
+
+	/* Returns whether address is the address of one of this allocator's slabs */
+	bool HasIndex(uintptr_t address) const noexcept
+	{
+		if (m_IndexCount == 0)
+			return false;
+
+		const auto pIndex = static_cast<const uintptr_t*>(m_Index.Ptr);
+		const size_t capacity = GetIndexCapacity(m_Index);
+
+		for (size_t slot = GetIndexSlot(address, capacity); pIndex[slot] != 0; slot = (slot + 1) & (capacity - 1))
+		{
+			if (pIndex[slot] == address)
+				return true;
+		}
+
+		return false;
+	}
+
+	/* Ensures that the index has room for one more slab */
+	bool ReserveIndex() noexcept
+	{
+		const size_t capacity = GetIndexCapacity(m_Index);
+
+		// The index is kept at most half full
+		if (2 * (m_IndexCount + 1) <= capacity)
+			return true;
+
+		const size_t newCapacity = std::max(MinIndexCapacity, 2 * capacity);
+		Blk newIndex = m_Allocator.AllocateAligned(newCapacity * sizeof(uintptr_t), A::Alignment);
+		if (!newIndex)
+			return false;
+
+		newIndex.Size = newCapacity * sizeof(uintptr_t);
+		std::memset(newIndex.Ptr, 0, newIndex.Size);
+
+		size_t newCount = 0;
+
+		if (m_Index)
+		{
+			auto pIndex = static_cast<const uintptr_t*>(m_Index.Ptr);
+
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				if (pIndex[i] != 0)
+					InsertIndex(newIndex, newCount, pIndex[i]);
+			}
+
+			m_Allocator.DeallocateAligned(m_Index);
+		}
+
+		m_Index = newIndex;
+		m_IndexCount = newCount;
+
+		return true;
+	}
+
+	void LinkPartial(SizeClass& sc, Slab* pSlab) noexcept
+	{
+		pSlab->pPrevPartial = nullptr;
+		pSlab->pNextPartial = sc.pPartial;
+		
+		if (sc.pPartial) sc.pPartial->pPrevPartial = pSlab;
+		sc.pPartial = pSlab;
+	}
+
+	void UnlinkPartial(SizeClass& sc, Slab* pSlab) noexcept
+	{
+		if (pSlab->pPrevPartial) pSlab->pPrevPartial->pNextPartial = pSlab->pNextPartial;
+		else sc.pPartial = pSlab->pNextPartial;
+
+		if (pSlab->pNextPartial) pSlab->pNextPartial->pPrevPartial = pSlab->pPrevPartial;
+	}
+
+	Slab* CreateSlab(size_t index) noexcept
+	{
+		if (!ReserveIndex())
+			return nullptr;
+
+		Blk blk = m_Allocator.AllocateAligned(SlabSize, SlabSize);
+		if (!blk) return nullptr;
+
+		assert((reinterpret_cast<uintptr_t>(blk.Ptr) & (SlabSize - 1)) == 0);
+
+		InsertIndex(m_Index, m_IndexCount, reinterpret_cast<uintptr_t>(blk.Ptr));
+
+		auto pSlab = ::new (blk.Ptr) Slab;
+		pSlab->pFree = nullptr;
+		pSlab->pUnused = FirstBlock(pSlab);
+		pSlab->FreeCount = static_cast<uint32_t>(BlockCount(index));
+		pSlab->ClassIndex = static_cast<uint32_t>(index);
+		std::memset(pSlab->Occupied, 0, sizeof(pSlab->Occupied));
+
+		auto& sc = m_Classes[index];
+		pSlab->pPrev = nullptr;
+		pSlab->pNext = sc.pSlabs;
+
+		if (sc.pSlabs) sc.pSlabs->pPrev = pSlab;
+		sc.pSlabs = pSlab;
+		LinkPartial(sc, pSlab);
+
+		return pSlab;
+	}
+
+	void DestroySlab(Slab* pSlab) noexcept
+	{
+		auto& sc = m_Classes[pSlab->ClassIndex];
+
+		if (pSlab->pPrev) pSlab->pPrev->pNext = pSlab->pNext;
+		else sc.pSlabs = pSlab->pNext;
+
+		if (pSlab->pNext) pSlab->pNext->pPrev = pSlab->pPrev;
+
+		UnlinkPartial(sc, pSlab);
+		EraseIndex(reinterpret_cast<uintptr_t>(pSlab));
+		m_Allocator.DeallocateAligned(Blk{ pSlab, SlabSize });
+	}
+
+	void* PopBlock(size_t index) noexcept
+	{
+		auto& sc = m_Classes[index];
+
+		Slab* pSlab = sc.pPartial;
+		if (!pSlab && !(pSlab = CreateSlab(index)))
+			return nullptr;
+
+		void* p;
+
+		if (pSlab->pFree)
+		{
+			p = pSlab->pFree;
+			pSlab->pFree = *static_cast<void**>(p);
+		}
+		else
+		{
+			p = pSlab->pUnused;
+			pSlab->pUnused += ClassSizes[index];
+		}
+
+		SetOccupied(pSlab, BlockIndex(pSlab, p), true);
+
+		if (--pSlab->FreeCount == 0)
+			UnlinkPartial(sc, pSlab);
+
+		return p;
+	}
+
+	void PushBlock(void* p) noexcept
+	{
+		Slab* pSlab = SlabOf(p);
+		auto& sc = m_Classes[pSlab->ClassIndex];
+		const size_t block = BlockIndex(pSlab, p);
+
+		assert(IsOccupied(pSlab, block) && 
+			"SlabAllocator::Deallocate - Attempted to free a block that is not allocated");
+
+		SetOccupied(pSlab, block, false);
+		*static_cast<void**>(p) = pSlab->pFree;
+		pSlab->pFree = p;
+
+		if (pSlab->FreeCount++ == 0)
+			LinkPartial(sc, pSlab);
+
+		// Return empty slabs unless this is the last one with room
+		if (pSlab->FreeCount == BlockCount(pSlab->ClassIndex) && 
+			(sc.pPartial != pSlab || pSlab->pNextPartial != nullptr))
+			DestroySlab(pSlab);
+	}
+
+public:
+	/* Returns whether or not this allocator is responsible for the block Blk.
+	   The enclosing slab is found by masking the address and looked up in the slab index 
+	   (so foreign memory is never read), then its header must agree with the block. */
+	bool Owns(const Blk& blk) const noexcept
+	{
+		if (!blk || blk.Size > MaxAllocSize)
+			return false;
+
+		Slab* pSlab = SlabOf(blk.Ptr);
+
+		std::lock_guard<MutexType> lock(m_Mutex);
+
+		if (!HasIndex(reinterpret_cast<uintptr_t>(pSlab)))
+			return false;
+
+		const size_t offset = static_cast<size_t>(static_cast<const unsigned char*>(blk.Ptr) - FirstBlock(pSlab));
+
+		return pSlab->ClassIndex == ClassOf(blk.Size) && 
+			static_cast<const unsigned char*>(blk.Ptr) >= FirstBlock(pSlab) &&
+			offset % ClassSizes[pSlab->ClassIndex] == 0 &&
+			offset / ClassSizes[pSlab->ClassIndex] < BlockCount(pSlab->ClassIndex);
+	}
+
+public:
+	/* Returns a block of uninitialized memory from the smallest size class that fits sz. */
+	Blk Allocate(size_t sz) noexcept
+	{
+		// Verify that the requested size is within our allowed bounds
+		if (sz == 0 || sz > MaxAllocSize)
+			return{ nullptr, 0 };
+
+		const size_t index = ClassOf(sz);
+		void* p;
+
+		{ /* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+			p = PopBlock(index);
+		}
+
+		if (!p) return{ nullptr, 0 };
+
+		return{ p, sz };
+	}
+
+	/* Returns a block of uninitialized memory (aligned to 'alignment').
+	   Alignments above Alignment are only satisfied when the block's size class
+	   happens to preserve them, so they are rejected. */
+	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
+	{
+		if (!detail::IsGoodAlignment(alignment) || alignment > Alignment)
+			return{ nullptr, 0 };
+
+		return Allocate(sz);
+	}
+
+	/* Attempts to reallocate the memory of blk to the new size sz.
+	   Blocks stay in place while sz maps to the same size class. */
+	bool Reallocate(Blk& blk, size_t sz)
+	{
+		// If the block isn't valid, delegate to Allocate
+		if (!blk)
+			return (bool)(blk = Allocate(sz));
+
+		// If the requested size is zero, delegate to Deallocate
+		if (sz == 0)
+		{
+			Deallocate(blk);
+			blk = { nullptr, 0 };
+			return true;
+		}
+
+		assert(Owns(blk) && "SlabAllocator::Reallocate - Attempted to reallocate a block that was not allocated by this allocator");
+
+		// Verify that the requested size is within our allowed bounds
+		if (sz > MaxAllocSize)
+			return false;
+
+		if (ClassOf(sz) == ClassOf(blk.Size))
+		{
+			blk.Size = sz;
+			return true;
+		}
+
+		Blk newBlk = Allocate(sz);
+		if (!newBlk) return false;
+
+		std::memcpy(newBlk.Ptr, blk.Ptr, std::min(blk.Size, sz));
+		Deallocate(blk);
+
+		blk = newBlk;
+
+		return true;
+	}
+
+	/* Attempts to grow blk in place by delta bytes.
+	   Blocks can only grow within their size class. */
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		// Verify that the new size is within our allowed bounds
+		if (delta > MaxAllocSize - blk.Size)
+			return false;
+
+		if (ClassOf(blk.Size + delta) != ClassOf(blk.Size))
+			return false;
+
+		blk.Size += delta;
+
+		return true;
+	}
+
+public:
+	/* Frees the memory for blk. */
+	void Deallocate(const Blk& blk)
+	{
+		if (!blk) return;
+
+		assert(Owns(blk) && "SlabAllocator::Deallocate - Attempted to free a block that was not allocated by this allocator");
+
+		{ /* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+			PushBlock(blk.Ptr);
+		}
+	}
+
+	/* Frees the memory for blk. It must have been allocated through AllocateAligned(). */
+	void DeallocateAligned(const Blk& blk)
+	{
+		Deallocate(blk);
+	}
+
+	/* Frees all of the memory allocated by this allocator and returns every slab to A. */
+	void DeallocateAll() noexcept
+	{
+		std::lock_guard<MutexType> lock(m_Mutex);
+
+		for (auto& sc : m_Classes)
+		{
+			while (sc.pSlabs)
+			{
+				Slab* pSlab = sc.pSlabs;
+				sc.pSlabs = pSlab->pNext;
+				
+				m_Allocator.DeallocateAligned(Blk{ pSlab, SlabSize });
+			}
+
+			sc.pPartial = nullptr;
+		}
+
+		if (m_Index)
+			std::memset(m_Index.Ptr, 0, m_Index.Size);
+
+		m_IndexCount = 0;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<class Allocator, size_t... SizeClasses>
+	using SlabAllocator = detail::SlabAllocatorImpl<Allocator, false, SizeClasses...>;
+
+	template<class Allocator, size_t... SizeClasses>
+	using SharedSlabAllocator = detail::SlabAllocatorImpl<Allocator, true, SizeClasses...>;
+}
@@ -87,6 +87,12 @@ public:
 		return (blk.Ptr >= _Memory && blk.Ptr < _End());
 	}
 
+	/* Returns the range of memory from which this allocator's blocks are allocated. */
+	constexpr Blk GetRegion() const noexcept
+	{
+		return{ const_cast<unsigned char*>(_Memory), MemorySize };
+	}
+
 public:
 	/* Returns a block of uninitialized memory.
 	   If sz is zero, the returned block's pointer is null. */
@@ -130,6 +136,41 @@ public:
 		return result;
 	}
 
+public:
+	/* Attempts to grow blk in place by delta bytes.
+	   Only the last allocated block can grow. */
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		assert(Owns(blk) && "StackAllocator::Expand - Attempted to expand a block that was not allocated by this allocator");
+
+		auto pBlock = reinterpret_cast<unsigned char*>(blk.Ptr);
+
+		// Verify that this block was the last allocated block
+		if (pBlock + detail::RoundToAligned(blk.Size, Alignment) != _pCursor &&
+			pBlock + blk.Size != _End())
+			return false;
+
+		// Round the new size up so that subsequent allocations remain aligned
+		// unless the new size is all of the remaining memory
+		const size_t szavail = static_cast<size_t>(_End() - pBlock);
+		if (delta > szavail - blk.Size)
+			return false;
+
+		const size_t sz = blk.Size + delta;
+		const size_t sznew = (sz == szavail) ? szavail : detail::RoundToAligned(sz, Alignment);
+		
+		if (sznew > szavail)
+			return false;
+
+		_pCursor = pBlock + sznew;
+		blk.Size = sz;
+
+		return true;
+	}
+
 public:
 	/* If blk was the last allocated block, it will be freed.
 	   Otherwise, no memory will be reclaimed. */
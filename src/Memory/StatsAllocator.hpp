@@ -0,0 +1,552 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Memory/MemoryBlock.hpp>
+#include <Epic/Memory/detail/AllocatorTraits.hpp>
+#include <Epic/Memory/detail/AllocatorHelpers.hpp>
+#include <Epic/Memory/detail/HeapHelpers.hpp>
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#pragma intrinsic(_ReturnAddress)
+#define EPIC_STATS_CALLSITE() _ReturnAddress()
+#else
+#define EPIC_STATS_CALLSITE() __builtin_return_address(0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	enum class StatsFlags : uint32_t;
+
+	struct AllocatorStats;
+	struct AllocatorCallSite;
+
+	namespace detail
+	{
+		struct StatsShard;
+
+		template<size_t Capacity>
+		struct StatsCallSiteTable;
+
+		struct StatsNoCallSites { };
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// StatsFlags
+enum class Epic::StatsFlags : uint32_t
+{
+	None		= 0x00,
+	Counts		= 0x01,		// Allocation, deallocation, reallocation and failure counts
+	Bytes		= 0x02,		// Live and peak byte totals
+	Histogram	= 0x04,		// Requested sizes, bucketed by power of two
+	Owns		= 0x08,		// Calls to Owns()
+	CallSites	= 0x10,		// Allocation counts per calling address
+	
+	Default		= Counts | Bytes | Histogram | Owns,
+	All			= Default | CallSites
+};
+
+namespace Epic
+{
+	template<class Allocator, Epic::StatsFlags Flags = Epic::StatsFlags::Default>
+	class StatsAllocator;
+
+	constexpr Epic::StatsFlags operator | (Epic::StatsFlags a, Epic::StatsFlags b) noexcept
+	{
+		return static_cast<Epic::StatsFlags>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+	}
+
+	namespace detail
+	{
+		constexpr bool HasStatsFlag(Epic::StatsFlags flags, Epic::StatsFlags flag) noexcept
+		{
+			return (static_cast<uint32_t>(flags) & static_cast<uint32_t>(flag)) != 0;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// AllocatorStats
+//	A merged snapshot of a StatsAllocator's counters.
+struct Epic::AllocatorStats
+{
+	static constexpr size_t HistogramSize = sizeof(size_t) * 8;
+
+	uint64_t Allocations = 0;				// Successful allocations
+	uint64_t Deallocations = 0;				// Deallocations (DeallocateAll counts once)
+	uint64_t Reallocations = 0;				// Successful reallocations
+	uint64_t FailedAllocations = 0;			// Allocations and reallocations that returned failure
+	uint64_t OwnsCalls = 0;					// Calls to Owns()
+	int64_t LiveBytes = 0;					// Bytes currently allocated
+	int64_t PeakBytes = 0;					// Highest value LiveBytes has reached
+	uint64_t Histogram[HistogramSize] = { };	// Histogram[n] counts requests of [2^n, 2^(n+1)) bytes
+};
+
+/// AllocatorCallSite
+struct Epic::AllocatorCallSite
+{
+	const void* pAddress;					// The return address of the allocation call
+	uint64_t Allocations;					// Successful allocations made from pAddress
+	uint64_t Bytes;							// Bytes allocated from pAddress (not reduced by deallocation)
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// StatsShard
+//	One slice of a StatsAllocator's counters.  Threads are spread across the shards so
+//	that concurrent updates rarely share a cache line; the shards are summed on read.
+struct alignas(64) Epic::detail::StatsShard
+{
+	static constexpr size_t Count = 16;
+
+	std::atomic<uint64_t> Allocations{ 0 };
+	std::atomic<uint64_t> Deallocations{ 0 };
+	std::atomic<uint64_t> Reallocations{ 0 };
+	std::atomic<uint64_t> FailedAllocations{ 0 };
+	std::atomic<uint64_t> OwnsCalls{ 0 };
+	std::atomic<uint64_t> Histogram[Epic::AllocatorStats::HistogramSize] = { };
+
+	/* Returns the shard index assigned to the calling thread. */
+	static size_t Index() noexcept
+	{
+		static std::atomic<size_t> s_NextIndex{ 0 };
+		static thread_local const size_t t_Index = s_NextIndex.fetch_add(1, std::memory_order_relaxed) % Count;
+
+		return t_Index;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// StatsCallSiteTable<Capacity>
+//	A fixed-capacity, insert-only hash table of allocation call sites.
+//	Allocations from call sites that do not fit in the table are counted as overflow.
+template<size_t Capacity>
+struct Epic::detail::StatsCallSiteTable
+{
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "The call site capacity must be a power of two.");
+
+	struct Entry
+	{
+		std::atomic<const void*> pAddress{ nullptr };
+		std::atomic<uint64_t> Allocations{ 0 };
+		std::atomic<uint64_t> Bytes{ 0 };
+	};
+
+	Entry Entries[Capacity];
+	std::atomic<uint64_t> Overflow{ 0 };
+
+	/* Records an allocation of sz bytes from pAddress. */
+	void Record(const void* pAddress, size_t sz) noexcept
+	{
+		const size_t hash = (reinterpret_cast<uintptr_t>(pAddress) >> 2) * 0x9E3779B1u;
+
+		for (size_t i = 0; i < Capacity; ++i)
+		{
+			auto& entry = Entries[(hash + i) & (Capacity - 1)];
+			const void* pExisting = entry.pAddress.load(std::memory_order_acquire);
+
+			if (pExisting == nullptr)
+			{
+				// Claim the empty slot (or discover who beat us to it)
+				if (entry.pAddress.compare_exchange_strong(pExisting, pAddress, std::memory_order_acq_rel))
+					pExisting = pAddress;
+			}
+
+			if (pExisting == pAddress)
+			{
+				entry.Allocations.fetch_add(1, std::memory_order_relaxed);
+				entry.Bytes.fetch_add(sz, std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		Overflow.fetch_add(1, std::memory_order_relaxed);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// StatsAllocator<A, Flags>
+//	Forwards to A while recording what passes through it.
+//	Counters are sharded per thread and merged when read (see GetStats() and Dump()).
+//	StatsFlags::Bytes maintains a single shared live/peak total, as an exact peak
+//	cannot be recovered from sharded deltas; omit it where that contention matters.
+//	StatsFlags::CallSites keys allocations by return address.  When the allocator call
+//	is inlined, the address recorded is that of the caller's caller.
+template<class A, Epic::StatsFlags Flags>
+class Epic::StatsAllocator
+{
+	static_assert(std::is_default_constructible<A>::value, "The stats allocator must be default-constructible.");
+
+public:
+	using Type = Epic::StatsAllocator<A, Flags>;
+	using AllocatorType = A;
+
+public:
+	static constexpr size_t Alignment = A::Alignment;
+	static constexpr size_t MinAllocSize = A::MinAllocSize;
+	static constexpr size_t MaxAllocSize = A::MaxAllocSize;
+	static constexpr bool IsShareable = A::IsShareable;
+
+	static constexpr size_t CallSiteCapacity = 256;
+
+private:
+	static constexpr bool TrackCounts = detail::HasStatsFlag(Flags, StatsFlags::Counts);
+	static constexpr bool TrackBytes = detail::HasStatsFlag(Flags, StatsFlags::Bytes);
+	static constexpr bool TrackHistogram = detail::HasStatsFlag(Flags, StatsFlags::Histogram);
+	static constexpr bool TrackOwns = detail::HasStatsFlag(Flags, StatsFlags::Owns);
+	static constexpr bool TrackCallSites = detail::HasStatsFlag(Flags, StatsFlags::CallSites);
+
+	using Shard = detail::StatsShard;
+	using CallSiteTable = std::conditional_t<TrackCallSites, 
+		detail::StatsCallSiteTable<CallSiteCapacity>, detail::StatsNoCallSites>;
+
+private:
+	AllocatorType m_Allocator;
+	mutable Shard m_Shards[Shard::Count];
+	alignas(64) std::atomic<int64_t> m_LiveBytes;
+	std::atomic<int64_t> m_PeakBytes;
+	CallSiteTable m_CallSites;
+
+public:
+	StatsAllocator() noexcept(std::is_nothrow_default_constructible<A>::value)
+		: m_LiveBytes{ 0 }, m_PeakBytes{ 0 }
+	{ }
+
+	StatsAllocator(const Type&) = delete;
+	StatsAllocator(Type&&) = delete;
+
+	StatsAllocator& operator = (const Type&) = delete;
+	StatsAllocator& operator = (Type&&) = delete;
+
+private:
+	inline Shard& LocalShard() const noexcept
+	{
+		return m_Shards[Shard::Index()];
+	}
+
+	inline void AddLiveBytes(int64_t delta) noexcept
+	{
+		const int64_t live = m_LiveBytes.fetch_add(delta, std::memory_order_relaxed) + delta;
+		int64_t peak = m_PeakBytes.load(std::memory_order_relaxed);
+
+		while (live > peak && !m_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+	}
+
+	void OnAllocate(const Blk& blk, size_t sz, const void* pCallSite) noexcept
+	{
+		if (!blk)
+		{
+			if constexpr (TrackCounts)
+				LocalShard().FailedAllocations.fetch_add(1, std::memory_order_relaxed);
+
+			return;
+		}
+
+		if constexpr (TrackCounts)
+			LocalShard().Allocations.fetch_add(1, std::memory_order_relaxed);
+
+		if constexpr (TrackHistogram)
+			LocalShard().Histogram[detail::FloorLog2(sz)].fetch_add(1, std::memory_order_relaxed);
+
+		if constexpr (TrackBytes)
+			AddLiveBytes(static_cast<int64_t>(blk.Size));
+
+		if constexpr (TrackCallSites)
+			m_CallSites.Record(pCallSite, blk.Size);
+	}
+
+	void OnReallocate(bool succeeded, size_t szOld, size_t szNew) noexcept
+	{
+		if (!succeeded)
+		{
+			if constexpr (TrackCounts)
+				LocalShard().FailedAllocations.fetch_add(1, std::memory_order_relaxed);
+
+			return;
+		}
+
+		if constexpr (TrackCounts)
+			LocalShard().Reallocations.fetch_add(1, std::memory_order_relaxed);
+
+		if constexpr (TrackBytes)
+			AddLiveBytes(static_cast<int64_t>(szNew) - static_cast<int64_t>(szOld));
+	}
+
+	void OnDeallocate(const Blk& blk) noexcept
+	{
+		if constexpr (TrackCounts)
+			LocalShard().Deallocations.fetch_add(1, std::memory_order_relaxed);
+
+		if constexpr (TrackBytes)
+			AddLiveBytes(-static_cast<int64_t>(blk.Size));
+	}
+
+public:
+	/* Returns whether or not this allocator is responsible for the block Blk. */
+	inline bool Owns(const Blk& blk) const noexcept
+	{
+		if constexpr (TrackOwns)
+			LocalShard().OwnsCalls.fetch_add(1, std::memory_order_relaxed);
+
+		return m_Allocator.Owns(blk);
+	}
+
+public:
+	/* Returns a block of uninitialized memory. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocate<A>::value, Dummy>>
+	Blk Allocate(size_t sz) noexcept
+	{
+		if (sz == 0) return{ nullptr, 0 };
+
+		auto blk = m_Allocator.Allocate(sz);
+		OnAllocate(blk, sz, EPIC_STATS_CALLSITE());
+
+		return blk;
+	}
+
+	/* Returns a block of uninitialized memory (aligned to 'alignment'). */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAligned<A>::value, Dummy>>
+	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
+	{
+		if (sz == 0) return{ nullptr, 0 };
+
+		auto blk = m_Allocator.AllocateAligned(sz, alignment);
+		OnAllocate(blk, sz, EPIC_STATS_CALLSITE());
+
+		return blk;
+	}
+
+	/* Attempts to reallocate the memory of blk to the new size sz. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocate<A>::value, Dummy>>
+	bool Reallocate(Blk& blk, size_t sz)
+	{
+		const size_t szOld = blk.Size;
+		const bool result = m_Allocator.Reallocate(blk, sz);
+		OnReallocate(result, szOld, blk.Size);
+
+		return result;
+	}
+
+	/* Attempts to reallocate the memory of blk (aligned to 'alignment') to the new size sz. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanReallocateAligned<A>::value, Dummy>>
+	bool ReallocateAligned(Blk& blk, size_t sz, size_t alignment = Alignment)
+	{
+		const size_t szOld = blk.Size;
+		const bool result = m_Allocator.ReallocateAligned(blk, sz, alignment);
+		OnReallocate(result, szOld, blk.Size);
+
+		return result;
+	}
+
+	/* Attempts to grow blk in place by delta bytes. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanExpand<A>::value, Dummy>>
+	bool Expand(Blk& blk, size_t delta)
+	{
+		// A failed expansion is a normal outcome, so only successes are recorded
+		const size_t szOld = blk.Size;
+		if (!m_Allocator.Expand(blk, delta))
+			return false;
+
+		OnReallocate(true, szOld, blk.Size);
+
+		return true;
+	}
+
+	/* Returns a block of uninitialized memory using all of the remaining free memory. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAll<A>::value, Dummy>>
+	Blk AllocateAll() noexcept
+	{
+		auto blk = m_Allocator.AllocateAll();
+		OnAllocate(blk, blk.Size, EPIC_STATS_CALLSITE());
+
+		return blk;
+	}
+
+	/* Returns a block of uninitialized memory (aligned to 'alignment') using all of the remaining free memory. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanAllocateAllAligned<A>::value, Dummy>>
+	Blk AllocateAllAligned(size_t alignment = Alignment) noexcept
+	{
+		auto blk = m_Allocator.AllocateAllAligned(alignment);
+		OnAllocate(blk, blk.Size, EPIC_STATS_CALLSITE());
+
+		return blk;
+	}
+
+public:
+	/* Frees the memory for blk. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocate<A>::value, Dummy>>
+	void Deallocate(const Blk& blk)
+	{
+		if (!blk) return;
+
+		m_Allocator.Deallocate(blk);
+		OnDeallocate(blk);
+	}
+
+	/* Frees the memory for blk. It must have been allocated through AllocateAligned(). */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAligned<A>::value, Dummy>>
+	void DeallocateAligned(const Blk& blk)
+	{
+		if (!blk) return;
+
+		m_Allocator.DeallocateAligned(blk);
+		OnDeallocate(blk);
+	}
+
+	/* Frees all of the memory allocated by this allocator.
+	   The live byte total is reset to zero. */
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<detail::CanDeallocateAll<A>::value, Dummy>>
+	void DeallocateAll() noexcept
+	{
+		m_Allocator.DeallocateAll();
+
+		if constexpr (TrackCounts)
+			LocalShard().Deallocations.fetch_add(1, std::memory_order_relaxed);
+
+		if constexpr (TrackBytes)
+			m_LiveBytes.store(0, std::memory_order_relaxed);
+	}
+
+public:
+	/* Returns the wrapped allocator. */
+	inline const AllocatorType& GetAllocator() const noexcept
+	{
+		return m_Allocator;
+	}
+
+	/* Returns a snapshot of the counters, merged across all threads.
+	   Counters updated concurrently with this call may or may not be included. */
+	Epic::AllocatorStats GetStats() const noexcept
+	{
+		Epic::AllocatorStats stats;
+
+		for (const auto& shard : m_Shards)
+		{
+			stats.Allocations += shard.Allocations.load(std::memory_order_relaxed);
+			stats.Deallocations += shard.Deallocations.load(std::memory_order_relaxed);
+			stats.Reallocations += shard.Reallocations.load(std::memory_order_relaxed);
+			stats.FailedAllocations += shard.FailedAllocations.load(std::memory_order_relaxed);
+			stats.OwnsCalls += shard.OwnsCalls.load(std::memory_order_relaxed);
+
+			for (size_t i = 0; i < Epic::AllocatorStats::HistogramSize; ++i)
+				stats.Histogram[i] += shard.Histogram[i].load(std::memory_order_relaxed);
+		}
+
+		stats.LiveBytes = m_LiveBytes.load(std::memory_order_relaxed);
+		stats.PeakBytes = m_PeakBytes.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	/* Invokes fn(const AllocatorCallSite&) for each recorded call site.
+	   Returns the number of allocations that could not be attributed to a call site. */
+	template<class Function>
+	uint64_t ForEachCallSite(Function fn) const
+	{
+		if constexpr (TrackCallSites)
+		{
+			for (const auto& entry : m_CallSites.Entries)
+			{
+				const void* pAddress = entry.pAddress.load(std::memory_order_acquire);
+				if (pAddress == nullptr) continue;
+
+				fn(Epic::AllocatorCallSite
+				{
+					pAddress,
+					entry.Allocations.load(std::memory_order_relaxed),
+					entry.Bytes.load(std::memory_order_relaxed)
+				});
+			}
+
+			return m_CallSites.Overflow.load(std::memory_order_relaxed);
+		}
+		else
+			return 0;
+	}
+
+	/* Writes a human-readable report of the merged counters to 'os'. */
+	void Dump(std::ostream& os, const char* name = "StatsAllocator") const
+	{
+		const auto stats = GetStats();
+		const auto flags = os.flags();
+
+		os << name << '\n';
+
+		if constexpr (TrackCounts)
+		{
+			os << "  Allocations:   " << stats.Allocations << '\n'
+			   << "  Deallocations: " << stats.Deallocations << '\n'
+			   << "  Reallocations: " << stats.Reallocations << '\n'
+			   << "  Failures:      " << stats.FailedAllocations << '\n';
+		}
+
+		if constexpr (TrackOwns)
+			os << "  Owns Calls:    " << stats.OwnsCalls << '\n';
+
+		if constexpr (TrackBytes)
+		{
+			os << "  Live Bytes:    " << stats.LiveBytes << '\n'
+			   << "  Peak Bytes:    " << stats.PeakBytes << '\n';
+		}
+
+		if constexpr (TrackHistogram)
+		{
+			os << "  Size Histogram:\n";
+
+			for (size_t i = 0; i < Epic::AllocatorStats::HistogramSize; ++i)
+			{
+				if (stats.Histogram[i] == 0) continue;
+
+				os << "    [" << std::setw(12) << (size_t(1) << i) << ", ";
+
+				if (i + 1 < Epic::AllocatorStats::HistogramSize)
+					os << std::setw(12) << (size_t(1) << (i + 1));
+				else
+					os << std::setw(12) << "max";
+
+				os << "): " << stats.Histogram[i] << '\n';
+			}
+		}
+
+		if constexpr (TrackCallSites)
+		{
+			os << "  Call Sites:\n";
+
+			const auto overflow = ForEachCallSite([&](const Epic::AllocatorCallSite& site)
+			{
+				os << "    " << site.pAddress << ": " 
+				   << site.Allocations << " allocations, " 
+				   << site.Bytes << " bytes\n";
+			});
+
+			if (overflow > 0)
+				os << "    (untracked): " << overflow << " allocations\n";
+		}
+
+		os.flags(flags);
+	}
+};
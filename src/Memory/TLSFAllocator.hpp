@@ -0,0 +1,629 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Memory/detail/AllocatorHelpers.hpp>
+#include <Epic/Memory/detail/AllocatorTraits.hpp>
+#include <Epic/Memory/detail/HeapHelpers.hpp>
+#include <Epic/Memory/MemoryBlock.hpp>
+#include <Epic/NullMutex.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	namespace detail
+	{
+		template<class Allocator, size_t PoolSize, bool IsShared>
+		class TLSFAllocatorImpl;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// TLSFAllocatorImpl<A, PoolSz, IsShared>
+//	A two-level segregated fit allocator.
+//	A pool of PoolSz bytes is acquired from A on construction.  Free blocks are kept in
+//	segregated lists indexed by a first level (power-of-two size class) and a second level 
+//	(a linear subdivision of that class), with a bitmap over each level.  Allocate, Deallocate
+//	and in-place Reallocate are all O(1), and adjacent free blocks are coalesced immediately.
+//
+//	To use a TLSF pool as the system's default allocator:
+//		template<> struct Epic::Config<true>
+//		{
+//			using DefaultAllocator = Epic::SharedTLSFAllocator<Epic::Mallocator, 64 * 1024 * 1024>;
+//		};
+template<class A, size_t PoolSz, bool IsShared>
+class Epic::detail::TLSFAllocatorImpl
+{
+	static_assert(std::is_default_constructible<A>::value, "The TLSF backing allocator must be default-constructible.");
+	static_assert(detail::CanAllocate<A>::value || detail::CanAllocateAligned<A>::value,
+		"The TLSF backing allocator must be able to perform allocations.");
+
+public:
+	using Type = Epic::detail::TLSFAllocatorImpl<A, PoolSz, IsShared>;
+	using AllocatorType = A;
+
+private:
+	static constexpr size_t Log2(size_t value) noexcept
+	{
+		size_t result = 0;
+		while (value >>= 1) ++result;
+
+		return result;
+	}
+
+private:
+	struct BlockHeader
+	{
+		BlockHeader* pPrevPhys;		// The physically preceding block (null for the first block)
+		size_t Size;				// The size of this block's payload (low bits hold the flags below)
+
+		// Only valid while the block is free
+		BlockHeader* pNextFree;
+		BlockHeader* pPrevFree;
+	};
+
+	static constexpr size_t FreeFlag = 0x1;
+	static constexpr size_t PrevFreeFlag = 0x2;
+	static constexpr size_t FlagMask = FreeFlag | PrevFreeFlag;
+
+public:
+	static constexpr size_t Alignment = detail::DefaultAlignment;
+	static constexpr size_t PoolSize = PoolSz;
+	static constexpr bool IsShareable = IsShared;
+
+	static_assert(detail::IsGoodAlignment(Alignment) && Alignment > FlagMask, "Invalid TLSF alignment.");
+
+private:
+	static constexpr bool IsAligned = (A::Alignment % Alignment) != 0;
+
+	static_assert(!IsAligned || detail::CanAllocateAligned<A>::value,
+		"The TLSF backing allocator must support aligned allocations if its alignment is less than the TLSF alignment.");
+
+	// Blocks are laid out as [pPrevPhys, Size][Payload...]; free list links overlay the payload
+	static constexpr size_t HeaderSize = detail::RoundToAligned(2 * sizeof(void*), Alignment);
+	static constexpr size_t MinBlockSize = detail::RoundToAligned(sizeof(BlockHeader) - HeaderSize, Alignment) > 0 ?
+		detail::RoundToAligned(sizeof(BlockHeader) - HeaderSize, Alignment) : Alignment;
+
+	static constexpr size_t AlignmentLog2 = Log2(Alignment);
+	static constexpr size_t SLCountLog2 = 5;
+	static constexpr size_t SLCount = size_t(1) << SLCountLog2;
+
+	// Sizes below SmallBlockSize map linearly into first level 0
+	static constexpr size_t SmallBlockLog2 = SLCountLog2 + AlignmentLog2;
+	static constexpr size_t SmallBlockSize = size_t(1) << SmallBlockLog2;
+
+	static_assert(PoolSize >= 2 * HeaderSize + MinBlockSize, "The TLSF pool is too small.");
+
+public:
+	static constexpr size_t MinAllocSize = 0;
+	static constexpr size_t MaxAllocSize = ((PoolSize - 2 * HeaderSize) / Alignment) * Alignment;
+
+private:
+	static constexpr size_t FLCount = (Log2(MaxAllocSize) < SmallBlockLog2) ? 1 : (Log2(MaxAllocSize) - SmallBlockLog2 + 2);
+
+	static_assert(FLCount <= 64, "The TLSF pool is too large.");
+
+private:
+	using MutexType = std::conditional_t<IsShared, std::mutex, Epic::NullMutex>;
+
+private:
+	A m_Allocator;
+	Blk m_Pool;
+	uint64_t m_FLBitmap;					// Bit n is set when any list in first level n is non-empty
+	uint32_t m_SLBitmaps[FLCount];			// Bit m of entry n is set when list [n][m] is non-empty
+	BlockHeader* m_pFreeLists[FLCount][SLCount];
+	mutable MutexType m_Mutex;
+
+public:
+	TLSFAllocatorImpl() noexcept(std::is_nothrow_default_constructible<A>::value)
+		: m_Allocator{ }, m_Pool{ nullptr, 0 }
+	{
+		ResetLists();
+
+		if constexpr (IsAligned)
+			m_Pool = m_Allocator.AllocateAligned(PoolSize, Alignment);
+		else
+			m_Pool = m_Allocator.Allocate(PoolSize);
+
+		if (m_Pool)
+			ResetPool();
+	}
+
+	TLSFAllocatorImpl(const Type&) = delete;
+
+	template<typename Dummy = void, typename = Epic::TMP::DeferredEnableIfT<std::is_move_constructible<A>::value, Dummy>>
+	TLSFAllocatorImpl(Type&& obj) noexcept(std::is_nothrow_move_constructible<A>::value)
+		: m_Allocator{ std::move(obj.m_Allocator) }, m_Pool{ nullptr, 0 }
+	{
+		{	/* CS */
+			std::lock_guard<MutexType> lock(obj.m_Mutex);
+
+			// Block pointers are absolute, so the lists can be copied as-is
+			m_Pool = obj.m_Pool;
+			m_FLBitmap = obj.m_FLBitmap;
+			std::copy(std::begin(obj.m_SLBitmaps), std::end(obj.m_SLBitmaps), std::begin(m_SLBitmaps));
+			std::copy(&obj.m_pFreeLists[0][0], &obj.m_pFreeLists[0][0] + FLCount * SLCount, &m_pFreeLists[0][0]);
+
+			obj.m_Pool = { nullptr, 0 };
+			obj.ResetLists();
+		}
+	}
+
+	TLSFAllocatorImpl& operator = (const Type&) = delete;
+	TLSFAllocatorImpl& operator = (Type&&) = delete;
+
+	~TLSFAllocatorImpl()
+	{
+		if (!m_Pool) return;
+
+		if constexpr (IsAligned)
+		{
+			if constexpr (detail::CanDeallocateAligned<A>::value)
+				m_Allocator.DeallocateAligned(m_Pool);
+		}
+		else
+		{
+			if constexpr (detail::CanDeallocate<A>::value)
+				m_Allocator.Deallocate(m_Pool);
+		}
+	}
+
+private:
+	static inline size_t GetSize(const BlockHeader* pBlock) noexcept
+	{
+		return pBlock->Size & ~FlagMask;
+	}
+
+	static inline void SetSize(BlockHeader* pBlock, size_t sz) noexcept
+	{
+		pBlock->Size = sz | (pBlock->Size & FlagMask);
+	}
+
+	static inline bool IsFree(const BlockHeader* pBlock) noexcept
+	{
+		return (pBlock->Size & FreeFlag) != 0;
+	}
+
+	static inline bool IsPrevFree(const BlockHeader* pBlock) noexcept
+	{
+		return (pBlock->Size & PrevFreeFlag) != 0;
+	}
+
+	static inline void SetFlag(BlockHeader* pBlock, size_t flag, bool value) noexcept
+	{
+		if (value) 
+			pBlock->Size |= flag;
+		else 
+			pBlock->Size &= ~flag;
+	}
+
+	static inline void* GetPayload(const BlockHeader* pBlock) noexcept
+	{
+		return const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(pBlock) + HeaderSize);
+	}
+
+	static inline BlockHeader* GetHeader(const void* pPayload) noexcept
+	{
+		return reinterpret_cast<BlockHeader*>(const_cast<unsigned char*>(static_cast<const unsigned char*>(pPayload) - HeaderSize));
+	}
+
+	static inline BlockHeader* GetNextPhys(const BlockHeader* pBlock) noexcept
+	{
+		return reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(GetPayload(pBlock)) + GetSize(pBlock));
+	}
+
+	/* Rounds a requested size up to a valid block size */
+	static inline size_t AdjustSize(size_t sz) noexcept
+	{
+		return std::max(detail::RoundToAligned(sz, Alignment), MinBlockSize);
+	}
+
+private:
+	/* Calculates the list that a block of size sz belongs in */
+	static inline void MapInsert(size_t sz, size_t& fl, size_t& sl) noexcept
+	{
+		if (sz < SmallBlockSize)
+		{
+			fl = 0;
+			sl = sz >> AlignmentLog2;
+		}
+		else
+		{
+			const size_t log2 = detail::FloorLog2(sz);
+			
+			fl = log2 - SmallBlockLog2 + 1;
+			sl = (sz >> (log2 - SLCountLog2)) ^ SLCount;
+		}
+	}
+
+	/* Calculates the first list whose blocks are all at least sz bytes.
+	   Returns false if no such list exists. */
+	static inline bool MapSearch(size_t sz, size_t& fl, size_t& sl) noexcept
+	{
+		// Round up to the next list boundary
+		if (sz >= SmallBlockSize)
+			sz += (size_t(1) << (detail::FloorLog2(sz) - SLCountLog2)) - 1;
+
+		MapInsert(sz, fl, sl);
+
+		return fl < FLCount;
+	}
+
+	/* Finds a free block of at least sz bytes */
+	BlockHeader* FindFree(size_t sz) const noexcept
+	{
+		size_t fl, sl;
+
+		if (MapSearch(sz, fl, sl))
+		{
+			if (BlockHeader* pBlock = FindSuitable(fl, sl))
+				return pBlock;
+		}
+
+		// Every block in the lists searched above is large enough.  Failing that, the 
+		// head of the list that sz itself maps to may still be large enough (this matters 
+		// most for requests near MaxAllocSize, whose rounded size overflows the last list).
+		MapInsert(sz, fl, sl);
+
+		BlockHeader* pBlock = m_pFreeLists[fl][sl];
+		return (pBlock && GetSize(pBlock) >= sz) ? pBlock : nullptr;
+	}
+
+	/* Finds a free block from list [fl][sl] or the next larger non-empty list */
+	BlockHeader* FindSuitable(size_t fl, size_t sl) const noexcept
+	{
+		uint32_t slMap = m_SLBitmaps[fl] & (~uint32_t(0) << sl);
+
+		if (!slMap)
+		{
+			// Search the larger first levels
+			const uint64_t flMap = (fl + 1 < 64) ? (m_FLBitmap & (~uint64_t(0) << (fl + 1))) : 0;
+			if (!flMap)
+				return nullptr;
+
+			fl = detail::CountTrailingZeros(flMap);
+			slMap = m_SLBitmaps[fl];
+		}
+
+		sl = detail::CountTrailingZeros(slMap);
+
+		return m_pFreeLists[fl][sl];
+	}
+
+	void InsertFree(BlockHeader* pBlock) noexcept
+	{
+		size_t fl, sl;
+		MapInsert(GetSize(pBlock), fl, sl);
+
+		BlockHeader* pHead = m_pFreeLists[fl][sl];
+		
+		pBlock->pPrevFree = nullptr;
+		pBlock->pNextFree = pHead;
+
+		if (pHead)
+			pHead->pPrevFree = pBlock;
+
+		m_pFreeLists[fl][sl] = pBlock;
+		m_FLBitmap |= uint64_t(1) << fl;
+		m_SLBitmaps[fl] |= uint32_t(1) << sl;
+	}
+
+	void RemoveFree(BlockHeader* pBlock) noexcept
+	{
+		size_t fl, sl;
+		MapInsert(GetSize(pBlock), fl, sl);
+
+		if (pBlock->pPrevFree)
+			pBlock->pPrevFree->pNextFree = pBlock->pNextFree;
+		else
+			m_pFreeLists[fl][sl] = pBlock->pNextFree;
+
+		if (pBlock->pNextFree)
+			pBlock->pNextFree->pPrevFree = pBlock->pPrevFree;
+
+		if (!m_pFreeLists[fl][sl])
+		{
+			m_SLBitmaps[fl] &= ~(uint32_t(1) << sl);
+
+			if (!m_SLBitmaps[fl])
+				m_FLBitmap &= ~(uint64_t(1) << fl);
+		}
+	}
+
+	/* Marks pBlock as free (or used) and updates the following block's flag */
+	static inline void MarkFree(BlockHeader* pBlock, bool isFree) noexcept
+	{
+		BlockHeader* pNext = GetNextPhys(pBlock);
+
+		SetFlag(pBlock, FreeFlag, isFree);
+		SetFlag(pNext, PrevFreeFlag, isFree);
+		pNext->pPrevPhys = pBlock;
+	}
+
+	/* Splits the tail off of a block of at least sz bytes, if it is large enough to stand alone.
+	   The tail is returned (or null if no split occurred). */
+	static BlockHeader* Split(BlockHeader* pBlock, size_t sz) noexcept
+	{
+		const size_t blockSize = GetSize(pBlock);
+
+		if (blockSize < sz + HeaderSize + MinBlockSize)
+			return nullptr;
+
+		auto pTail = reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(GetPayload(pBlock)) + sz);
+		pTail->Size = blockSize - sz - HeaderSize;
+		pTail->pPrevPhys = pBlock;
+
+		SetSize(pBlock, sz);
+		SetFlag(pTail, PrevFreeFlag, IsFree(pBlock));
+
+		return pTail;
+	}
+
+	/* Merges the free block pNext into pBlock. */
+	static inline void Absorb(BlockHeader* pBlock, BlockHeader* pNext) noexcept
+	{
+		SetSize(pBlock, GetSize(pBlock) + HeaderSize + GetSize(pNext));
+	}
+
+	/* Frees pTail (the tail of a split), coalescing it with its following block */
+	void ReleaseTail(BlockHeader* pTail) noexcept
+	{
+		BlockHeader* pNext = GetNextPhys(pTail);
+
+		if (IsFree(pNext))
+		{
+			RemoveFree(pNext);
+			Absorb(pTail, pNext);
+		}
+
+		MarkFree(pTail, true);
+		InsertFree(pTail);
+	}
+
+	/* Resizes the used block pBlock to 'adjusted' bytes without moving it, growing into the
+	   following block if it is free.  Returns false if there isn't room. */
+	bool ResizeInPlace(BlockHeader* pBlock, size_t adjusted) noexcept
+	{
+		BlockHeader* pNext = GetNextPhys(pBlock);
+		const size_t blockSize = GetSize(pBlock);
+
+		const bool canResizeInPlace = (adjusted <= blockSize) || 
+			(IsFree(pNext) && (blockSize + HeaderSize + GetSize(pNext)) >= adjusted);
+
+		if (!canResizeInPlace)
+			return false;
+
+		// Grow into the following free block
+		if (adjusted > blockSize)
+		{
+			RemoveFree(pNext);
+			Absorb(pBlock, pNext);
+			MarkFree(pBlock, false);
+		}
+
+		// Return any unused tail to the pool
+		BlockHeader* pTail = Split(pBlock, adjusted);
+		if (pTail)
+			ReleaseTail(pTail);
+
+		return true;
+	}
+
+	void ResetLists() noexcept
+	{
+		m_FLBitmap = 0;
+		std::fill(std::begin(m_SLBitmaps), std::end(m_SLBitmaps), uint32_t(0));
+		std::fill(&m_pFreeLists[0][0], &m_pFreeLists[0][0] + FLCount * SLCount, nullptr);
+	}
+
+	void ResetPool() noexcept
+	{
+		ResetLists();
+
+		// One free block spanning the pool, followed by a zero-sized used sentinel
+		auto pBlock = static_cast<BlockHeader*>(m_Pool.Ptr);
+		pBlock->pPrevPhys = nullptr;
+		pBlock->Size = MaxAllocSize;
+
+		auto pSentinel = GetNextPhys(pBlock);
+		pSentinel->Size = 0;
+
+		MarkFree(pBlock, true);
+		InsertFree(pBlock);
+	}
+
+public:
+	/* Returns whether or not this allocator is responsible for the block Blk. */
+	bool Owns(const Blk& blk) const noexcept
+	{
+		/* m_Pool is never changed in a shared context, so no lock is required. */
+		auto pBlk = static_cast<const unsigned char*>(blk.Ptr);
+		auto pPoolStart = static_cast<const unsigned char*>(m_Pool.Ptr);
+
+		return (pBlk >= pPoolStart) && (pBlk < pPoolStart + m_Pool.Size);
+	}
+
+	/* Returns the range of memory from which this allocator's blocks are allocated. */
+	Blk GetRegion() const noexcept
+	{
+		return m_Pool;
+	}
+
+public:
+	/* Returns a block of uninitialized memory at least as big as sz.
+	   If sz is zero, the returned block's pointer is null. */
+	Blk Allocate(size_t sz) noexcept
+	{
+		// Verify that the requested size is within our allowed bounds
+		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
+			return{ nullptr, 0 };
+
+		const size_t adjusted = AdjustSize(sz);
+
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			BlockHeader* pBlock = FindFree(adjusted);
+			if (!pBlock)
+				return{ nullptr, 0 };
+
+			RemoveFree(pBlock);
+
+			// Return the unused tail to the pool
+			BlockHeader* pTail = Split(pBlock, adjusted);
+			if (pTail)
+			{
+				MarkFree(pTail, true);
+				InsertFree(pTail);
+			}
+
+			MarkFree(pBlock, false);
+
+			return{ GetPayload(pBlock), sz };
+		}
+	}
+
+	/* Attempts to reallocate the memory of blk to the new size sz.
+	   Shrinking, and growing into a following free block, are performed in place. */
+	bool Reallocate(Blk& blk, size_t sz)
+	{
+		// If the block isn't valid, delegate to Allocate
+		if (!blk)
+			return (bool)(blk = Allocate(sz));
+
+		// If the requested size is zero, delegate to Deallocate
+		if (sz == 0)
+		{
+			Deallocate(blk);
+			blk = { nullptr, 0 };
+			return true;
+		}
+
+		// Verify that the new requested size is within our allowed bounds
+		if (sz < MinAllocSize || sz > MaxAllocSize)
+			return false;
+
+		assert(Owns(blk) && "TLSFAllocator::Reallocate - Attempted to reallocate a block that was not allocated by this allocator");
+
+		const size_t adjusted = AdjustSize(sz);
+
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			if (ResizeInPlace(GetHeader(blk.Ptr), adjusted))
+			{
+				blk.Size = sz;
+				return true;
+			}
+		}
+
+		// Normal reallocation (outside of the lock, as it will reenter Allocate and Deallocate)
+		return detail::Reallocator<Type>::ReallocateViaCopy(*this, blk, sz);
+	}
+
+	/* Attempts to grow blk in place by delta bytes, absorbing the following block if it is free. */
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		// Verify that the new size is within our allowed bounds
+		if (delta > MaxAllocSize - blk.Size)
+			return false;
+
+		assert(Owns(blk) && "TLSFAllocator::Expand - Attempted to expand a block that was not allocated by this allocator");
+
+		const size_t sz = blk.Size + delta;
+		const size_t adjusted = AdjustSize(sz);
+
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			if (!ResizeInPlace(GetHeader(blk.Ptr), adjusted))
+				return false;
+		}
+
+		blk.Size = sz;
+
+		return true;
+	}
+
+public:
+	/* Reclaims blk's memory back into the pool. */
+	void Deallocate(const Blk& blk)
+	{
+		if (!blk) return;
+
+		assert(Owns(blk) && "TLSFAllocator::Deallocate - Attempted to free a block that was not allocated by this allocator");
+
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			BlockHeader* pBlock = GetHeader(blk.Ptr);
+			assert(!IsFree(pBlock) && "TLSFAllocator::Deallocate - Attempted to free a block that is already free");
+
+			// Coalesce with the preceding block
+			if (IsPrevFree(pBlock))
+			{
+				BlockHeader* pPrev = pBlock->pPrevPhys;
+
+				RemoveFree(pPrev);
+				Absorb(pPrev, pBlock);
+				pBlock = pPrev;
+			}
+
+			// Coalesce with the following block
+			BlockHeader* pNext = GetNextPhys(pBlock);
+			if (IsFree(pNext))
+			{
+				RemoveFree(pNext);
+				Absorb(pBlock, pNext);
+			}
+
+			MarkFree(pBlock, true);
+			InsertFree(pBlock);
+		}
+	}
+
+	/* Frees all of the memory back into the pool. */
+	void DeallocateAll() noexcept
+	{
+		{	/* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			if (m_Pool)
+				ResetPool();
+		}
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	/// TLSFAllocator<Allocator, PoolSize>
+	template<class Allocator, size_t PoolSize>
+	using TLSFAllocator = detail::TLSFAllocatorImpl<Allocator, PoolSize, false>;
+
+	/// SharedTLSFAllocator<Allocator, PoolSize>
+	template<class Allocator, size_t PoolSize>
+	using SharedTLSFAllocator = detail::TLSFAllocatorImpl<Allocator, PoolSize, true>;
+}
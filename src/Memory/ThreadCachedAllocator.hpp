@@ -0,0 +1,257 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Memory/detail/AllocatorHelpers.hpp>
+#include <Epic/Memory/detail/AllocatorTraits.hpp>
+#include <Epic/Memory/GlobalAllocator.hpp>
+#include <Epic/Memory/MemoryBlock.hpp>
+#include <Epic/Singleton.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<class Allocator, size_t MagazineSize = 32, class Tag = Epic::detail::GlobalAllocatorTag>
+	class ThreadCachedAllocator;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// ThreadCachedAllocator<A, MagazineSize, Tag>
+//	A front-end for a shared fixed-size block allocator (e.g. SharedFreelistAllocator).
+//	Each thread keeps a magazine of free blocks that is refilled from and spilled to
+//	the shared allocator MagazineSize blocks at a time, so the shared lock is taken
+//	once per batch rather than once per allocation.
+//	Blocks are interchangeable, so a block freed on a thread other than the one that
+//	allocated it simply joins the freeing thread's magazine.
+//	Like GlobalAllocator, the shared allocator is the Singleton<A, Tag> instance.
+template<class A, size_t MagazineSize, class Tag_>
+class Epic::ThreadCachedAllocator
+{
+	static_assert(std::is_default_constructible<A>::value, "The cached allocator must be default-constructible.");
+	static_assert(A::IsShareable, "The cached allocator must be shareable.");
+	static_assert(detail::CanAllocate<A>::value && detail::CanDeallocate<A>::value,
+		"The cached allocator must be able to perform allocations and deallocations.");
+	static_assert(MagazineSize > 0, "The magazine size must be greater than zero.");
+
+public:
+	using Type = Epic::ThreadCachedAllocator<A, MagazineSize, Tag_>;
+	using AllocatorType = A;
+	using Tag = Tag_;
+
+public:
+	static constexpr size_t Alignment = A::Alignment;
+	static constexpr size_t MinAllocSize = A::MinAllocSize;
+	static constexpr size_t MaxAllocSize = A::MaxAllocSize;
+	static constexpr bool IsShareable = true;
+
+	static constexpr size_t BlockSize = A::BlockSize;
+	static constexpr size_t BatchSize = MagazineSize;
+
+private:
+	static constexpr size_t MagazineCapacity = 2 * BatchSize;
+
+private:
+	using SingletonAllocatorType = Epic::Singleton<A, Tag>;
+
+private:
+	struct Magazine
+	{
+		void* pBlocks[MagazineCapacity];
+		size_t Count = 0;
+
+		~Magazine()
+		{
+			// Return this thread's blocks when it exits
+			Spill(*this, Count);
+		}
+	};
+
+private:
+	A* m_pAllocator;
+
+public:
+	ThreadCachedAllocator() noexcept
+		: m_pAllocator{ &Type::Allocator() }
+	{ }
+
+	ThreadCachedAllocator(const Type& obj) = default;
+	ThreadCachedAllocator(Type&& obj) = default;
+
+	ThreadCachedAllocator& operator = (const Type& obj) = default;
+	ThreadCachedAllocator& operator = (Type&& obj) = default;
+
+private:
+	static Magazine& ThreadMagazine() noexcept
+	{
+		static thread_local Magazine t_Magazine;
+		return t_Magazine;
+	}
+
+	/* Moves up to BatchSize blocks from the shared allocator into the magazine.
+	   Returns whether or not any blocks were acquired. */
+	static bool Refill(Magazine& magazine) noexcept
+	{
+		Blk blocks[BatchSize];
+		size_t count = 0;
+
+		if constexpr (detail::CanAllocateBatch<A>::value)
+			count = Allocator().AllocateBatch(blocks, BatchSize);
+		else
+		{
+			for (; count < BatchSize; ++count)
+			{
+				blocks[count] = Allocator().Allocate(BlockSize);
+				if (!blocks[count]) break;
+			}
+		}
+
+		for (size_t i = 0; i < count; ++i)
+			magazine.pBlocks[magazine.Count++] = blocks[i].Ptr;
+
+		return count > 0;
+	}
+
+	/* Moves the count most recently freed blocks from the magazine to the shared allocator. */
+	static void Spill(Magazine& magazine, size_t count)
+	{
+		while (count > 0)
+		{
+			Blk blocks[BatchSize];
+			const size_t n = std::min(count, BatchSize);
+
+			for (size_t i = 0; i < n; ++i)
+				blocks[i] = { magazine.pBlocks[--magazine.Count], BlockSize };
+
+			if constexpr (detail::CanDeallocateBatch<A>::value)
+				Allocator().DeallocateBatch(blocks, n);
+			else
+			{
+				for (size_t i = 0; i < n; ++i)
+					Allocator().Deallocate(blocks[i]);
+			}
+
+			count -= n;
+		}
+	}
+
+	Blk PopBlock() noexcept
+	{
+		auto& magazine = ThreadMagazine();
+
+		if (magazine.Count == 0 && !Refill(magazine))
+			return{ nullptr, 0 };
+
+		return{ magazine.pBlocks[--magazine.Count], BlockSize };
+	}
+
+	void PushBlock(const Blk& blk)
+	{
+		auto& magazine = ThreadMagazine();
+
+		// Spill half of a full magazine, keeping the older blocks cached
+		if (magazine.Count == MagazineCapacity)
+			Spill(magazine, BatchSize);
+
+		// If the blk was allocated aligned, the alignment must be removed
+		const size_t alignPad = BlockSize - blk.Size;
+		magazine.pBlocks[magazine.Count++] = reinterpret_cast<unsigned char*>(blk.Ptr) - alignPad;
+	}
+
+public:
+	/* Returns whether or not this allocator is responsible for the block Blk. */
+	inline bool Owns(const Blk& blk) const noexcept
+	{
+		return m_pAllocator->Owns(blk);
+	}
+
+public:
+	/* Returns a block of uninitialized memory at least as big as sz.
+	   If sz is zero, the returned block's pointer is null. */
+	Blk Allocate(size_t sz) noexcept
+	{
+		// Verify that the requested size is within our allowed bounds
+		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
+			return{ nullptr, 0 };
+
+		return PopBlock();
+	}
+
+	/* Returns a block of uninitialized memory at least as big as sz (aligned to alignment).
+	   If sz is zero, the returned block's pointer is null. */
+	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
+	{
+		// Verify that the alignment is acceptable
+		if (!detail::IsGoodAlignment(alignment))
+			return{ nullptr, 0 };
+
+		// Verify that the requested size is within our allowed bounds
+		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
+			return{ nullptr, 0 };
+
+		Blk result = PopBlock();
+
+		// Attempt to calculate an aligned pointer within the block.
+		// NOTE: std::align will fail for invalid blocks, so no need to validate it
+		size_t space = result.Size;
+		void* pAligned = result.Ptr;
+
+		if (std::align(alignment, sz, pAligned, space))
+			return{ pAligned, space };
+
+		// Alignment failed; return the block to the magazine.
+		if (result)
+			PushBlock(result);
+
+		return{ nullptr, 0 };
+	}
+
+public:
+	/* Returns blk's memory to the calling thread's magazine. */
+	void Deallocate(const Blk& blk)
+	{
+		if (!blk) return;
+
+		assert(Owns(blk) && "ThreadCachedAllocator::Deallocate - Attempted to free a block that was not allocated by this allocator");
+		PushBlock(blk);
+	}
+
+	/* Returns blk's memory to the calling thread's magazine. */
+	void DeallocateAligned(const Blk& blk)
+	{
+		if (!blk) return;
+
+		assert(Owns(blk) && "ThreadCachedAllocator::DeallocateAligned - Attempted to free a block that was not allocated by this allocator");
+		PushBlock(blk);
+	}
+
+public:
+	/* Returns the calling thread's cached blocks to the shared allocator. */
+	static void Flush()
+	{
+		auto& magazine = ThreadMagazine();
+		Spill(magazine, magazine.Count);
+	}
+
+	static A& Allocator() noexcept
+	{
+		return SingletonAllocatorType::Instance();
+	}
+};
@@ -0,0 +1,375 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Memory/MemoryBlock.hpp>
+#include <Epic/Memory/detail/AllocatorHelpers.hpp>
+#include <Epic/Memory/detail/VirtualMemory.hpp>
+#include <Epic/NullMutex.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	namespace detail
+	{
+		template<size_t ReserveSize, bool UseHugePages, bool IsShared>
+		class VirtualMemoryAllocatorImpl;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// VirtualMemoryAllocatorImpl<ReserveSz, UseHugePages, IsShared>
+//	Reserves ReserveSz bytes of address space on construction and hands it out
+//	linearly, committing pages in CommitSize steps as the cursor advances.
+//	Like StackAllocator, only the most recent allocation is reclaimed by Deallocate().
+//	Other blocks have their pages discarded (returned to the OS) but their addresses
+//	are not reused until DeallocateAll(), which decommits everything.
+//	When UseHugePages is set the range is aligned to, and committed in, huge pages
+//	and the OS is asked to back it with them (MADV_HUGEPAGE; ignored on Windows).
+//	Blocks are aligned to, and sized in, the OS page size queried at construction.
+//	Alignment is the smallest page size supported, so it holds on every platform.
+template<size_t ReserveSz, bool UseHugePages, bool IsShared>
+class Epic::detail::VirtualMemoryAllocatorImpl
+{
+public:
+	using Type = Epic::detail::VirtualMemoryAllocatorImpl<ReserveSz, UseHugePages, IsShared>;
+
+public:
+	static constexpr size_t Alignment = 4096;	// Lower bound; see GetPageSize()
+	static constexpr size_t MinAllocSize = 0;
+	static constexpr size_t MaxAllocSize = ReserveSz;
+	static constexpr size_t ReserveSize = ReserveSz;
+	static constexpr size_t CommitSize = UseHugePages ? detail::HugePageSize : 64 * 1024;
+	static constexpr bool IsShareable = IsShared;
+
+	static_assert(ReserveSize > 0 && ReserveSize % CommitSize == 0,
+		"The reserve size must be a multiple of the commit size.");
+
+private:
+	using MutexType = std::conditional_t<IsShared, std::mutex, Epic::NullMutex>;
+
+private:
+	size_t m_PageSize;				// The granularity of blocks (the OS page size)
+	unsigned char* m_pBase;			// The start of the reserved range
+	unsigned char* m_pCursor;		// The start of the unallocated range
+	unsigned char* m_pCommitted;	// The end of the committed range
+	mutable MutexType m_Mutex;
+
+public:
+	VirtualMemoryAllocatorImpl() noexcept
+		: m_PageSize{ std::max(Alignment, detail::VirtualPageSize()) }, 
+		  m_pBase{ nullptr }, m_pCursor{ nullptr }, m_pCommitted{ nullptr }
+	{
+		m_pBase = static_cast<unsigned char*>(detail::VirtualReserve(ReserveSize, UseHugePages ? detail::HugePageSize : m_PageSize));
+		m_pCursor = m_pCommitted = m_pBase;
+
+		if (m_pBase && UseHugePages)
+			detail::VirtualAdviseHugePages(m_pBase, ReserveSize);
+	}
+
+	VirtualMemoryAllocatorImpl(const Type&) = delete;
+
+	VirtualMemoryAllocatorImpl(Type&& obj) noexcept
+	{
+		std::lock_guard<MutexType> lock(obj.m_Mutex);
+
+		m_PageSize = obj.m_PageSize;
+		m_pBase = obj.m_pBase;
+		m_pCursor = obj.m_pCursor;
+		m_pCommitted = obj.m_pCommitted;
+
+		obj.m_pBase = obj.m_pCursor = obj.m_pCommitted = nullptr;
+	}
+
+	VirtualMemoryAllocatorImpl& operator = (const Type&) = delete;
+	VirtualMemoryAllocatorImpl& operator = (Type&&) = delete;
+
+	~VirtualMemoryAllocatorImpl()
+	{
+		detail::VirtualRelease(m_pBase, ReserveSize);
+	}
+
+private:
+	inline unsigned char* End() const noexcept
+	{
+		return m_pBase + ReserveSize;
+	}
+
+	/* Commits pages so that [m_pBase, pEnd) is accessible. */
+	bool CommitTo(unsigned char* pEnd) noexcept
+	{
+		if (pEnd <= m_pCommitted)
+			return true;
+
+		auto pNewCommitted = std::min(End(), m_pBase + 
+			detail::RoundToAligned(static_cast<size_t>(pEnd - m_pBase), std::max(CommitSize, m_PageSize)));
+		
+		if (!detail::VirtualCommit(m_pCommitted, static_cast<size_t>(pNewCommitted - m_pCommitted)))
+			return false;
+
+		m_pCommitted = pNewCommitted;
+
+		return true;
+	}
+
+	/* Returns the whole pages inside [pBegin, pEnd) to the OS. */
+	void Discard(unsigned char* pBegin, unsigned char* pEnd) const noexcept
+	{
+		const auto begin = detail::RoundToAligned(reinterpret_cast<uintptr_t>(pBegin), m_PageSize);
+		const auto end = reinterpret_cast<uintptr_t>(pEnd) & ~(uintptr_t)(m_PageSize - 1);
+
+		if (end > begin)
+			detail::VirtualDiscard(reinterpret_cast<void*>(begin), end - begin);
+	}
+
+	Blk AllocateImpl(size_t sz, size_t alignment) noexcept
+	{
+		// Verify that the requested size is within our allowed bounds
+		if (sz == 0 || sz < MinAllocSize || sz > MaxAllocSize)
+			return{ nullptr, 0 };
+
+		const size_t szActual = detail::RoundToAligned(sz, m_PageSize);
+
+		{ /* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			if (!m_pBase)
+				return{ nullptr, 0 };
+
+			const size_t offset = detail::RoundToAligned(static_cast<size_t>(m_pCursor - m_pBase), alignment);
+			
+			// Verify that the request fits in the remaining reservation
+			if (offset > ReserveSize || szActual > ReserveSize - offset)
+				return{ nullptr, 0 };
+
+			auto p = m_pBase + offset;
+
+			if (!CommitTo(p + szActual))
+				return{ nullptr, 0 };
+
+			m_pCursor = p + szActual;
+
+			return{ p, sz };
+		}
+	}
+
+public:
+	/* Returns whether or not this allocator is responsible for the block Blk. */
+	inline bool Owns(const Blk& blk) const noexcept
+	{
+		return blk.Ptr >= m_pBase && blk.Ptr < End();
+	}
+
+	/* Returns the range of memory reserved by this allocator. */
+	inline Blk GetRegion() const noexcept
+	{
+		return{ m_pBase, m_pBase ? ReserveSize : 0 };
+	}
+
+	/* Returns the alignment and size granularity of blocks (the OS page size, at least Alignment). */
+	inline size_t GetPageSize() const noexcept
+	{
+		return m_PageSize;
+	}
+
+public:
+	/* Returns a block of uninitialized memory.
+	   Its address is aligned to a page. */
+	Blk Allocate(size_t sz) noexcept
+	{
+		return AllocateImpl(sz, m_PageSize);
+	}
+
+	/* Returns a block of uninitialized memory (aligned to 'alignment'). */
+	Blk AllocateAligned(size_t sz, size_t alignment = Alignment) noexcept
+	{
+		// Verify that the alignment is acceptable
+		if (!detail::IsGoodAlignment(alignment))
+			return{ nullptr, 0 };
+
+		return AllocateImpl(sz, std::max(alignment, m_PageSize));
+	}
+
+	/* Attempts to reallocate the memory of blk to the new size sz.
+	   The most recent allocation is resized in place.  Other blocks are shrunk in
+	   place or moved to a new block. */
+	bool Reallocate(Blk& blk, size_t sz)
+	{
+		// If the block isn't valid, delegate to Allocate
+		if (!blk)
+			return (bool)(blk = Allocate(sz));
+
+		// If the requested size is zero, delegate to Deallocate
+		if (sz == 0)
+		{
+			Deallocate(blk);
+			blk = { nullptr, 0 };
+			return true;
+		}
+
+		assert(Owns(blk) && "VirtualMemoryAllocator::Reallocate - Attempted to reallocate a block that was not allocated by this allocator");
+
+		// Verify that the requested size is within our allowed bounds
+		if (sz < MinAllocSize || sz > MaxAllocSize)
+			return false;
+
+		auto pBlock = static_cast<unsigned char*>(blk.Ptr);
+		const size_t szOld = detail::RoundToAligned(blk.Size, m_PageSize);
+		const size_t szNew = detail::RoundToAligned(sz, m_PageSize);
+
+		{ /* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			if (pBlock + szOld == m_pCursor)
+			{
+				// The most recent allocation can grow or shrink in place
+				if (szNew > static_cast<size_t>(End() - pBlock) || !CommitTo(pBlock + szNew))
+					return false;
+
+				m_pCursor = pBlock + szNew;
+				blk.Size = sz;
+
+				return true;
+			}
+		}
+
+		if (szNew <= szOld)
+		{
+			Discard(pBlock + szNew, pBlock + szOld);
+			blk.Size = sz;
+
+			return true;
+		}
+
+		// Move the block
+		Blk newBlk = Allocate(sz);
+		if (!newBlk) return false;
+
+		std::memcpy(newBlk.Ptr, blk.Ptr, blk.Size);
+		Deallocate(blk);
+
+		blk = newBlk;
+
+		return true;
+	}
+
+	/* Attempts to grow blk in place by delta bytes.
+	   Only the most recent allocation can grow. */
+	bool Expand(Blk& blk, size_t delta) noexcept
+	{
+		if (delta == 0) return true;
+		if (!blk) return false;
+
+		// Verify that the new size is within our allowed bounds
+		if (delta > MaxAllocSize - blk.Size)
+			return false;
+
+		assert(Owns(blk) && "VirtualMemoryAllocator::Expand - Attempted to expand a block that was not allocated by this allocator");
+
+		auto pBlock = static_cast<unsigned char*>(blk.Ptr);
+		const size_t szOld = detail::RoundToAligned(blk.Size, m_PageSize);
+		const size_t szNew = detail::RoundToAligned(blk.Size + delta, m_PageSize);
+
+		if (szNew != szOld)
+		{ /* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			if (pBlock + szOld != m_pCursor || szNew > static_cast<size_t>(End() - pBlock) || !CommitTo(pBlock + szNew))
+				return false;
+
+			m_pCursor = pBlock + szNew;
+		}
+
+		blk.Size += delta;
+
+		return true;
+	}
+
+public:
+	/* If blk was the last allocated block, it will be freed.
+	   Otherwise, its pages are returned to the OS but its address range is not reused. */
+	void Deallocate(const Blk& blk)
+	{
+		if (!blk) return;
+
+		assert(Owns(blk) && "VirtualMemoryAllocator::Deallocate - Attempted to free a block that was not allocated by this allocator");
+
+		auto pBlock = static_cast<unsigned char*>(blk.Ptr);
+		auto pBlockEnd = pBlock + detail::RoundToAligned(blk.Size, m_PageSize);
+
+		{ /* CS */
+			std::lock_guard<MutexType> lock(m_Mutex);
+
+			if (pBlockEnd == m_pCursor)
+			{
+				m_pCursor = pBlock;
+				return;
+			}
+		}
+
+		Discard(pBlock, pBlockEnd);
+	}
+
+	/* Frees the memory for blk. */
+	void DeallocateAligned(const Blk& blk)
+	{
+		Deallocate(blk);
+	}
+
+	/* Frees all of this allocator's memory and returns its pages to the OS.
+	   The address range remains reserved. */
+	void DeallocateAll() noexcept
+	{
+		std::lock_guard<MutexType> lock(m_Mutex);
+
+		if (m_pCommitted != m_pBase)
+			detail::VirtualDecommit(m_pBase, static_cast<size_t>(m_pCommitted - m_pBase));
+
+		m_pCursor = m_pCommitted = m_pBase;
+	}
+
+public:
+	/* Returns the number of bytes of address space handed out. */
+	size_t GetUsedSize() const noexcept
+	{
+		std::lock_guard<MutexType> lock(m_Mutex);
+		return static_cast<size_t>(m_pCursor - m_pBase);
+	}
+
+	/* Returns the number of bytes of address space that are committed. */
+	size_t GetCommittedSize() const noexcept
+	{
+		std::lock_guard<MutexType> lock(m_Mutex);
+		return static_cast<size_t>(m_pCommitted - m_pBase);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<size_t ReserveSize = 1024 * 1024 * 1024, bool UseHugePages = false>
+	using VirtualMemoryAllocator = detail::VirtualMemoryAllocatorImpl<ReserveSize, UseHugePages, false>;
+
+	template<size_t ReserveSize = 1024 * 1024 * 1024, bool UseHugePages = false>
+	using SharedVirtualMemoryAllocator = detail::VirtualMemoryAllocatorImpl<ReserveSize, UseHugePages, true>;
+}
@@ -23,6 +23,15 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+// Marks allocation functions so the MSVC heap profiler can attribute allocations
+#if defined(_MSC_VER)
+	#define EPIC_ALLOCATOR_DECL __declspec(allocator)
+#else
+	#define EPIC_ALLOCATOR_DECL
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
 namespace Epic::detail
 {
 	static constexpr size_t DefaultAlignment = alignof(std::max_align_t);
@@ -43,17 +52,26 @@ namespace Epic::detail
 		// Round sz up to the nearest multiple of alignment
 		return ((sz + alignment - 1) / alignment) * alignment;
 	}
+
+	constexpr size_t RoundToPowerOfTwo(size_t sz) noexcept
+	{
+		// Round sz up to the nearest power-of-two
+		size_t result = 1;
+		while (result < sz) result <<= 1;
+
+		return result;
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace Epic::detail
 {
-	template<class T, bool Enabled = std::is_abstract_v<T>>
+	template<class T, bool Enabled = !std::is_abstract_v<T>>
 	struct AlignOf : std::integral_constant<size_t, alignof(T)> { };
 
 	template<class T>
-	struct AlignOf<T, false> : std::integral_constant<size_t, 0> { };
+	struct AlignOf<T, false> : std::integral_constant<size_t, DefaultAlignment> { };
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,10 @@ namespace Epic
 		template<class T> using HasReallocateAligned = decltype(std::declval<T>().ReallocateAligned(std::declval<Blk&>(), size_t(), size_t()));
 		template<class T> using CanReallocateAligned = Epic::TMP::IsDetectedExact<bool, HasReallocateAligned, T>;
 
+		// CanExpand - Tests for T::Expand(Blk&, size_t) -> bool
+		template<class T> using HasExpand = decltype(std::declval<T>().Expand(std::declval<Blk&>(), size_t()));
+		template<class T> using CanExpand = Epic::TMP::IsDetectedExact<bool, HasExpand, T>;
+
 		// CanAllocateAll - Tests for T::AllocateAll() -> Blk
 		template<class T> using HasAllocateAll = decltype(std::declval<T>().AllocateAll());
 		template<class T> using CanAllocateAll = Epic::TMP::IsDetectedExact<Blk, HasAllocateAll, T>;
@@ -47,6 +51,10 @@ namespace Epic
 		template<class T> using HasAllocateAllAligned = decltype(std::declval<T>().AllocateAllAligned(size_t()));
 		template<class T> using CanAllocateAllAligned = Epic::TMP::IsDetectedExact<Blk, HasAllocateAllAligned, T>;
 
+		// CanAllocateBatch - Tests for T::AllocateBatch(Blk*, size_t) -> size_t
+		template<class T> using HasAllocateBatch = decltype(std::declval<T>().AllocateBatch(std::declval<Blk*>(), size_t()));
+		template<class T> using CanAllocateBatch = Epic::TMP::IsDetectedExact<size_t, HasAllocateBatch, T>;
+
 		// CanDeallocate - Tests for T::Deallocate(Blk) -> void
 		template<class T> using HasDeallocate = decltype(std::declval<T>().Deallocate(Blk()));
 		template<class T> using CanDeallocate = Epic::TMP::IsDetectedExact<void, HasDeallocate, T>;
@@ -55,8 +63,16 @@ namespace Epic
 		template<class T> using HasDeallocateAligned = decltype(std::declval<T>().DeallocateAligned(Blk()));
 		template<class T> using CanDeallocateAligned = Epic::TMP::IsDetectedExact<void, HasDeallocateAligned, T>;
 
+		// CanDeallocateBatch - Tests for T::DeallocateBatch(const Blk*, size_t) -> void
+		template<class T> using HasDeallocateBatch = decltype(std::declval<T>().DeallocateBatch(std::declval<const Blk*>(), size_t()));
+		template<class T> using CanDeallocateBatch = Epic::TMP::IsDetectedExact<void, HasDeallocateBatch, T>;
+
 		// CanDeallocateAll - Tests for T::DeallocateAll() -> void
 		template<class T> using HasDeallocateAll = decltype(std::declval<T>().DeallocateAll());
 		template<class T> using CanDeallocateAll = Epic::TMP::IsDetectedExact<void, HasDeallocateAll, T>;
+
+		// CanGetRegion - Tests for T::GetRegion() const -> Blk
+		template<class T> using HasGetRegion = decltype(std::declval<const T&>().GetRegion());
+		template<class T> using CanGetRegion = Epic::TMP::IsDetectedExact<Blk, HasGetRegion, T>;
 	}
 }
@@ -13,10 +13,23 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <climits>
 #include <cstdint>
 
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#if defined(__AVX2__)
+	#define EPIC_HEAPBITMAP_AVX2
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define EPIC_HEAPBITMAP_SSE2
+	#include <emmintrin.h>
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 
 namespace Epic::detail
@@ -72,6 +85,85 @@ struct Epic::detail::HeapBitmapMask<uint64_t>
 
 //////////////////////////////////////////////////////////////////////////////
 
+namespace Epic::detail
+{
+	// Count the number of trailing zero bits in a non-zero value
+	template<typename T>
+	inline size_t CountTrailingZeros(T value) noexcept
+	{
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "CountTrailingZeros: Unsupported type.");
+		assert(value != 0);
+
+	#if defined(_MSC_VER)
+		unsigned long index;
+
+		if constexpr (sizeof(T) == 8)
+		{
+		#if defined(_M_X64) || defined(_M_ARM64)
+			_BitScanForward64(&index, static_cast<unsigned __int64>(value));
+		#else
+			const auto lo = static_cast<unsigned long>(value);
+			if (lo != 0)
+				_BitScanForward(&index, lo);
+			else
+			{
+				_BitScanForward(&index, static_cast<unsigned long>(static_cast<uint64_t>(value) >> 32));
+				index += 32;
+			}
+		#endif
+		}
+		else
+			_BitScanForward(&index, static_cast<unsigned long>(value));
+
+		return static_cast<size_t>(index);
+	#else
+		if constexpr (sizeof(T) == 8)
+			return static_cast<size_t>(__builtin_ctzll(static_cast<unsigned long long>(value)));
+		else
+			return static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(value)));
+	#endif
+	}
+
+	// Find the index of the highest set bit in a non-zero value (floor(log2(value)))
+	template<typename T>
+	inline size_t FloorLog2(T value) noexcept
+	{
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "FloorLog2: Unsupported type.");
+		assert(value != 0);
+
+	#if defined(_MSC_VER)
+		unsigned long index;
+
+		if constexpr (sizeof(T) == 8)
+		{
+		#if defined(_M_X64) || defined(_M_ARM64)
+			_BitScanReverse64(&index, static_cast<unsigned __int64>(value));
+		#else
+			const auto hi = static_cast<unsigned long>(static_cast<uint64_t>(value) >> 32);
+			if (hi != 0)
+			{
+				_BitScanReverse(&index, hi);
+				index += 32;
+			}
+			else
+				_BitScanReverse(&index, static_cast<unsigned long>(value));
+		#endif
+		}
+		else
+			_BitScanReverse(&index, static_cast<unsigned long>(value));
+
+		return static_cast<size_t>(index);
+	#else
+		if constexpr (sizeof(T) == 8)
+			return 63 - static_cast<size_t>(__builtin_clzll(static_cast<unsigned long long>(value)));
+		else
+			return 31 - static_cast<size_t>(__builtin_clz(static_cast<unsigned int>(value)));
+	#endif
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 template<size_t BitCount>
 struct Epic::detail::HeapBitmap
 {
@@ -111,15 +203,14 @@ struct Epic::detail::HeapBitmap
 	void Set(size_t location, bool value = true) noexcept
 	{
 		const size_t block = location / BitsPerBlock;
-		const size_t lrem = location % BitsPerBlock;
-		const size_t urem = (location + 1) % BitsPerBlock;
+		const StorageType bit = StorageType(1) << (location % BitsPerBlock);
 
 		assert(block < BlockCount);
 		
 		if (value)
-			Blocks[block] |= ~HeapBitmapMask<StorageType>::Masks[lrem] & HeapBitmapMask<StorageType>::Masks[urem];
+			Blocks[block] |= bit;
 		else
-			Blocks[blocks] &= HeapBitmapMask<StorageType>::Masks[lrem] | ~HeapBitmapMask<StorageType>::Masks[urem];
+			Blocks[block] &= ~bit;
 	}
 
 	// Set bits from start to start+count to value
@@ -163,68 +254,131 @@ struct Epic::detail::HeapBitmap
 		}
 	}
 
-	// Find the first bit where 'length' bits are contiguously free.
-	size_t FindAvailable(size_t length) const noexcept
+	// Find the first bit (at or after 'hint', wrapping around to 0) where 'length' bits are contiguously free.
+	// Returns Entries if no such span exists.
+	size_t FindAvailable(size_t length, size_t hint = 0) const noexcept
 	{
-		size_t LBlock = 0;
-		size_t UBlock = length / BitsPerBlock;
+		if (length == 0 || length > Entries)
+			return Entries;
 
-		size_t LMask = (LBlock == UBlock) ? ~HeapBitmapMask<StorageType>::Masks[length] : AllZero;
-		size_t UMask = ~HeapBitmapMask<StorageType>::Masks[length % BitsPerBlock];
+		if (hint >= Entries)
+			hint = 0;
+
+		const size_t result = FindAvailableIn(length, hint, Entries);
 		
-		const size_t last = Entries - length + 1;
+		// Wrap around (spans that straddle the hint are still considered)
+		if (result == Entries && hint > 0)
+			return FindAvailableIn(length, 0, std::min(Entries, hint + length - 1));
+
+		return result;
+	}
+
+private:
+	// Find the first bit in [first, last) where 'length' bits are contiguously free.
+	// Whole words are skipped at a time; runs within a word are measured with count-trailing-zeros.
+	size_t FindAvailableIn(size_t length, size_t first, size_t last) const noexcept
+	{
+		size_t runStart = first;
+		size_t runLength = 0;
+		size_t bit = first;
 
-		for (size_t i = 0; i < (Entries - length + 1); ++i)
+		while (bit < last)
 		{
-			bool good = true;
+			size_t block = bit / BitsPerBlock;
+			const size_t offset = bit % BitsPerBlock;
 
-			// Whole block checks
-			for (size_t j = LBlock + 1; j < UBlock; ++j)
+			if (offset == 0)
 			{
-				if (Blocks[j] != 0)
+				// Skip whole used words while looking for a run to start, 
+				// and whole free words while extending one
+				const size_t lastBlock = (last + BitsPerBlock - 1) / BitsPerBlock;
+				const size_t next = FindBlockNotEqual(block, lastBlock, (runLength == 0) ? AllOne : AllZero);
+
+				if (runLength == 0)
 				{
-					good = false;
-					break;
+					runStart = next * BitsPerBlock;
+				}
+				else
+				{
+					runLength += (next - block) * BitsPerBlock;
+					if (runLength >= length)
+						break;
 				}
-			}
 
-			// Edge block checks
-			if (LBlock == UBlock)
-			{
-				size_t CMask = LMask | UMask;
-				good &= ((CMask | Blocks[LBlock]) == CMask);
-			}
-			else
-			{
-				good &= ((LMask | Blocks[LBlock]) == LMask);
-				good &= ((UMask | Blocks[UBlock]) == UMask);
+				if (next >= lastBlock)
+					break;
+
+				block = next;
+				bit = block * BitsPerBlock;
 			}
 
-			// If all is well, free space has been found
-			if (good) return i;
+			// Bits shifted in from the top count as free; they're bounded by 'avail'
+			const size_t avail = BitsPerBlock - (bit % BitsPerBlock);
+			const StorageType word = Blocks[block] >> (bit % BitsPerBlock);
 
-			// Update edge masks
-			LMask = (LMask << 1) | 1;
-			UMask = UMask << 1;
+			// Measure the free bits up to the next used bit
+			const size_t freeBits = (word == AllZero) ? avail : CountTrailingZeros(word);
 
-			// Check for edge block shifting
-			if (LMask == AllOne)
-			{
-				LMask = AllZero;
-				++LBlock;
-			}
+			if (runLength == 0)
+				runStart = bit;
+
+			runLength += freeBits;
+			if (runLength >= length)
+				break;
 
-			if (UMask == AllZero)
+			if (freeBits == avail)
 			{
-				UMask = AllOne;
-				++UBlock;
+				bit += avail;
+				continue;
 			}
+
+			// Skip the used bits
+			const StorageType used = ~(word >> freeBits);
+			const size_t usedBits = (used == AllZero) ? (avail - freeBits) : std::min(avail - freeBits, CountTrailingZeros(used));
+			
+			bit += freeBits + usedBits;
+			runLength = 0;
 		}
-		
+
+		if (runLength >= length && runStart + length <= Entries)
+			return runStart;
+
 		// Failed to locate an available span
 		return Entries;
 	}
 
+	// Find the first block in [block, last) that is not equal to value (or last if there are none)
+	size_t FindBlockNotEqual(size_t block, size_t last, StorageType value) const noexcept
+	{
+	#if defined(EPIC_HEAPBITMAP_AVX2)
+		constexpr size_t BlocksPerVector = sizeof(__m256i) / sizeof(StorageType);
+		const __m256i vvalue = _mm256_set1_epi8(static_cast<char>(value));
+
+		for (; block + BlocksPerVector <= last; block += BlocksPerVector)
+		{
+			const __m256i vblocks = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&Blocks[block]));
+			if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(vblocks, vvalue)) != -1)
+				break;
+		}
+	#elif defined(EPIC_HEAPBITMAP_SSE2)
+		constexpr size_t BlocksPerVector = sizeof(__m128i) / sizeof(StorageType);
+		const __m128i vvalue = _mm_set1_epi8(static_cast<char>(value));
+
+		for (; block + BlocksPerVector <= last; block += BlocksPerVector)
+		{
+			const __m128i vblocks = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Blocks[block]));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(vblocks, vvalue)) != 0xFFFF)
+				break;
+		}
+	#endif
+
+		while (block < last && Blocks[block] == value)
+			++block;
+
+		return block;
+	}
+
+public:
 	// Test whether or not 'count' bits are contiguously free from location 'start'
 	bool HasAvailable(size_t start, size_t count) const noexcept
 	{
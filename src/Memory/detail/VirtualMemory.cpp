@@ -0,0 +1,160 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "VirtualMemory.hpp"
+#include <cassert>
+#include <cstdint>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(_WIN32)
+
+size_t Epic::detail::VirtualPageSize() noexcept
+{
+	static const size_t s_PageSize = []
+	{
+		SYSTEM_INFO info;
+		::GetSystemInfo(&info);
+
+		return static_cast<size_t>(info.dwPageSize);
+	}();
+
+	return s_PageSize;
+}
+
+void* Epic::detail::VirtualReserve(size_t sz, size_t alignment) noexcept
+{
+	// Reservations are already aligned to the allocation granularity (64KB)
+	void* p = ::VirtualAlloc(nullptr, sz, MEM_RESERVE, PAGE_NOACCESS);
+	if (!p || (reinterpret_cast<uintptr_t>(p) & (alignment - 1)) == 0)
+		return p;
+
+	// Otherwise, find an aligned address inside a larger reservation and claim it.
+	// Another thread may claim the address between the release and the reserve, so retry.
+	::VirtualFree(p, 0, MEM_RELEASE);
+
+	for (int attempt = 0; attempt < 8; ++attempt)
+	{
+		p = ::VirtualAlloc(nullptr, sz + alignment, MEM_RESERVE, PAGE_NOACCESS);
+		if (!p) return nullptr;
+
+		const auto aligned = (reinterpret_cast<uintptr_t>(p) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		::VirtualFree(p, 0, MEM_RELEASE);
+
+		p = ::VirtualAlloc(reinterpret_cast<void*>(aligned), sz, MEM_RESERVE, PAGE_NOACCESS);
+		if (p) return p;
+	}
+
+	return nullptr;
+}
+
+void Epic::detail::VirtualRelease(void* p, size_t) noexcept
+{
+	if (p) ::VirtualFree(p, 0, MEM_RELEASE);
+}
+
+bool Epic::detail::VirtualCommit(void* p, size_t sz) noexcept
+{
+	return ::VirtualAlloc(p, sz, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void Epic::detail::VirtualDecommit(void* p, size_t sz) noexcept
+{
+	::VirtualFree(p, sz, MEM_DECOMMIT);
+}
+
+void Epic::detail::VirtualDiscard(void* p, size_t sz) noexcept
+{
+	::VirtualAlloc(p, sz, MEM_RESET, PAGE_READWRITE);
+}
+
+void Epic::detail::VirtualAdviseHugePages(void*, size_t) noexcept
+{
+	// Large pages on Windows must be committed up front by a process holding
+	// SeLockMemoryPrivilege, which doesn't fit lazy commitment.  Ignored.
+}
+
+#else
+
+size_t Epic::detail::VirtualPageSize() noexcept
+{
+	static const size_t s_PageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+	return s_PageSize;
+}
+
+void* Epic::detail::VirtualReserve(size_t sz, size_t alignment) noexcept
+{
+	if (alignment < VirtualPageSize())
+		alignment = VirtualPageSize();
+
+	// Over-reserve so that an aligned range fits, then trim the excess from both ends
+	const size_t szReserve = sz + alignment - VirtualPageSize();
+
+	void* p = ::mmap(nullptr, szReserve, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (p == MAP_FAILED) return nullptr;
+
+	auto pBegin = reinterpret_cast<unsigned char*>(p);
+	auto pAligned = reinterpret_cast<unsigned char*>(
+		(reinterpret_cast<uintptr_t>(p) + alignment - 1) & ~(uintptr_t)(alignment - 1));
+	auto pEnd = pBegin + szReserve;
+
+	if (pAligned != pBegin)
+		::munmap(pBegin, static_cast<size_t>(pAligned - pBegin));
+
+	if (pAligned + sz != pEnd)
+		::munmap(pAligned + sz, static_cast<size_t>(pEnd - (pAligned + sz)));
+
+	return pAligned;
+}
+
+void Epic::detail::VirtualRelease(void* p, size_t sz) noexcept
+{
+	if (p) ::munmap(p, sz);
+}
+
+bool Epic::detail::VirtualCommit(void* p, size_t sz) noexcept
+{
+	return ::mprotect(p, sz, PROT_READ | PROT_WRITE) == 0;
+}
+
+void Epic::detail::VirtualDecommit(void* p, size_t sz) noexcept
+{
+	::madvise(p, sz, MADV_DONTNEED);
+	::mprotect(p, sz, PROT_NONE);
+}
+
+void Epic::detail::VirtualDiscard(void* p, size_t sz) noexcept
+{
+	::madvise(p, sz, MADV_DONTNEED);
+}
+
+void Epic::detail::VirtualAdviseHugePages(void* p, size_t sz) noexcept
+{
+#if defined(MADV_HUGEPAGE)
+	::madvise(p, sz, MADV_HUGEPAGE);
+#else
+	(void)p; (void)sz;
+#endif
+}
+
+#endif
@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Thin wrappers over the platform's virtual memory API.
+// Reserved ranges are inaccessible until committed.  Decommitted ranges
+// return their physical pages to the OS but remain reserved.
+namespace Epic::detail
+{
+	static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+	/* Returns the size of a virtual memory page. */
+	size_t VirtualPageSize() noexcept;
+
+	/* Reserves sz bytes of address space aligned to 'alignment' (a power of two).
+	   Returns null on failure. */
+	void* VirtualReserve(size_t sz, size_t alignment) noexcept;
+
+	/* Releases a range obtained from VirtualReserve(). */
+	void VirtualRelease(void* p, size_t sz) noexcept;
+
+	/* Makes the pages of a reserved range readable and writable.
+	   Physical pages are supplied by the OS on first touch. */
+	bool VirtualCommit(void* p, size_t sz) noexcept;
+
+	/* Returns the physical pages of a committed range to the OS and makes it inaccessible. */
+	void VirtualDecommit(void* p, size_t sz) noexcept;
+
+	/* Returns the physical pages of a committed range to the OS, leaving it committed.
+	   The contents of the range become undefined. */
+	void VirtualDiscard(void* p, size_t sz) noexcept;
+
+	/* Requests that a reserved range be backed by huge pages where the OS allows it. */
+	void VirtualAdviseHugePages(void* p, size_t sz) noexcept;
+}
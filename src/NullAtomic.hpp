@@ -156,12 +156,12 @@ public:
 public:
 	ValueType fetch_add(ValueType arg, std::memory_order order = std::memory_order_seq_cst)
 	{
-		return exchange(load() + arg, order);
+		return this->exchange(this->load() + arg, order);
 	}
 
 	ValueType fetch_sub(ValueType arg, std::memory_order order = std::memory_order_seq_cst)
 	{
-		return exchange(load() - arg, order);
+		return this->exchange(this->load() - arg, order);
 	}
 
 public:
@@ -212,12 +212,12 @@ public:
 public:
 	ValueType fetch_add(std::ptrdiff_t arg, std::memory_order order = std::memory_order_seq_cst)
 	{
-		return exchange(load() + arg, order);
+		return this->exchange(this->load() + arg, order);
 	}
 
 	ValueType fetch_sub(std::ptrdiff_t arg, std::memory_order order = std::memory_order_seq_cst)
 	{
-		return exchange(load() - arg, order);
+		return this->exchange(this->load() - arg, order);
 	}
 
 public:
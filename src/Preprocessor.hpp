@@ -18,6 +18,20 @@
 #define EPIC_EXPAND(x) x
 #define EPIC_CONCATENATE(x,y) x##y
 
+// EPIC_NO_SANITIZE_THREAD - Excludes a function from ThreadSanitizer instrumentation.
+// Reserved for lock-free code whose racy reads are validated afterwards (e.g. by a CAS).
+#if defined(__SANITIZE_THREAD__)
+	#define EPIC_NO_SANITIZE_THREAD __attribute__((no_sanitize("thread")))
+#elif defined(__has_feature)
+	#if __has_feature(thread_sanitizer)
+		#define EPIC_NO_SANITIZE_THREAD __attribute__((no_sanitize("thread")))
+	#endif
+#endif
+
+#ifndef EPIC_NO_SANITIZE_THREAD
+	#define EPIC_NO_SANITIZE_THREAD
+#endif
+
 #define EPIC_FOREACH_1(what, x, ...) what(x)
 #define EPIC_FOREACH_2(what, x, ...) \
 	what(x) \
@@ -80,7 +80,7 @@ public:
 public:
 	AllocI() noexcept { }
 
-	AllocI(const Type& obj) noexcept { }
+	AllocI(const Type&) noexcept { }
 
 	template<class U>
 	AllocI(const AllocI<U, A>&) noexcept
@@ -101,7 +101,7 @@ public:
 
 	pointer address(reference value) const noexcept
 	{
-		std::addressof(value);
+		return std::addressof(value);
 	}
 
 	const_pointer address(const_reference value) const noexcept
@@ -110,7 +110,7 @@ public:
 	}
 
 public:
-	__declspec(allocator) pointer allocate(size_type n)
+	EPIC_ALLOCATOR_DECL pointer allocate(size_type n)
 	{
 		Blk blk;
 
@@ -153,12 +153,12 @@ public:
 		return static_cast<pointer>(blk.Ptr);
 	}
 
-	__declspec(allocator) pointer allocate(size_type n, const void* /* pHint */)
+	EPIC_ALLOCATOR_DECL pointer allocate(size_type n, const void* /* pHint */)
 	{
 		return allocate(n);
 	}
 
-	void deallocate(pointer p, size_type n)
+	void deallocate(pointer p, size_type /* n */)
 	{
 		// The AffixAllocator doesn't need to know a block's size to calculate the 
 		// prefix object from a pointer.  A temporary block will be used.
@@ -298,21 +298,21 @@ struct std::allocator_traits<Epic::detail::AllocI<T, A>>
 	template<class U>
 	using rebind_traits = allocator_traits<Epic::detail::AllocI<U, A> >;
 
-	static _declspec(allocator) pointer allocate(allocator_type& allocator, size_type n)
+	static EPIC_ALLOCATOR_DECL pointer allocate(allocator_type& allocator, size_type n)
 	{  return (allocator.allocate(n));  }
 
-	static _declspec(allocator) pointer allocate(allocator_type& allocator, size_type n, const_void_pointer pHint)
+	static EPIC_ALLOCATOR_DECL pointer allocate(allocator_type& allocator, size_type n, const_void_pointer pHint)
 	{  return (allocator.allocate(n, pHint));  }
 
 	static void deallocate(allocator_type& allocator, pointer p, size_type n)
 	{  (allocator.deallocate(p, n));  }
 
-	template<class T, class... Args>
-	static void construct(allocator_type& allocator, T* p, Args&&... args)
+	template<class U, class... Args>
+	static void construct(allocator_type& allocator, U* p, Args&&... args)
 	{  (allocator.construct(p, std::forward<Args>(args)...));  }
 
-	template<class T>
-	static void destroy(allocator_type& allocator, T* p)
+	template<class U>
+	static void destroy(allocator_type& allocator, U* p)
 	{  (allocator.destroy(p));  }
 
 	static size_type max_size(const allocator_type& allocator) noexcept
@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//
+//    This simple ECS system was inspired by Sam Bloomberg's ECS system
+//        available for download at: https://github.com/redxdev/ECS
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/EntityComponentTraits.hpp>
+#include <Epic/EntitySystem.hpp>
+#include <array>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<class... Components>
+	struct Reads;
+
+	template<class... Components>
+	struct Writes;
+
+	template<class ReadSet, class WriteSet = Epic::Writes<>>
+	class ScheduledEntitySystem;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Reads<Components...>
+template<class... Components>
+struct Epic::Reads
+{
+	static constexpr std::array<Epic::EntityComponentID, sizeof...(Components)> IDs
+	{ 
+		{ Epic::EntityComponentTraits<Components>::ID... } 
+	};
+};
+
+// Writes<Components...>
+template<class... Components>
+struct Epic::Writes
+{
+	static constexpr std::array<Epic::EntityComponentID, sizeof...(Components)> IDs
+	{ 
+		{ Epic::EntityComponentTraits<Components>::ID... } 
+	};
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// ScheduledEntitySystem<Reads<R...>, Writes<W...>>
+//	An EntitySystem that declares the components it reads and writes.  When the
+//	EntityManager is in eEntityUpdateMode::Parallel, systems whose access sets do 
+//	not conflict are updated concurrently.
+//	
+//	NOTE: Update() may run on a worker thread.  It must only touch the declared
+//	components and must not create or destroy entities, nor attach or detach 
+//	components.
+//
+//	Example:
+//			class MovementSystem : public Epic::ScheduledEntitySystem<Epic::Reads<Velocity>, Epic::Writes<Position>>
+//			{ ... };
+template<class... R, class... W>
+class Epic::ScheduledEntitySystem<Epic::Reads<R...>, Epic::Writes<W...>> : public Epic::EntitySystem
+{
+public:
+	using Type = Epic::ScheduledEntitySystem<Epic::Reads<R...>, Epic::Writes<W...>>;
+	using Base = Epic::EntitySystem;
+	using ReadSet = Epic::Reads<R...>;
+	using WriteSet = Epic::Writes<W...>;
+
+public:
+	ScheduledEntitySystem(Epic::EntityManager* pEntityManager) noexcept
+		: Base{ pEntityManager }
+	{ }
+
+protected:
+	bool GetAccess(Epic::EntitySystemAccess& access) const noexcept override
+	{
+		access = 
+		{ 
+			ReadSet::IDs.data(), ReadSet::IDs.size(), 
+			WriteSet::IDs.data(), WriteSet::IDs.size() 
+		};
+
+		return true;
+	}
+};
@@ -0,0 +1,484 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/Delegate.hpp>
+#include <Epic/Event.hpp>
+#include <Epic/StringHash.hpp>
+#include <Epic/Memory/CustomNew.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<typename Signature>
+	class SharedEvent;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// SharedEvent<Signature>
+//	An event that may be invoked, connected and disconnected from any thread.
+//	Invocation walks an immutable snapshot of the listener list.  Mutations copy 
+//	the current snapshot, modify the copy and publish it with a compare-and-swap.
+//	Replaced snapshots are reclaimed once every invocation that might still be 
+//	reading them has completed (epoch-based reclamation).
+//	Connections and disconnections made during an invocation take effect with the 
+//	next invocation.  Invocations already in progress on other threads may still 
+//	call a listener after it has been disconnected (see Synchronize()).
+template<class R, class... Args>
+class Epic::SharedEvent<R(Args...)>
+{
+public:
+	using Type = Epic::SharedEvent<R(Args...)>;
+	using DelegateType = Epic::Delegate<R(Args...)>;
+
+	static constexpr size_t CacheLineSize = 64;
+
+private:
+	using HandleType = uint32_t;
+	using InstanceType = typename DelegateType::InstanceType;
+	using EpochType = uint64_t;
+
+	struct Listener
+	{
+		DelegateType delegate;
+		HandleType handle;
+		Epic::eEventPriority priority;
+	};
+
+	using ListenerList = Epic::STLVector<Listener>;
+
+	struct Snapshot : public Epic::CustomNew<Snapshot>
+	{
+		ListenerList Listeners;			// Listeners in dispatch order
+		Snapshot* pNextRetired;			// The next snapshot awaiting reclamation
+		EpochType RetiredEpoch;			// The epoch at which this snapshot was replaced
+	};
+
+	// Registers an invocation (or mutation) with the current epoch.
+	// Snapshots observed while the guard is held will not be reclaimed.
+	class ReadGuard
+	{
+	private:
+		std::atomic<size_t>* m_pCounter;
+
+	public:
+		explicit ReadGuard(const Type& evt) noexcept
+		{
+			while (true)
+			{
+				const EpochType epoch = evt.m_Epoch.load();
+				m_pCounter = &evt.m_Readers[epoch & 1].Count;
+				m_pCounter->fetch_add(1);
+
+				// Ensure the epoch did not advance before the reader was counted
+				if (evt.m_Epoch.load() == epoch)
+					break;
+
+				m_pCounter->fetch_sub(1);
+			}
+		}
+
+		~ReadGuard() noexcept
+		{
+			m_pCounter->fetch_sub(1, std::memory_order_release);
+		}
+
+		ReadGuard(const ReadGuard&) = delete;
+		ReadGuard& operator = (const ReadGuard&) = delete;
+	};
+
+	struct alignas(CacheLineSize) ReaderCount
+	{
+		std::atomic<size_t> Count{ 0 };
+	};
+
+private:
+	std::atomic<Snapshot*> m_pSnapshot;				// The current listener list (null when empty)
+	std::atomic<Snapshot*> m_pRetired;				// Replaced snapshots awaiting reclamation
+	alignas(CacheLineSize) std::atomic<EpochType> m_Epoch;
+	mutable ReaderCount m_Readers[2];				// Active readers, by epoch parity
+
+public:
+	SharedEvent() noexcept
+		: m_pSnapshot{ nullptr }, m_pRetired{ nullptr }, m_Epoch{ 0 }
+	{ }
+
+	SharedEvent(const Type&) = delete;
+	Type& operator = (const Type&) = delete;
+
+	// NOTE: The event must not be in use by other threads when it is destroyed.
+	~SharedEvent() noexcept
+	{
+		delete m_pSnapshot.load();
+
+		Snapshot* pRetired = m_pRetired.load();
+		while (pRetired)
+		{
+			Snapshot* pNext = pRetired->pNextRetired;
+			delete pRetired;
+			pRetired = pNext;
+		}
+	}
+
+public:
+	explicit inline operator bool() const noexcept
+	{
+		return GetListenerCount() > 0;
+	}
+
+	// Returns the number of listeners subscribed to this event
+	size_t GetListenerCount() const noexcept
+	{
+		ReadGuard guard{ *this };
+
+		const Snapshot* pSnapshot = m_pSnapshot.load();
+		return pSnapshot ? pSnapshot->Listeners.size() : 0;
+	}
+
+private:
+	// Publish a modified copy of the listener list.
+	// 'mutator' modifies the copy and returns whether or not anything changed.
+	template<class Mutator>
+	void Mutate(Mutator mutator)
+	{
+		{ /* Reader */
+			ReadGuard guard{ *this };
+
+			Snapshot* pCurrent = m_pSnapshot.load();
+
+			while (true)
+			{
+				Snapshot* pNext = new Snapshot{};
+				pNext->pNextRetired = nullptr;
+				pNext->RetiredEpoch = 0;
+
+				if (pCurrent)
+					pNext->Listeners = pCurrent->Listeners;
+
+				if (!mutator(pNext->Listeners))
+				{
+					delete pNext;
+					return;
+				}
+
+				if (pNext->Listeners.empty())
+				{
+					delete pNext;
+					pNext = nullptr;
+				}
+
+				// On failure, pCurrent receives the newer snapshot (which the guard protects)
+				if (m_pSnapshot.compare_exchange_weak(pCurrent, pNext))
+					break;
+
+				delete pNext;
+			}
+
+			if (pCurrent)
+				Retire(pCurrent);
+		}
+
+		Reclaim();
+	}
+
+	void Retire(Snapshot* pSnapshot) noexcept
+	{
+		pSnapshot->RetiredEpoch = m_Epoch.load();
+		pSnapshot->pNextRetired = m_pRetired.load(std::memory_order_relaxed);
+
+		while (!m_pRetired.compare_exchange_weak(pSnapshot->pNextRetired, pSnapshot))
+			;
+	}
+
+	// Advance the epoch if no reader remains in the previous epoch
+	void TryAdvanceEpoch() noexcept
+	{
+		EpochType epoch = m_Epoch.load();
+
+		if (m_Readers[(epoch + 1) & 1].Count.load() == 0)
+			m_Epoch.compare_exchange_strong(epoch, epoch + 1);
+	}
+
+	// Free every retired snapshot that can no longer be observed by a reader.
+	// A snapshot retired at epoch E is unreachable once the epoch reaches E + 2.
+	void Reclaim() noexcept
+	{
+		TryAdvanceEpoch();
+		TryAdvanceEpoch();
+
+		Snapshot* pRetired = m_pRetired.exchange(nullptr);
+		if (!pRetired)
+			return;
+
+		const EpochType epoch = m_Epoch.load();
+
+		Snapshot* pKeepHead = nullptr;
+		Snapshot* pKeepTail = nullptr;
+
+		while (pRetired)
+		{
+			Snapshot* pNext = pRetired->pNextRetired;
+
+			if (pRetired->RetiredEpoch + 2 <= epoch)
+				delete pRetired;
+			else
+			{
+				pRetired->pNextRetired = pKeepHead;
+				pKeepHead = pRetired;
+
+				if (!pKeepTail)
+					pKeepTail = pRetired;
+			}
+
+			pRetired = pNext;
+		}
+
+		// Return the survivors to the retired list
+		if (pKeepHead)
+		{
+			pKeepTail->pNextRetired = m_pRetired.load(std::memory_order_relaxed);
+
+			while (!m_pRetired.compare_exchange_weak(pKeepTail->pNextRetired, pKeepHead))
+				;
+		}
+	}
+
+private:
+	void Subscribe(const DelegateType& delegate, HandleType handle, Epic::eEventPriority priority)
+	{
+		Mutate([&](ListenerList& listeners)
+		{
+			const auto instance = delegate.GetInstance();
+
+			if (instance != 0 || handle != 0)
+			{
+				auto it = std::find_if(std::begin(listeners), std::end(listeners), [&](const Listener& o) 
+					{ return o.delegate.GetInstance() == instance && o.handle == handle; });
+
+				if (it != std::end(listeners))
+					return false;
+			}
+
+			// Listeners with equal priority are invoked in the order they were connected
+			auto it = std::find_if(std::begin(listeners), std::end(listeners), 
+				[&](const Listener& o) { return o.priority < priority; });
+
+			listeners.insert(it, Listener{ delegate, handle, priority });
+			return true;
+		});
+	}
+
+	template<class Predicate>
+	void UnsubscribeIf(Predicate pred)
+	{
+		Mutate([&](ListenerList& listeners)
+		{
+			const size_t count = listeners.size();
+
+			listeners.erase(std::remove_if(std::begin(listeners), std::end(listeners), pred), std::end(listeners));
+
+			return listeners.size() != count;
+		});
+	}
+
+public:
+	// Connect a function handler (function pointers and function objects convert implicitly)
+	inline void Connect(const DelegateType& delegate, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(delegate, 0, priority);
+	}
+
+	// Connect a function handler with a handle
+	inline void Connect(const DelegateType& delegate, Epic::StringHash handle, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(delegate, HandleType(handle), priority);
+	}
+
+	// Connect a member function pointer handler
+	template<class T, class This>
+	inline void Connect(This* pThis, R(T::* fn)(Args...), 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(DelegateType(pThis, fn), 0, priority);
+	}
+
+	// Connect a const member function pointer handler
+	template<class T, class This>
+	inline void Connect(const This* pThis, R(T::* fn)(Args...) const, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(DelegateType(pThis, fn), 0, priority);
+	}
+
+	// Connect a member function pointer handler with a handle
+	template<class T, class This>
+	inline void Connect(This* pThis, R(T::* fn)(Args...), Epic::StringHash handle, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(DelegateType(pThis, fn), HandleType(handle), priority);
+	}
+
+	// Connect a const member function pointer handler with a handle
+	template<class T, class This>
+	inline void Connect(const This* pThis, R(T::* fn)(Args...) const, Epic::StringHash handle, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(DelegateType(pThis, fn), HandleType(handle), priority);
+	}
+
+	// Connect a member function handler that is bound at compile-time
+	template<auto Method, class This>
+	inline void Connect(This* pThis, Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(DelegateType::template Bind<Method>(pThis), 0, priority);
+	}
+
+	// Connect a member function handler that is bound at compile-time with a handle
+	template<auto Method, class This>
+	inline void Connect(This* pThis, Epic::StringHash handle, 
+						Epic::eEventPriority priority = Epic::eEventPriority::Normal)
+	{
+		Subscribe(DelegateType::template Bind<Method>(pThis), HandleType(handle), priority);
+	}
+
+	// Disconnect all handlers with the supplied handle
+	inline void Disconnect(Epic::StringHash handle)
+	{
+		UnsubscribeIf([h = HandleType(handle)](const Listener& o) { return o.handle == h; });
+	}
+
+	// Disconnect a static function pointer handler (this will NOT disconnect listeners that provided a handle)
+	inline void Disconnect(R(*fn)(Args...))
+	{
+		Disconnect(reinterpret_cast<InstanceType>(fn), 0);
+	}
+
+	// Disconnect a static function pointer handler with a handle
+	inline void Disconnect(R(*fn)(Args...), Epic::StringHash handle)
+	{
+		Disconnect(reinterpret_cast<InstanceType>(fn), HandleType(handle));
+	}
+
+	// Disconnect a member function pointer handler (this will NOT disconnect listeners that provided a handle)
+	template<class This>
+	inline void Disconnect(const This* pThis)
+	{
+		Disconnect(reinterpret_cast<InstanceType>(pThis), 0);
+	}
+
+	// Disconnect a member function pointer handler with a handle
+	template<class This>
+	inline void Disconnect(const This* pThis, Epic::StringHash handle)
+	{
+		Disconnect(reinterpret_cast<InstanceType>(pThis), HandleType(handle));
+	}
+
+	// Disconnect all static function pointer handlers with this address (even listeners that provided a handle)
+	inline void DisconnectAll(R(*fn)(Args...))
+	{
+		DisconnectAll(reinterpret_cast<InstanceType>(fn));
+	}
+
+	// Disconnect all member function pointer handlers with this instance address (even listeners that provided a handle)
+	template<class This>
+	inline void DisconnectAll(const This* pThis)
+	{
+		DisconnectAll(reinterpret_cast<InstanceType>(pThis));
+	}
+
+	// Disconnect all listeners
+	inline void DisconnectAll()
+	{
+		UnsubscribeIf([](const Listener&) { return true; });
+	}
+
+private:
+	inline void Disconnect(InstanceType instance, HandleType handle)
+	{
+		UnsubscribeIf([=](const Listener& o) { return o.delegate.GetInstance() == instance && o.handle == handle; });
+	}
+
+	inline void DisconnectAll(InstanceType instance)
+	{
+		UnsubscribeIf([=](const Listener& o) { return o.delegate.GetInstance() == instance; });
+	}
+
+public:
+	// Block until every invocation that began before this call has completed.
+	// Use this before destroying an object that was disconnected while other 
+	// threads may have been invoking this event.
+	// NOTE: Calling this from within a handler of this event will never return.
+	void Synchronize() noexcept
+	{
+		const EpochType target = m_Epoch.load() + 2;
+
+		while (m_Epoch.load() < target)
+		{
+			TryAdvanceEpoch();
+			std::this_thread::yield();
+		}
+
+		Reclaim();
+	}
+
+public:
+	// Invoke the event (handler return values are ignored).
+	// This may be called from any thread, including from within a handler.
+	void operator() (Args... args) const
+	{
+		ReadGuard guard{ *this };
+
+		const Snapshot* pSnapshot = m_pSnapshot.load();
+		if (!pSnapshot)
+			return;
+
+		for (auto& listener : pSnapshot->Listeners)
+			listener.delegate(args...);
+	}
+
+	// Invoke the event (handler return values are ignored)
+	inline void Invoke(Args... args) const
+	{
+		this->operator() (std::forward<Args>(args)...);
+	}
+
+	// Invoke the event until a listener's return value satisfies the predicate.
+	// Returns true if the predicate ever evaluated to true.
+	template<class Predicate>
+	bool InvokeUntil(Predicate& predicate, Args... args) const
+	{
+		ReadGuard guard{ *this };
+
+		const Snapshot* pSnapshot = m_pSnapshot.load();
+		if (!pSnapshot)
+			return false;
+
+		for (auto& listener : pSnapshot->Listeners)
+		{
+			if (predicate(listener.delegate(args...)))
+				return true;
+		}
+
+		return false;
+	}
+};
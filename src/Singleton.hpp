@@ -71,4 +71,4 @@ private:
 
 // Static Initialization
 template<class T, class Tag>
-decltype(Epic::Singleton<T, Tag>::s_Creator) Epic::Singleton<T, Tag>::s_Creator;
+typename Epic::Singleton<T, Tag>::_Creator Epic::Singleton<T, Tag>::s_Creator;
@@ -63,7 +63,7 @@ public:
 
 	template<size_t N>
 	constexpr BasicStringHash(const CharType(&cstr)[N]) noexcept
-		: m_Hash{ AlgorithmType::Hash<N>(cstr) } { }
+		: m_Hash{ AlgorithmType::template Hash<N>(cstr) } { }
 
 	constexpr BasicStringHash(CStringWrapper cstr) noexcept
 		: m_Hash{ AlgorithmType::Hash(cstr.Str, std::strlen(cstr.Str)) } { }
@@ -13,12 +13,15 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 
 //////////////////////////////////////////////////////////////////////////////
 
+#ifdef _MSC_VER
 #pragma warning(disable: 4307)	// C4307 warns against integral constant overflow
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 
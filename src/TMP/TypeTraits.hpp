@@ -15,6 +15,7 @@
 
 #include <type_traits>
 #include <utility>
+#include <iterator>
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -101,6 +102,23 @@ namespace Epic::TMP
 
 //////////////////////////////////////////////////////////////////////////////
 
+// DeferredEnableIfT
+namespace Epic::TMP
+{
+	/*	Equivalent to std::enable_if_t<Condition>, except that Condition is not checked until
+		Dummy is substituted. Member templates that are constrained only on the parameters of
+		their enclosing class must use this; otherwise a false Condition is a hard error when
+		the class is instantiated, rather than a substitution failure. */
+
+	template<bool Condition, class Dummy>
+	constexpr bool DependentBool = Condition;
+
+	template<bool Condition, class Dummy>
+	using DeferredEnableIfT = std::enable_if_t<DependentBool<Condition, Dummy>>;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 // Container Traits
 namespace Epic::TMP
 {
@@ -0,0 +1,304 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/STL/Deque.hpp>
+#include <Epic/STL/UniquePtr.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	class ThreadPool;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// ThreadPool
+//	A fixed set of worker threads, each with its own task queue.
+//	Workers take tasks from the back of their own queue and steal from the
+//	front of the other queues when their own queue runs dry.
+class Epic::ThreadPool
+{
+public:
+	using Type = Epic::ThreadPool;
+	using Task = std::function<void()>;
+
+private:
+	// Job - A queued unit of work: either a submitted Task, or a range of ParallelFor 
+	// indices that refers to the caller's function without copying or allocating
+	struct Job
+	{
+		Task Fn;											// The submitted task (empty for ranges)
+		void (*pInvoke)(void* pContext, size_t first, size_t last) = nullptr;
+		void* pContext = nullptr;
+		size_t First = 0;
+		size_t Last = 0;
+
+		explicit operator bool() const noexcept
+		{
+			return pInvoke != nullptr || static_cast<bool>(Fn);
+		}
+
+		void operator() ()
+		{
+			if (pInvoke)
+				pInvoke(pContext, First, Last);
+			else
+				Fn();
+		}
+	};
+
+	// ParallelForContext - The state shared by the jobs of one ParallelFor() call
+	template<class Function>
+	struct ParallelForContext
+	{
+		Function* pFn;
+		std::atomic<size_t> Remaining;
+
+		static void Invoke(void* pContext, size_t first, size_t last)
+		{
+			auto& context = *static_cast<ParallelForContext*>(pContext);
+
+			for (size_t i = first; i < last; ++i)
+				(*context.pFn)(i);
+
+			context.Remaining.fetch_sub(1, std::memory_order_release);
+		}
+	};
+
+	struct WorkQueue
+	{
+		std::mutex Mutex;
+		Epic::STLDeque<Job> Tasks;
+	};
+
+	using WorkQueuePtr = Epic::UniquePtr<WorkQueue>;
+	using WorkQueueList = Epic::STLVector<WorkQueuePtr>;
+	using ThreadList = Epic::STLVector<std::thread>;
+
+	struct WorkerInfo
+	{
+		const Type* pPool;
+		size_t Index;
+	};
+
+private:
+	WorkQueueList m_Queues;					// One queue per worker thread
+	ThreadList m_Threads;					// The worker threads
+	std::atomic<size_t> m_QueuedCount;		// Number of tasks waiting in the queues
+	std::atomic<size_t> m_NextQueue;		// Round-robin queue index for external submissions
+	std::mutex m_SleepMutex;
+	std::condition_variable m_WakeCondition;
+	bool m_Stop;
+
+public:
+	// Create a pool with 'threadCount' workers.
+	// By default, one worker is created for each hardware thread except the calling thread.
+	explicit ThreadPool(size_t threadCount = DefaultThreadCount())
+		: m_QueuedCount{ 0 }, m_NextQueue{ 0 }, m_Stop{ false }
+	{
+		m_Queues.reserve(threadCount);
+		m_Threads.reserve(threadCount);
+
+		for (size_t i = 0; i < threadCount; ++i)
+			m_Queues.emplace_back(Epic::MakeUnique<WorkQueue>());
+
+		for (size_t i = 0; i < threadCount; ++i)
+			m_Threads.emplace_back([this, i] { _WorkerMain(i); });
+	}
+
+	ThreadPool(const Type&) = delete;
+	ThreadPool& operator = (const Type&) = delete;
+
+	~ThreadPool() noexcept
+	{
+		{ /* CS */
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Stop = true;
+		}
+
+		m_WakeCondition.notify_all();
+
+		for (auto& thread : m_Threads)
+			thread.join();
+	}
+
+public:
+	static size_t DefaultThreadCount() noexcept
+	{
+		const size_t hwThreads = std::thread::hardware_concurrency();
+		return (hwThreads > 1) ? hwThreads - 1 : 0;
+	}
+
+	inline size_t GetThreadCount() const noexcept
+	{
+		return m_Threads.size();
+	}
+
+public:
+	// Queue a task for execution on one of the workers.
+	// If the pool has no workers, the task is invoked immediately.
+	void Submit(Task task)
+	{
+		if (m_Threads.empty())
+		{
+			task();
+			return;
+		}
+
+		_Submit(Job{ std::move(task), nullptr, nullptr, 0, 0 });
+	}
+
+	// Invoke fn(i) for every i in [0, count) and wait for all invocations to complete.
+	// The indices are split into contiguous ranges (a few per thread) that are queued as
+	// jobs referring to 'fn'; neither 'fn' nor the jobs are copied into std::function.
+	// The calling thread runs jobs while it waits, so this may be called from within a task.
+	template<class Function>
+	void ParallelFor(size_t count, Function&& fn)
+	{
+		using FunctionType = std::remove_reference_t<Function>;
+
+		if (count == 0)
+			return;
+
+		if (count == 1 || m_Threads.empty())
+		{
+			for (size_t i = 0; i < count; ++i)
+				fn(i);
+
+			return;
+		}
+
+		const size_t jobCount = std::min(count, JobsPerThread * (m_Threads.size() + 1));
+		const size_t rangeSize = count / jobCount;
+		const size_t remainder = count % jobCount;
+
+		// Range r covers rangeSize indices, plus one more for the first 'remainder' ranges
+		auto rangeStart = [&] (size_t r) { return r * rangeSize + std::min(r, remainder); };
+
+		ParallelForContext<FunctionType> context{ &fn, { jobCount - 1 } };
+
+		for (size_t r = 1; r < jobCount; ++r)
+			_Submit(Job{ { }, &ParallelForContext<FunctionType>::Invoke, &context, rangeStart(r), rangeStart(r + 1) });
+
+		for (size_t i = 0; i < rangeStart(1); ++i)
+			fn(i);
+
+		const auto& worker = _ThisWorker();
+		const size_t home = (worker.pPool == this) ? worker.Index : 0;
+
+		while (context.Remaining.load(std::memory_order_acquire) != 0)
+		{
+			if (!_TryRunOne(home))
+				std::this_thread::yield();
+		}
+	}
+
+private:
+	static constexpr size_t JobsPerThread = 4;
+
+	void _Submit(Job&& job)
+	{
+		const auto& worker = _ThisWorker();
+		const size_t index = (worker.pPool == this) ? worker.Index : (m_NextQueue++ % m_Queues.size());
+		auto& queue = *m_Queues[index];
+
+		// Count the task before it is published so that a thief that pops it 
+		// immediately can never drive the count below zero.
+		m_QueuedCount.fetch_add(1, std::memory_order_release);
+
+		{ /* CS */
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+			queue.Tasks.emplace_back(std::move(job));
+		}
+
+		// Acquiring the sleep mutex prevents a worker from missing this notification
+		// between testing its wait predicate and blocking.
+		{ /* CS */ std::lock_guard<std::mutex> lock(m_SleepMutex); }
+		m_WakeCondition.notify_one();
+	}
+
+	static WorkerInfo& _ThisWorker() noexcept
+	{
+		static thread_local WorkerInfo s_Worker{ nullptr, 0 };
+		return s_Worker;
+	}
+
+	// Run a single queued job, preferring the back of queue 'home' and otherwise 
+	// stealing from the front of the other queues.
+	// Returns whether or not a job was run.
+	bool _TryRunOne(size_t home)
+	{
+		Job task;
+		const size_t queueCount = m_Queues.size();
+
+		for (size_t n = 0; n < queueCount && !task; ++n)
+		{
+			auto& queue = *m_Queues[(home + n) % queueCount];
+
+			{ /* CS */
+				std::lock_guard<std::mutex> lock(queue.Mutex);
+
+				if (queue.Tasks.empty())
+					continue;
+
+				if (n == 0)
+				{
+					task = std::move(queue.Tasks.back());
+					queue.Tasks.pop_back();
+				}
+				else
+				{
+					task = std::move(queue.Tasks.front());
+					queue.Tasks.pop_front();
+				}
+			}
+		}
+
+		if (!task)
+			return false;
+
+		m_QueuedCount.fetch_sub(1, std::memory_order_acq_rel);
+		task();
+
+		return true;
+	}
+
+	void _WorkerMain(size_t index)
+	{
+		_ThisWorker() = { this, index };
+
+		for (;;)
+		{
+			if (_TryRunOne(index))
+				continue;
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_WakeCondition.wait(lock, [this] { return m_Stop || m_QueuedCount.load(std::memory_order_acquire) > 0; });
+
+			if (m_Stop && m_QueuedCount.load(std::memory_order_acquire) == 0)
+				break;
+		}
+	}
+};
@@ -25,35 +25,41 @@
 
 namespace Epic::detail
 {
+	template<class EntityType, class ManagerType>
 	class EntityComponentIteratorBase;
 
-	template<class... Components>
-	class EntityComponentIterator;
+	template<class EntityType, class ManagerType, class... Components>
+	class EntityComponentIteratorImpl;
 
-	class ConstEntityComponentIteratorBase;
+	template<class... Components>
+	using EntityComponentIterator = 
+		EntityComponentIteratorImpl<Epic::Entity, Epic::EntityManager, Components...>;
 
 	template<class... Components>
-	class ConstEntityComponentIterator;
+	using ConstEntityComponentIterator = 
+		EntityComponentIteratorImpl<const Epic::Entity, const Epic::EntityManager, Components...>;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
-// EntityComponentIteratorBase
+// EntityComponentIteratorBase<EntityType, ManagerType>
+template<class E, class M>
 class Epic::detail::EntityComponentIteratorBase
 {
 public:
-	using Type = Epic::detail::EntityComponentIteratorBase;
-	using ValueType = Epic::Entity*;
+	using Type = Epic::detail::EntityComponentIteratorBase<E, M>;
+	using ValueType = E*;
+	using EntityList = Epic::detail::EntityComponentStorage::EntityList;
 
 protected:
 	size_t m_Index;
-	Epic::EntityManager* m_pManager;
-	bool m_AtEnd;
+	M* m_pManager;
+	const EntityList* m_pList;
 	bool m_IncludeDestroyed;
 
 public:
-	EntityComponentIteratorBase(Epic::EntityManager* pManager, size_t index, bool includeDestroyed) noexcept
-		: m_pManager{ pManager }, m_Index{ index }, m_AtEnd{ true }, m_IncludeDestroyed{ includeDestroyed }
+	EntityComponentIteratorBase(M* pManager, const EntityList* pList, size_t index, bool includeDestroyed) noexcept
+		: m_Index{ index }, m_pManager{ pManager }, m_pList{ pList }, m_IncludeDestroyed{ includeDestroyed }
 	{ }
 
 public:
@@ -67,27 +73,35 @@ public:
 		return m_Index;
 	}
 
-	const Epic::EntityManager* GetEntityManager() const noexcept
+	const M* GetEntityManager() const noexcept
 	{
 		return m_pManager;
 	}
 };
 
-// EntityComponentIterator<Components>
-template<class... Components>
-class Epic::detail::EntityComponentIterator : public Epic::detail::EntityComponentIteratorBase
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityComponentIteratorImpl<EntityType, ManagerType, Components>
+//	Walks a packed entity list (typically the smallest component pool among 
+//	Components) and skips entries that do not have ALL Components.
+template<class E, class M, class... Components>
+class Epic::detail::EntityComponentIteratorImpl : public Epic::detail::EntityComponentIteratorBase<E, M>
 {
 public:
-	using Type = Epic::detail::EntityComponentIterator<Components...>;
+	using Type = Epic::detail::EntityComponentIteratorImpl<E, M, Components...>;
 	
 private:
-	using Base = Epic::detail::EntityComponentIteratorBase;
+	using Base = Epic::detail::EntityComponentIteratorBase<E, M>;
+
+public:
+	using ValueType = typename Base::ValueType;
+	using EntityList = typename Base::EntityList;
 
 public:
-	EntityComponentIterator(Epic::EntityManager* pManager, size_t index, bool includeDestroyed) noexcept
-		: Base(pManager, index, includeDestroyed)
+	EntityComponentIteratorImpl(M* pManager, const EntityList* pList, size_t index, bool includeDestroyed) noexcept
+		: Base(pManager, pList, index, includeDestroyed)
 	{
-		m_AtEnd = (m_Index >= m_pManager->GetEntityCount());
+		Seek();
 	}
 
 public:
@@ -98,13 +112,13 @@ public:
 
 	bool operator== (const Type& other) const noexcept
 	{
-		if (m_pManager != other.m_pManager)
+		if (this->m_pManager != other.m_pManager)
 			return false;
 
 		if (AtEnd())
 			return other.AtEnd();
 
-		return m_Index == other.m_Index;
+		return this->m_Index == other.m_Index;
 	}
 
 	inline bool operator!= (const Type& other) const noexcept
@@ -114,21 +128,8 @@ public:
 
 	Type& operator++ () noexcept
 	{
-		++m_Index;
-		ValueType pValue = nullptr;
-
-		while (m_Index < m_pManager->GetEntityCount() &&
-			(pValue = Get()) &&
-			(!detail::EntityHasComponents<Components...>::Apply(pValue) ||
-			(pValue->IsDestroyPending() && !m_IncludeDestroyed)
-				))
-			++m_Index;
-
-		if (m_Index >= m_pManager->GetEntityCount())
-		{
-			m_AtEnd = true;
-			m_Index = m_pManager->GetEntityCount();
-		}
+		++this->m_Index;
+		Seek();
 
 		return *this;
 	}
@@ -136,120 +137,33 @@ public:
 public:
 	inline ValueType Get() const noexcept
 	{
-		return AtEnd() ? nullptr : m_pManager->GetEntityByIndex(m_Index);
+		return AtEnd() ? nullptr : (*this->m_pList)[this->m_Index];
 	}
 
 	inline bool AtEnd() const noexcept
 	{
-		return m_AtEnd || m_Index >= m_pManager->GetEntityCount();
-	}
-};
-
-//////////////////////////////////////////////////////////////////////////////
-
-// ConstEntityComponentIteratorBase
-class Epic::detail::ConstEntityComponentIteratorBase
-{
-public:
-	using Type = Epic::detail::ConstEntityComponentIteratorBase;
-	using ValueType = const Epic::Entity*;
-
-protected:
-	size_t m_Index;
-	const Epic::EntityManager* m_pManager;
-	bool m_AtEnd;
-	bool m_IncludeDestroyed;
-
-public:
-	ConstEntityComponentIteratorBase(const Epic::EntityManager* pManager, size_t index, bool includeDestroyed) noexcept
-		: m_pManager{ pManager }, m_Index{ index }, m_AtEnd{ true }, m_IncludeDestroyed{ includeDestroyed }
-	{ }
-
-public:
-	bool IncludeDestroyed() const noexcept
-	{
-		return m_IncludeDestroyed;
-	}
-
-	size_t GetIndex() const noexcept
-	{
-		return m_Index;
-	}
-
-	const Epic::EntityManager* GetEntityManager() const noexcept
-	{
-		return m_pManager;
+		return this->m_Index >= this->m_pList->size();
 	}
-};
 
-// ConstEntityComponentIterator<Components>
-template<class... Components>
-class Epic::detail::ConstEntityComponentIterator : public Epic::detail::ConstEntityComponentIteratorBase
-{
-public:
-	using Type = Epic::detail::ConstEntityComponentIterator<Components...>;
-	
 private:
-	using Base = Epic::detail::ConstEntityComponentIteratorBase;
-
-public:
-	ConstEntityComponentIterator(const Epic::EntityManager* pManager, size_t index, bool includeDestroyed) noexcept
-		: Base(pManager, index, includeDestroyed)
-	{
-		m_AtEnd = (m_Index >= m_pManager->GetEntityCount());
-	}
-
-public:
-	inline ValueType operator*() const noexcept
-	{
-		return Get();
-	}
-
-	bool operator== (const Type& other) const noexcept
-	{
-		if (m_pManager != other.m_pManager)
-			return false;
-
-		if (AtEnd())
-			return other.AtEnd();
-
-		return m_Index == other.m_Index;
-	}
-
-	inline bool operator!= (const Type& other) const noexcept
-	{
-		return !(this->operator== (other));
-	}
-
-	Type& operator++ () noexcept
+	// Advance to the first entity at or after m_Index that satisfies the filter
+	void Seek() noexcept
 	{
-		++m_Index;
-		ValueType pValue = nullptr;
-
-		while (m_Index < m_pManager->GetEntityCount() &&
-			(pValue = Get()) &&
-			(!detail::EntityHasComponents<Components...>::Apply(pValue) ||
-			(pValue->IsDestroyPending() && !m_IncludeDestroyed)
-				))
-			++m_Index;
-
-		if (m_Index >= m_pManager->GetEntityCount())
+		const size_t count = this->m_pList->size();
+		
+		while (this->m_Index < count)
 		{
-			m_AtEnd = true;
-			m_Index = m_pManager->GetEntityCount();
-		}
+			ValueType pValue = (*this->m_pList)[this->m_Index];
 
-		return *this;
-	}
+			if (pValue &&
+				(this->m_IncludeDestroyed || !pValue->IsDestroyPending()) &&
+				detail::EntityHasComponents<Components...>::Apply(pValue))
+				break;
 
-public:
-	inline ValueType Get() const noexcept
-	{
-		return AtEnd() ? nullptr : m_pManager->GetEntityByIndex(m_Index);
-	}
+			++this->m_Index;
+		}
 
-	inline bool AtEnd() const noexcept
-	{
-		return m_AtEnd || m_Index >= m_pManager->GetEntityCount();
+		if (this->m_Index > count)
+			this->m_Index = count;
 	}
 };
@@ -0,0 +1,409 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/EntityComponentTraits.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	class Entity;
+
+	namespace detail
+	{
+		template<class Family>
+		class EntityTypeIndexer;
+
+		struct EntityComponentFamily;
+		using EntityComponentTypeIndexer = EntityTypeIndexer<EntityComponentFamily>;
+
+		class EntityComponentPoolObserver;
+
+		class EntityComponentPoolBase;
+
+		template<class Component>
+		class EntityComponentPool;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityTypeIndexer<Family>
+template<class Family>
+class Epic::detail::EntityTypeIndexer
+{
+private:
+	static size_t NextIndex() noexcept
+	{
+		static std::atomic<size_t> s_NextIndex{ 0 };
+		return s_NextIndex++;
+	}
+
+public:
+	// Retrieve the dense, zero-based index assigned to T within Family.
+	// Indices are handed out on first use and are stable for the life of the program.
+	template<class T>
+	static size_t Get() noexcept
+	{
+		static const size_t s_Index = NextIndex();
+		return s_Index;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityComponentPoolObserver
+//	Receives notification when a component is added to or removed from a pool.
+class Epic::detail::EntityComponentPoolObserver
+{
+public:
+	virtual ~EntityComponentPoolObserver() { }
+
+public:
+	virtual void OnComponentAdded(Epic::Entity* pEntity, size_t entityIndex) = 0;
+	virtual void OnComponentRemoved(size_t entityIndex) = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityComponentPoolBase
+class Epic::detail::EntityComponentPoolBase
+{
+public:
+	using Type = Epic::detail::EntityComponentPoolBase;
+	using IndexType = uint32_t;
+	using VersionType = uint64_t;
+	using EntityList = Epic::STLVector<Epic::Entity*>;
+
+	static constexpr IndexType InvalidIndex = ~IndexType(0);
+
+protected:
+	// VersionSlot - A component's version.
+	// Stamps may be written by one worker while another reads them, so the value is 
+	// atomic.  Copies (made as the dense arrays are rearranged) are not.
+	struct VersionSlot
+	{
+		std::atomic<VersionType> Value;
+
+		VersionSlot(VersionType version) noexcept 
+			: Value{ version } 
+		{ }
+
+		VersionSlot(const VersionSlot& other) noexcept 
+			: Value{ other.Load() } 
+		{ }
+
+		VersionSlot& operator = (const VersionSlot& other) noexcept
+		{
+			Store(other.Load());
+			return *this;
+		}
+
+		inline VersionType Load() const noexcept
+		{
+			return Value.load(std::memory_order_relaxed);
+		}
+
+		inline void Store(VersionType version) noexcept
+		{
+			Value.store(version, std::memory_order_relaxed);
+		}
+	};
+
+	using IndexList = Epic::STLVector<IndexType>;
+	using VersionList = Epic::STLVector<VersionSlot>;
+	using ObserverList = Epic::STLVector<Epic::detail::EntityComponentPoolObserver*>;
+
+protected:
+	Epic::EntityComponentID m_ComponentID;	// The component type ID stored by this pool
+	const VersionType* m_pVersion;			// The controlling storage's current version
+	IndexList m_Sparse;						// Maps entity indices to dense indices
+	IndexList m_Indices;					// Maps dense indices to entity indices
+	EntityList m_Entities;					// Maps dense indices to owning entities
+	VersionList m_Versions;					// Maps dense indices to the version at which the component last changed
+	std::atomic<VersionType> m_ChangedVersion;	// The version at which any component in this pool last changed
+	ObserverList m_Observers;				// Notified when components are added or removed
+
+public:
+	EntityComponentPoolBase(Epic::EntityComponentID id, const VersionType* pVersion) noexcept
+		: m_ComponentID{ id }, m_pVersion{ pVersion }, m_ChangedVersion{ 0 }
+	{ }
+
+	EntityComponentPoolBase(const Type&) = delete;
+	EntityComponentPoolBase& operator = (const Type&) = delete;
+
+	virtual ~EntityComponentPoolBase() { }
+
+public:
+	inline Epic::EntityComponentID GetComponentID() const noexcept
+	{
+		return m_ComponentID;
+	}
+
+	inline size_t Size() const noexcept
+	{
+		return m_Entities.size();
+	}
+
+	// Retrieve the packed list of entities that have this component
+	inline const EntityList& GetEntities() const noexcept
+	{
+		return m_Entities;
+	}
+
+	// Query whether or not the entity at entityIndex has this component
+	inline bool Has(size_t entityIndex) const noexcept
+	{
+		return entityIndex < m_Sparse.size() && m_Sparse[entityIndex] != InvalidIndex;
+	}
+
+	// Retrieve the version at which the component attached to the entity at entityIndex last changed
+	inline VersionType GetVersion(size_t entityIndex) const noexcept
+	{
+		assert(Has(entityIndex));
+		return m_Versions[m_Sparse[entityIndex]].Load();
+	}
+
+	// Retrieve the version at which any component in this pool last changed
+	inline VersionType GetChangedVersion() const noexcept
+	{
+		return m_ChangedVersion.load(std::memory_order_relaxed);
+	}
+
+	// Query whether or not any component in this pool changed after version 'since'
+	inline bool ChangedSince(VersionType since) const noexcept
+	{
+		return GetChangedVersion() > since;
+	}
+
+	// Stamp the component attached to the entity at entityIndex with the current version
+	inline void MarkChanged(size_t entityIndex) noexcept
+	{
+		assert(Has(entityIndex));
+		m_Versions[m_Sparse[entityIndex]].Store(*m_pVersion);
+		MarkPoolChanged();
+	}
+
+public:
+	void AddObserver(Epic::detail::EntityComponentPoolObserver* pObserver)
+	{
+		m_Observers.emplace_back(pObserver);
+	}
+
+	void RemoveObserver(Epic::detail::EntityComponentPoolObserver* pObserver) noexcept
+	{
+		for (size_t i = 0; i < m_Observers.size(); ++i)
+		{
+			if (m_Observers[i] == pObserver)
+			{
+				m_Observers.erase(m_Observers.begin() + i);
+				break;
+			}
+		}
+	}
+
+public:
+	// Remove the component from the entity at entityIndex.
+	// Returns whether or not a component was removed.
+	virtual bool Erase(size_t entityIndex) noexcept = 0;
+
+	// Remove every component in this pool.
+	virtual void Clear() noexcept = 0;
+
+protected:
+	// Register pEntity in the dense arrays. Returns the new dense index.
+	size_t Insert(Epic::Entity* pEntity, size_t entityIndex)
+	{
+		assert(!Has(entityIndex));
+
+		if (entityIndex >= m_Sparse.size())
+			m_Sparse.resize(entityIndex + 1, InvalidIndex);
+
+		const size_t dense = m_Entities.size();
+
+		m_Sparse[entityIndex] = static_cast<IndexType>(dense);
+		m_Indices.emplace_back(static_cast<IndexType>(entityIndex));
+		m_Entities.emplace_back(pEntity);
+		m_Versions.emplace_back(*m_pVersion);
+		MarkPoolChanged();
+
+		return dense;
+	}
+
+	// Unregister the entity at entityIndex from the dense arrays by swapping the
+	// last dense entry into its place. Returns the dense index that was vacated.
+	size_t Remove(size_t entityIndex) noexcept
+	{
+		assert(Has(entityIndex));
+
+		const size_t dense = m_Sparse[entityIndex];
+		const size_t last = m_Entities.size() - 1;
+
+		if (dense != last)
+		{
+			m_Indices[dense] = m_Indices[last];
+			m_Entities[dense] = m_Entities[last];
+			m_Versions[dense] = m_Versions[last];
+			m_Sparse[m_Indices[dense]] = static_cast<IndexType>(dense);
+		}
+
+		m_Indices.pop_back();
+		m_Entities.pop_back();
+		m_Versions.pop_back();
+		m_Sparse[entityIndex] = InvalidIndex;
+
+		return dense;
+	}
+
+	void RemoveAll() noexcept
+	{
+		for (auto index : m_Indices)
+			m_Sparse[index] = InvalidIndex;
+
+		for (auto pObserver : m_Observers)
+		{
+			for (auto index : m_Indices)
+				pObserver->OnComponentRemoved(index);
+		}
+
+		m_Indices.clear();
+		m_Entities.clear();
+		m_Versions.clear();
+	}
+
+	inline void MarkPoolChanged() noexcept
+	{
+		// Avoid contending on the cache line when many threads stamp during the same version
+		const VersionType version = *m_pVersion;
+
+		if (m_ChangedVersion.load(std::memory_order_relaxed) != version)
+			m_ChangedVersion.store(version, std::memory_order_relaxed);
+	}
+
+	inline void NotifyAdded(Epic::Entity* pEntity, size_t entityIndex)
+	{
+		for (auto pObserver : m_Observers)
+			pObserver->OnComponentAdded(pEntity, entityIndex);
+	}
+
+	inline void NotifyRemoved(size_t entityIndex) noexcept
+	{
+		for (auto pObserver : m_Observers)
+			pObserver->OnComponentRemoved(entityIndex);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityComponentPool<C>
+template<class C>
+class Epic::detail::EntityComponentPool : public Epic::detail::EntityComponentPoolBase
+{
+public:
+	using Type = Epic::detail::EntityComponentPool<C>;
+	using Base = Epic::detail::EntityComponentPoolBase;
+	using ComponentType = C;
+
+private:
+	using ComponentList = Epic::STLVector<ComponentType>;
+
+private:
+	ComponentList m_Components;		// Component data (parallel to the dense arrays)
+
+public:
+	explicit EntityComponentPool(const VersionType* pVersion) noexcept
+		: Base{ Epic::EntityComponentTraits<ComponentType>::ID, pVersion }
+	{ }
+
+public:
+	// Get the component attached to the entity at entityIndex
+	inline ComponentType& Get(size_t entityIndex) noexcept
+	{
+		assert(Has(entityIndex));
+		return m_Components[m_Sparse[entityIndex]];
+	}
+
+	// Get the component attached to the entity at entityIndex
+	inline const ComponentType& Get(size_t entityIndex) const noexcept
+	{
+		assert(Has(entityIndex));
+		return m_Components[m_Sparse[entityIndex]];
+	}
+
+	// Get the packed component data
+	inline ComponentType* Data() noexcept
+	{
+		return m_Components.data();
+	}
+
+	// Get the packed component data
+	inline const ComponentType* Data() const noexcept
+	{
+		return m_Components.data();
+	}
+
+public:
+	// Attach a component to the entity at entityIndex (replacing any existing component).
+	// Args... are forwarded to Component's ctor
+	template<class... Args>
+	ComponentType& Assign(Epic::Entity* pEntity, size_t entityIndex, Args&&... args)
+	{
+		if (Has(entityIndex))
+		{
+			const size_t dense = m_Sparse[entityIndex];
+			
+			m_Components[dense] = ComponentType{ std::forward<Args>(args)... };
+			m_Versions[dense].Store(*m_pVersion);
+			MarkPoolChanged();
+
+			return m_Components[dense];
+		}
+
+		Insert(pEntity, entityIndex);
+		m_Components.emplace_back(ComponentType{ std::forward<Args>(args)... });
+		
+		NotifyAdded(pEntity, entityIndex);
+
+		return m_Components.back();
+	}
+
+	bool Erase(size_t entityIndex) noexcept override
+	{
+		if (!Has(entityIndex))
+			return false;
+
+		const size_t dense = Remove(entityIndex);
+
+		if (dense != m_Components.size() - 1)
+			m_Components[dense] = std::move(m_Components.back());
+
+		m_Components.pop_back();
+
+		NotifyRemoved(entityIndex);
+
+		return true;
+	}
+
+	void Clear() noexcept override
+	{
+		RemoveAll();
+		m_Components.clear();
+	}
+};
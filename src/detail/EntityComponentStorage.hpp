@@ -0,0 +1,258 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Epic/detail/EntityComponentPool.hpp>
+#include <Epic/STL/UniquePtr.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <algorithm>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic
+{
+	template<class... Components>
+	class EntityQuery;
+
+	namespace detail
+	{
+		class EntityQueryBase;
+
+		class EntityComponentStorage;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// EntityComponentStorage
+class Epic::detail::EntityComponentStorage
+{
+public:
+	using Type = Epic::detail::EntityComponentStorage;
+	using EntityList = Epic::detail::EntityComponentPoolBase::EntityList;
+	using VersionType = Epic::detail::EntityComponentPoolBase::VersionType;
+
+private:
+	using PoolPtr = Epic::UniquePtr<Epic::detail::EntityComponentPoolBase>;
+	using PoolList = Epic::STLVector<PoolPtr>;
+	using QueryPtr = Epic::UniquePtr<Epic::detail::EntityQueryBase>;
+	using QueryList = Epic::STLVector<QueryPtr>;
+	using QueryTypeIndexer = Epic::detail::EntityTypeIndexer<Epic::detail::EntityQueryBase>;
+
+	template<class Component>
+	using PoolType = Epic::detail::EntityComponentPool<Component>;
+
+private:
+	VersionType m_Version;	// The current version (stamped on components as they change)
+	PoolList m_Pools;		// Maps component type indices to component pools
+	QueryList m_Queries;	// Maps query type indices to queries (destroyed before m_Pools)
+
+public:
+	EntityComponentStorage() noexcept 
+		: m_Version{ 1 }
+	{ }
+
+	EntityComponentStorage(const Type&) = delete;
+	EntityComponentStorage& operator = (const Type&) = delete;
+
+public:
+	// Retrieve the pool for Component, or nullptr if it has not been created
+	template<class Component>
+	PoolType<Component>* FindPool() noexcept
+	{
+		const size_t index = Epic::detail::EntityComponentTypeIndexer::Get<Component>();
+
+		if (index >= m_Pools.size())
+			return nullptr;
+
+		return static_cast<PoolType<Component>*>(m_Pools[index].get());
+	}
+
+	// Retrieve the pool for Component, or nullptr if it has not been created
+	template<class Component>
+	const PoolType<Component>* FindPool() const noexcept
+	{
+		const size_t index = Epic::detail::EntityComponentTypeIndexer::Get<Component>();
+
+		if (index >= m_Pools.size())
+			return nullptr;
+
+		return static_cast<const PoolType<Component>*>(m_Pools[index].get());
+	}
+
+	// Retrieve the pool for Component, creating it if necessary
+	template<class Component>
+	PoolType<Component>& GetPool()
+	{
+		const size_t index = Epic::detail::EntityComponentTypeIndexer::Get<Component>();
+
+		if (index >= m_Pools.size())
+			m_Pools.resize(index + 1);
+
+		if (!m_Pools[index])
+			m_Pools[index] = Epic::MakeImpl<Epic::detail::EntityComponentPoolBase, PoolType<Component>>(&m_Version);
+
+		return static_cast<PoolType<Component>&>(*m_Pools[index]);
+	}
+
+	// Retrieve the query for Components, creating it if necessary.
+	// NOTE: EntityQuery.hpp must be included to use this.
+	template<class... Components>
+	Epic::EntityQuery<Components...>& GetQuery()
+	{
+		using QueryType = Epic::EntityQuery<Components...>;
+
+		const size_t index = QueryTypeIndexer::Get<QueryType>();
+
+		if (index >= m_Queries.size())
+			m_Queries.resize(index + 1);
+
+		if (!m_Queries[index])
+			m_Queries[index] = Epic::MakeImpl<Epic::detail::EntityQueryBase, QueryType>(GetPool<Components>()...);
+
+		return static_cast<QueryType&>(*m_Queries[index]);
+	}
+
+public:
+	inline VersionType GetVersion() const noexcept
+	{
+		return m_Version;
+	}
+
+	inline void NextVersion() noexcept
+	{
+		++m_Version;
+	}
+
+public:
+	template<class Component>
+	inline bool Has(size_t entityIndex) const noexcept
+	{
+		auto pPool = FindPool<Component>();
+		return pPool && pPool->Has(entityIndex);
+	}
+
+	template<class Component, class... Args>
+	inline Component& Assign(Epic::Entity* pEntity, size_t entityIndex, Args&&... args)
+	{
+		return GetPool<Component>().Assign(pEntity, entityIndex, std::forward<Args>(args)...);
+	}
+
+	template<class Component>
+	inline bool Erase(size_t entityIndex) noexcept
+	{
+		auto pPool = FindPool<Component>();
+		return pPool && pPool->Erase(entityIndex);
+	}
+
+	template<class Component>
+	inline Component& Get(size_t entityIndex) noexcept
+	{
+		auto pPool = FindPool<Component>();
+		assert(pPool);
+
+		return pPool->Get(entityIndex);
+	}
+
+	// Get a component and stamp it as changed
+	template<class Component>
+	inline Component& Modify(size_t entityIndex) noexcept
+	{
+		auto pPool = FindPool<Component>();
+		assert(pPool);
+
+		pPool->MarkChanged(entityIndex);
+
+		return pPool->Get(entityIndex);
+	}
+
+	template<class Component>
+	inline void MarkChanged(size_t entityIndex) noexcept
+	{
+		auto pPool = FindPool<Component>();
+		assert(pPool);
+
+		pPool->MarkChanged(entityIndex);
+	}
+
+	template<class Component>
+	inline VersionType GetVersion(size_t entityIndex) const noexcept
+	{
+		auto pPool = FindPool<Component>();
+		assert(pPool);
+
+		return pPool->GetVersion(entityIndex);
+	}
+
+	template<class Component>
+	inline const Component& Get(size_t entityIndex) const noexcept
+	{
+		auto pPool = FindPool<Component>();
+		assert(pPool);
+
+		return pPool->Get(entityIndex);
+	}
+
+	// Erase every component attached to the entity at entityIndex.
+	// 'fn' is called with each component's ID before the component is erased.
+	template<class Function>
+	void EraseAll(size_t entityIndex, Function&& fn) noexcept
+	{
+		for (auto& pPool : m_Pools)
+		{
+			if (pPool && pPool->Has(entityIndex))
+			{
+				fn(pPool->GetComponentID());
+				pPool->Erase(entityIndex);
+			}
+		}
+	}
+
+	// Erase every component from every pool
+	void Clear() noexcept
+	{
+		for (auto& pPool : m_Pools)
+		{
+			if (pPool)
+				pPool->Clear();
+		}
+	}
+
+public:
+	// Retrieve the shortest packed entity list among the pools of Components.
+	// Iterating this list and filtering with Has<>() visits every entity that has
+	// ALL Components.  Returns nullptr if any of the pools does not exist.
+	template<class Component, class... Components>
+	const EntityList* FindSmallestList() const noexcept
+	{
+		auto pPool = FindPool<Component>();
+		if (!pPool)
+			return nullptr;
+
+		const EntityList* pList = &pPool->GetEntities();
+
+		if constexpr (sizeof...(Components) > 0)
+		{
+			const EntityList* pOther = FindSmallestList<Components...>();
+			if (!pOther)
+				return nullptr;
+
+			if (pOther->size() < pList->size())
+				pList = pOther;
+		}
+
+		return pList;
+	}
+};
@@ -52,14 +52,7 @@ private:
 public:
 	EntityComponentViewImpl(const Iterator& itBegin, const Iterator& itEnd) noexcept
 		: m_IterBegin{ itBegin }, m_IterEnd{ itEnd }
-	{
-		if (*m_IterBegin == nullptr ||
-			((*m_IterBegin)->IsDestroyPending() && !m_IterBegin.IncludeDestroyed()) ||
-			!detail::EntityHasComponents<Components...>::Apply(*m_IterBegin) )
-		{
-			++m_IterBegin;
-		}
-	}
+	{ }
 
 public:
 	inline auto begin() noexcept
@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/Memory/CascadingAllocator.hpp>
+#include <Epic/Memory/HeapAllocator.hpp>
+#include <Epic/Memory/Mallocator.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using NodeTemplate = Epic::SharedHeapAllocator<64, 64, Epic::Mallocator>;
+
+	constexpr size_t NodeSize = Epic::CascadingAllocatorNodeSize<NodeTemplate>::value;
+
+	/// IndexCountingMallocator - A Mallocator that tracks the live bytes of non-node blocks
+	class IndexCountingMallocator : public Epic::Mallocator
+	{
+	public:
+		static std::atomic<size_t> s_LiveIndexBytes;
+		static std::atomic<size_t> s_PeakIndexBytes;
+
+	public:
+		Epic::Blk Allocate(size_t sz) const noexcept
+		{
+			Epic::Blk blk = Epic::Mallocator::Allocate(sz);
+
+			if (blk && sz != NodeSize)
+			{
+				const size_t live = s_LiveIndexBytes.fetch_add(sz) + sz;
+				if (live > s_PeakIndexBytes.load())
+					s_PeakIndexBytes.store(live);
+			}
+
+			return blk;
+		}
+
+		void Deallocate(const Epic::Blk& blk)
+		{
+			if (blk.Size != NodeSize)
+				s_LiveIndexBytes.fetch_sub(blk.Size);
+
+			Epic::Mallocator::Deallocate(blk);
+		}
+	};
+
+	std::atomic<size_t> IndexCountingMallocator::s_LiveIndexBytes{ 0 };
+	std::atomic<size_t> IndexCountingMallocator::s_PeakIndexBytes{ 0 };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(SharedCascading_RetainedIndexMemoryIsLinear)
+{
+	constexpr size_t BlocksPerNode = 64;
+	constexpr size_t NodeCount = 1024;
+
+	// One index entry is three words
+	constexpr size_t EntrySize = 3 * sizeof(void*);
+
+	IndexCountingMallocator::s_LiveIndexBytes = 0;
+	IndexCountingMallocator::s_PeakIndexBytes = 0;
+
+	{
+		Epic::SharedCascadingAllocator<NodeTemplate, IndexCountingMallocator, Epic::eCascadingOwnership::Sorted> allocator;
+		Epic::STLVector<Epic::Blk> blocks;
+
+		for (size_t i = 0; i < NodeCount * BlocksPerNode; ++i)
+		{
+			blocks.push_back(allocator.Allocate(64));
+			EPIC_CHECK(blocks.back());
+		}
+
+		// Every lookup must still find its block's node
+		for (auto& blk : blocks)
+			EPIC_CHECK(allocator.Owns(blk));
+
+		for (auto& blk : blocks)
+			allocator.Deallocate(blk);
+
+		// Rebuilding every few nodes retains O(n^2) entries (about 1.6 MB here)
+		EPIC_CHECK(IndexCountingMallocator::s_PeakIndexBytes.load() < 8 * NodeCount * EntrySize);
+	}
+
+	EPIC_CHECK(IndexCountingMallocator::s_LiveIndexBytes.load() == 0);
+}
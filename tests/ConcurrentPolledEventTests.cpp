@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/ConcurrentPolledEvent.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(ConcurrentPolledEvent_Poll_DeliversInPostOrder)
+{
+	Epic::ConcurrentPolledEvent<void(int)> evt{ 8 };
+	std::vector<int> received;
+
+	evt.Connect([&] (int x) { received.push_back(x); });
+
+	for (int i = 0; i < 5; ++i)
+		EPIC_CHECK(evt(i));
+
+	EPIC_CHECK(received.empty());
+	EPIC_CHECK(evt.Poll() == 5);
+	EPIC_CHECK((received == std::vector<int>{ 0, 1, 2, 3, 4 }));
+	EPIC_CHECK(evt.Poll() == 0);
+}
+
+EPIC_TEST(ConcurrentPolledEvent_Full_DropsAndCounts)
+{
+	Epic::ConcurrentPolledEvent<void(int)> evt{ 4, Epic::eEventBackPressure::Drop };
+	std::vector<int> received;
+
+	evt.Connect([&] (int x) { received.push_back(x); });
+
+	EPIC_CHECK(evt.GetCapacity() == 4);
+
+	size_t accepted = 0;
+	for (int i = 0; i < 6; ++i)
+		accepted += evt(i) ? 1 : 0;
+
+	EPIC_CHECK(accepted == 4);
+	EPIC_CHECK(evt.GetDroppedCount() == 2);
+	EPIC_CHECK(evt.Poll() == 4);
+	EPIC_CHECK((received == std::vector<int>{ 0, 1, 2, 3 }));
+
+	// Space is released once the invocations have been polled
+	EPIC_CHECK(evt(9));
+	EPIC_CHECK(evt.Poll() == 1);
+}
+
+EPIC_TEST(ConcurrentPolledEvent_Reposts_PollIsBoundedByCapacity)
+{
+	Epic::ConcurrentPolledEvent<void(int)> evt{ 4 };
+	size_t calls = 0;
+
+	// Every invocation posts another, so an unbounded poll would never return
+	evt.Connect([&] (int x) { ++calls; evt(x + 1); });
+
+	evt(0);
+
+	EPIC_CHECK(evt.Poll() == 4);
+	EPIC_CHECK(calls == 4);
+	EPIC_CHECK(evt.Poll() == 4);
+	EPIC_CHECK(calls == 8);
+}
+
+EPIC_TEST(ConcurrentPolledEvent_Destroyed_ReleasesPendingArguments)
+{
+	auto pShared = std::make_shared<int>(0);
+
+	{
+		Epic::ConcurrentPolledEvent<void(std::shared_ptr<int>)> evt{ 4 };
+
+		evt(pShared);
+		evt(pShared);
+		EPIC_CHECK(pShared.use_count() == 3);
+	}
+
+	EPIC_CHECK(pShared.use_count() == 1);
+}
+
+EPIC_TEST(ConcurrentPolledEvent_Producers_DeliverAllInOrder)
+{
+	constexpr int ProducerCount = 4;
+	constexpr int PostsPerProducer = 5000;
+
+	Epic::ConcurrentPolledEvent<void(int, int)> evt{ 64, Epic::eEventBackPressure::Wait };
+
+	// Each producer's invocations must arrive in the order they were posted
+	int nextExpected[ProducerCount] = { };
+	bool inOrder = true;
+	int received = 0;
+
+	evt.Connect([&] (int producer, int value)
+	{
+		inOrder = inOrder && (value == nextExpected[producer]);
+		nextExpected[producer] = value + 1;
+		++received;
+	});
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < ProducerCount; ++p)
+	{
+		producers.emplace_back([&evt, p]
+		{
+			for (int i = 0; i < PostsPerProducer; ++i)
+				evt(p, i);
+		});
+	}
+
+	while (received < ProducerCount * PostsPerProducer)
+	{
+		if (evt.Poll() == 0)
+			std::this_thread::yield();
+	}
+
+	for (auto& producer : producers)
+		producer.join();
+
+	EPIC_CHECK(inOrder);
+	EPIC_CHECK(received == ProducerCount * PostsPerProducer);
+	EPIC_CHECK(evt.GetDroppedCount() == 0);
+	EPIC_CHECK(evt.Poll() == 0);
+}
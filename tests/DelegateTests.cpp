@@ -0,0 +1,158 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/Delegate.hpp>
+#include <array>
+#include <memory>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	int AddOne(int x) { return x + 1; }
+	int AddTwo(int x) { return x + 2; }
+
+	struct Accumulator
+	{
+		int Total = 0;
+
+		int Add(int x) { return Total += x; }
+		int Scaled(int x) const { return Total * x; }
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(Delegate_Empty_IsFalseAndEqual)
+{
+	Epic::Delegate<int(int)> a;
+	Epic::Delegate<int(int)> b{ nullptr };
+
+	EPIC_CHECK(!a);
+	EPIC_CHECK(a == b);
+	EPIC_CHECK(a.GetInstance() == 0);
+}
+
+EPIC_TEST(Delegate_FunctionPointer_InvokesAndCompares)
+{
+	Epic::Delegate<int(int)> one{ &AddOne };
+	Epic::Delegate<int(int)> alsoOne{ &AddOne };
+	Epic::Delegate<int(int)> two{ &AddTwo };
+
+	EPIC_CHECK(one(1) == 2);
+	EPIC_CHECK(two(1) == 3);
+	EPIC_CHECK(one == alsoOne);
+	EPIC_CHECK(one != two);
+}
+
+EPIC_TEST(Delegate_MemberFunction_ComparesByInstance)
+{
+	Accumulator a, b;
+
+	Epic::Delegate<int(int)> addA{ &a, &Accumulator::Add };
+	Epic::Delegate<int(int)> addA2{ &a, &Accumulator::Add };
+	Epic::Delegate<int(int)> addB{ &b, &Accumulator::Add };
+	Epic::Delegate<int(int)> scaledA{ static_cast<const Accumulator*>(&a), &Accumulator::Scaled };
+
+	EPIC_CHECK(addA(5) == 5);
+	EPIC_CHECK(addA2(2) == 7);
+	EPIC_CHECK(scaledA(3) == 21);
+	EPIC_CHECK(b.Total == 0);
+
+	EPIC_CHECK(addA == addA2);
+	EPIC_CHECK(addA != addB);
+	EPIC_CHECK(addA != scaledA);
+	EPIC_CHECK(addA.GetInstance() == reinterpret_cast<intptr_t>(&a));
+}
+
+EPIC_TEST(Delegate_Bind_CallsMethodOnInstance)
+{
+	Accumulator a;
+
+	auto bound = Epic::Delegate<int(int)>::Bind<&Accumulator::Add>(&a);
+	auto boundAgain = Epic::Delegate<int(int)>::Bind<&Accumulator::Add>(&a);
+
+	EPIC_CHECK(bound(4) == 4);
+	EPIC_CHECK(a.Total == 4);
+	EPIC_CHECK(bound == boundAgain);
+	EPIC_CHECK(bound.GetInstance() == reinterpret_cast<intptr_t>(&a));
+}
+
+EPIC_TEST(Delegate_FunctionObjects_NeverCompareEqual)
+{
+	auto fn = [] (int x) { return x * 2; };
+
+	Epic::Delegate<int(int)> a{ fn };
+	Epic::Delegate<int(int)> b{ a };
+
+	EPIC_CHECK(a(3) == 6);
+	EPIC_CHECK(b(4) == 8);
+	EPIC_CHECK(a != b);
+	EPIC_CHECK(a.GetInstance() == 0);
+}
+
+EPIC_TEST(Delegate_InlineTarget_CopiesMovesAndDestroys)
+{
+	auto pCounter = std::make_shared<int>(0);
+
+	{
+		Epic::Delegate<int(int)> a{ [pCounter] (int x) { return *pCounter += x; } };
+		EPIC_CHECK(pCounter.use_count() == 2);
+
+		Epic::Delegate<int(int)> b{ a };
+		EPIC_CHECK(pCounter.use_count() == 3);
+
+		Epic::Delegate<int(int)> c{ std::move(a) };
+		EPIC_CHECK(!a);
+		EPIC_CHECK(pCounter.use_count() == 3);
+
+		EPIC_CHECK(b(2) == 2);
+		EPIC_CHECK(c(3) == 5);
+
+		b = nullptr;
+		EPIC_CHECK(!b);
+		EPIC_CHECK(pCounter.use_count() == 2);
+	}
+
+	EPIC_CHECK(pCounter.use_count() == 1);
+}
+
+EPIC_TEST(Delegate_LargeTarget_CopiesMovesAndDestroys)
+{
+	auto pCounter = std::make_shared<int>(0);
+	std::array<int, 16> weights;
+	weights.fill(1);
+
+	// Too large for the inline buffer; stored on the heap
+	auto fn = [pCounter, weights] (int x) { return *pCounter += x * weights[15]; };
+	static_assert(sizeof(fn) > Epic::Delegate<int(int)>::BufferSize, "The target must not fit inline.");
+
+	{
+		Epic::Delegate<int(int)> a{ fn };
+		Epic::Delegate<int(int)> b;
+
+		b = a;
+		EPIC_CHECK(pCounter.use_count() == 4);
+
+		Epic::Delegate<int(int)> c;
+		c = std::move(a);
+		EPIC_CHECK(!a);
+		EPIC_CHECK(pCounter.use_count() == 4);
+
+		EPIC_CHECK(b(1) == 1);
+		EPIC_CHECK(c(2) == 3);
+	}
+
+	EPIC_CHECK(pCounter.use_count() == 2);
+}
@@ -0,0 +1,191 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/EntityManager.hpp>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	struct TestPosition { float X, Y; };
+	struct TestVelocity { float X, Y; };
+}
+
+MAKE_ENTITY_COMPONENT(TestPosition);
+MAKE_ENTITY_COMPONENT(TestVelocity);
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	/// NotificationLog - Records the batched notifications raised by Apply()
+	class NotificationLog : public Epic::EntitySystem
+	{
+	public:
+		std::vector<std::string> Entries;
+
+	public:
+		using EntitySystem::EntitySystem;
+
+		void Update() override { }
+
+	protected:
+		void EntitiesCreated(Epic::Entity* const*, size_t count) override
+		{
+			Entries.push_back("created:" + std::to_string(count));
+		}
+
+		void EntitiesDestroyed(Epic::Entity* const*, size_t count) override
+		{
+			Entries.push_back("destroyed:" + std::to_string(count));
+		}
+
+		void EntityComponentsAttached(Epic::EntityComponentID, Epic::Entity* const*, size_t count) override
+		{
+			Entries.push_back("attached:" + std::to_string(count));
+		}
+
+		void EntityComponentsDetached(Epic::EntityComponentID, Epic::Entity* const*, size_t count) override
+		{
+			Entries.push_back("detached:" + std::to_string(count));
+		}
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(CommandBuffer_EraseThenAssign_LeavesComponent)
+{
+	Epic::EntityManager manager;
+	auto pLog = manager.CreateSystem<NotificationLog>();
+
+	auto pEntity = manager.CreateEntity();
+	pEntity->Assign<TestPosition>(1.0f, 1.0f);
+
+	auto& commands = manager.GetCommandBuffer();
+	commands.Erase<TestPosition>(pEntity);
+	commands.Assign<TestPosition>(pEntity, 5.0f, 6.0f);
+
+	pLog->Entries.clear();
+	manager.Apply(commands);
+
+	EPIC_CHECK(pEntity->Has<TestPosition>());
+	EPIC_CHECK(pEntity->Has<TestPosition>() && pEntity->Get<TestPosition>().X == 5.0f);
+	EPIC_CHECK((pLog->Entries == std::vector<std::string>{ "attached:1" }));
+}
+
+EPIC_TEST(CommandBuffer_AssignThenErase_RemovesComponent)
+{
+	Epic::EntityManager manager;
+
+	auto pEntity = manager.CreateEntity();
+
+	auto& commands = manager.GetCommandBuffer();
+	commands.Assign<TestPosition>(pEntity, 5.0f, 6.0f);
+	commands.Erase<TestPosition>(pEntity);
+	manager.Apply(commands);
+
+	EPIC_CHECK(!pEntity->Has<TestPosition>());
+}
+
+EPIC_TEST(CommandBuffer_AssignAfterDestroy_IsIgnored)
+{
+	Epic::EntityManager manager;
+	auto pLog = manager.CreateSystem<NotificationLog>();
+
+	auto pEntity = manager.CreateEntity();
+	auto pOther = manager.CreateEntity();
+
+	auto& commands = manager.GetCommandBuffer();
+	commands.Assign<TestVelocity>(pEntity, 1.0f, 1.0f);
+	commands.DestroyEntity(pEntity);
+	commands.Assign<TestPosition>(pEntity, 2.0f, 2.0f);
+	commands.Assign<TestPosition>(pOther, 3.0f, 3.0f);
+
+	pLog->Entries.clear();
+	manager.Apply(commands);
+
+	EPIC_CHECK(pEntity->IsDestroyPending());
+	EPIC_CHECK(pEntity->Has<TestVelocity>());
+	EPIC_CHECK(!pEntity->Has<TestPosition>());
+	EPIC_CHECK(pOther->Has<TestPosition>());
+	EPIC_CHECK((pLog->Entries == std::vector<std::string>{ "attached:1", "attached:1", "destroyed:1" }));
+}
+
+EPIC_TEST(CommandBuffer_PendingEntity_ReceivesComponents)
+{
+	Epic::EntityManager manager;
+	auto pLog = manager.CreateSystem<NotificationLog>();
+
+	auto& commands = manager.GetCommandBuffer();
+
+	auto first = commands.CreateEntity();
+	auto second = commands.CreateEntity();
+	commands.Assign<TestPosition>(first, 1.0f, 2.0f);
+	commands.Assign<TestPosition>(second, 3.0f, 4.0f);
+	commands.DestroyEntity(second);
+	commands.Assign<TestVelocity>(second, 1.0f, 1.0f);
+
+	manager.Apply(commands);
+
+	size_t count = 0, destroyed = 0;
+	for (auto pEntity : manager.Each<TestPosition>(true))
+	{
+		++count;
+		destroyed += pEntity->IsDestroyPending() ? 1 : 0;
+		EPIC_CHECK(!pEntity->Has<TestVelocity>());
+	}
+
+	EPIC_CHECK(count == 2);
+	EPIC_CHECK(destroyed == 1);
+	EPIC_CHECK((pLog->Entries == std::vector<std::string>{ "created:2", "attached:2", "destroyed:1" }));
+}
+
+EPIC_TEST(CommandBuffer_InterleavedCommands_BatchPerComponentType)
+{
+	constexpr size_t EntityCount = 100;
+
+	Epic::EntityManager manager;
+	auto pLog = manager.CreateSystem<NotificationLog>();
+
+	auto& commands = manager.GetCommandBuffer();
+
+	// A level load: each entity is created and given both components in turn
+	for (size_t i = 0; i < EntityCount; ++i)
+	{
+		auto entity = commands.CreateEntity();
+		commands.Assign<TestPosition>(entity, float(i), 0.0f);
+		commands.Assign<TestVelocity>(entity, 1.0f, 1.0f);
+		commands.Assign<TestPosition>(entity, float(i), 1.0f);
+	}
+
+	manager.Apply(commands);
+
+	EPIC_CHECK((pLog->Entries == std::vector<std::string>
+	{ 
+		"created:" + std::to_string(EntityCount), 
+		"attached:" + std::to_string(EntityCount), 
+		"attached:" + std::to_string(EntityCount) 
+	}));
+
+	size_t count = 0;
+	for (auto pEntity : manager.Each<TestPosition, TestVelocity>())
+	{
+		EPIC_CHECK(pEntity->Get<TestPosition>().Y == 1.0f);
+		++count;
+	}
+
+	EPIC_CHECK(count == EntityCount);
+}
@@ -0,0 +1,114 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/EntityManager.hpp>
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(EntityHandle_Default_IsNullAndInvalid)
+{
+	Epic::EntityManager manager;
+	const Epic::EntityID id;
+
+	EPIC_CHECK(id.IsNull());
+	EPIC_CHECK(!id);
+	EPIC_CHECK(!manager.IsValid(id));
+	EPIC_CHECK(manager.GetEntity(id) == nullptr);
+}
+
+EPIC_TEST(EntityHandle_Destroyed_BecomesStale)
+{
+	Epic::EntityManager manager;
+
+	auto pEntity = manager.CreateEntity();
+	const Epic::EntityID id = pEntity->GetID();
+
+	EPIC_CHECK(!id.IsNull());
+	EPIC_CHECK(manager.IsValid(id));
+	EPIC_CHECK(manager.GetEntity(id) == pEntity);
+
+	manager.DestroyEntity(id, true);
+
+	EPIC_CHECK(!id.IsNull());
+	EPIC_CHECK(!manager.IsValid(id));
+	EPIC_CHECK(manager.GetEntity(id) == nullptr);
+	EPIC_CHECK(manager.GetEntityCount() == 0);
+}
+
+EPIC_TEST(EntityHandle_DeferredDestroy_StaysValidUntilUpdate)
+{
+	Epic::EntityManager manager;
+
+	const Epic::EntityID id = manager.CreateEntity()->GetID();
+
+	manager.DestroyEntity(id);
+	EPIC_CHECK(manager.IsValid(id));
+
+	manager.Update();
+	EPIC_CHECK(!manager.IsValid(id));
+}
+
+EPIC_TEST(EntityHandle_ReusedSlot_HasNewGeneration)
+{
+	Epic::EntityManager manager;
+
+	const Epic::EntityID stale = manager.CreateEntity()->GetID();
+	manager.DestroyEntity(stale, true);
+
+	auto pEntity = manager.CreateEntity();
+	const Epic::EntityID fresh = pEntity->GetID();
+
+	// The slot is recycled, but the old handle must not alias the new entity
+	EPIC_CHECK(fresh.Index == stale.Index);
+	EPIC_CHECK(fresh.Generation != stale.Generation);
+	EPIC_CHECK(fresh != stale);
+	EPIC_CHECK(!manager.IsValid(stale));
+	EPIC_CHECK(manager.GetEntity(stale) == nullptr);
+	EPIC_CHECK(manager.GetEntity(fresh) == pEntity);
+
+	// Destroying through the stale handle is a no-op
+	manager.DestroyEntity(stale, true);
+	EPIC_CHECK(manager.IsValid(fresh));
+	EPIC_CHECK(manager.GetEntityCount() == 1);
+}
+
+EPIC_TEST(EntityHandle_DestroyInMiddle_KeepsOtherHandlesValid)
+{
+	Epic::EntityManager manager;
+	Epic::EntityID ids[4];
+
+	for (auto& id : ids)
+		id = manager.CreateEntity()->GetID();
+
+	// Destruction swaps the last entity into the vacated position of the packed list
+	manager.DestroyEntity(ids[1], true);
+
+	EPIC_CHECK(manager.GetEntityCount() == 3);
+	EPIC_CHECK(!manager.IsValid(ids[1]));
+
+	for (size_t i : { size_t(0), size_t(2), size_t(3) })
+	{
+		EPIC_CHECK(manager.IsValid(ids[i]));
+		EPIC_CHECK(manager.GetEntity(ids[i])->GetID() == ids[i]);
+	}
+
+	size_t visited = 0;
+	for (size_t i = 0; i < manager.GetEntityCount(); ++i)
+	{
+		if (manager.GetEntityByIndex(i)->GetID() != ids[1])
+			++visited;
+	}
+
+	EPIC_CHECK(visited == 3);
+}
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/EntityManager.hpp>
+#include <Epic/ThreadPool.hpp>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	struct ParallelValue { int Value; };
+}
+
+MAKE_ENTITY_COMPONENT(ParallelValue);
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	/// ParallelFixture - An EntityManager with 'count' entities on a 3-worker pool
+	struct ParallelFixture
+	{
+		Epic::ThreadPool Pool{ 3 };
+		Epic::EntityManager Manager;
+
+		explicit ParallelFixture(int count)
+		{
+			Manager.SetUpdateMode(Epic::eEntityUpdateMode::Parallel, &Pool);
+
+			for (int i = 0; i < count; ++i)
+				Manager.CreateEntity()->Assign<ParallelValue>(i);
+		}
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(ParallelReduce_SumsEveryChunk)
+{
+	ParallelFixture fixture{ 1000 };
+
+	const long long sum = fixture.Manager.ParallelReduce<ParallelValue>(0LL,
+		[] (long long& result, Epic::Entity&, ParallelValue& value) { result += value.Value; },
+		[] (long long a, long long b) { return a + b; }, 7);
+
+	EPIC_CHECK(sum == 999LL * 1000 / 2);
+}
+
+EPIC_TEST(ParallelReduce_BoolResult)
+{
+	ParallelFixture fixture{ 1000 };
+
+	const bool found = fixture.Manager.ParallelReduce<ParallelValue>(false,
+		[] (bool& result, Epic::Entity&, ParallelValue& value) { result = result || value.Value == 777; },
+		[] (bool a, bool b) { return a || b; }, 1);
+
+	const bool missing = fixture.Manager.ParallelReduce<ParallelValue>(false,
+		[] (bool& result, Epic::Entity&, ParallelValue& value) { result = result || value.Value < 0; },
+		[] (bool a, bool b) { return a || b; }, 1);
+
+	EPIC_CHECK(found);
+	EPIC_CHECK(!missing);
+}
@@ -0,0 +1,262 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/EntityManager.hpp>
+#include <Epic/ScheduledEntitySystem.hpp>
+#include <Epic/ThreadPool.hpp>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	struct VersionPosition { float X; };
+	struct VersionVelocity { float X; };
+	struct VersionHeading { float Angle; };
+}
+
+MAKE_ENTITY_COMPONENT(VersionPosition);
+MAKE_ENTITY_COMPONENT(VersionVelocity);
+MAKE_ENTITY_COMPONENT(VersionHeading);
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using VersionType = Epic::detail::EntityComponentStorage::VersionType;
+
+	/// IntegrateSystem - Writes positions and reads the stamps of neighbouring entities
+	class IntegrateSystem : public Epic::ScheduledEntitySystem<Epic::Reads<VersionVelocity>, Epic::Writes<VersionPosition>>
+	{
+	public:
+		const Epic::STLVector<Epic::Entity*>* pEntities = nullptr;
+		std::atomic<size_t> NeighbourStamps{ 0 };
+
+	public:
+		using ScheduledEntitySystem::ScheduledEntitySystem;
+
+		void Update() override
+		{
+			const auto& entities = *pEntities;
+			const auto version = GetEntityManager()->GetVersion();
+
+			GetEntityManager()->ParallelEach<VersionPosition, VersionVelocity>(
+				[&] (Epic::Entity& entity, VersionPosition& position, VersionVelocity& velocity)
+				{
+					position.X += velocity.X;
+					entity.MarkChanged<VersionPosition>();
+
+					// The neighbour may be in a chunk that another worker is stamping
+					const size_t next = (entity.GetIndex() + 1) % entities.size();
+					if (entities[next]->GetVersion<VersionPosition>() == version)
+						NeighbourStamps.fetch_add(1, std::memory_order_relaxed);
+				}, 64);
+		}
+	};
+
+	/// ReadVelocitySystem - Reads velocities through mutable references
+	class ReadVelocitySystem : public Epic::ScheduledEntitySystem<Epic::Reads<VersionVelocity>>
+	{
+	public:
+		std::atomic<size_t> Visited{ 0 };
+
+	public:
+		using ScheduledEntitySystem::ScheduledEntitySystem;
+
+		void Update() override
+		{
+			GetEntityManager()->ParallelEach<VersionVelocity>([this] (Epic::Entity& entity, VersionVelocity&)
+			{
+				if (entity.Get<VersionVelocity>().X > 0.0f)
+					Visited.fetch_add(1, std::memory_order_relaxed);
+			}, 64);
+		}
+	};
+
+	/// SteerSystem - Reads velocity stamps and writes headings
+	class SteerSystem : public Epic::ScheduledEntitySystem<Epic::Reads<VersionVelocity>, Epic::Writes<VersionHeading>>
+	{
+	public:
+		std::atomic<size_t> ChangedVelocities{ 0 };
+
+	public:
+		using ScheduledEntitySystem::ScheduledEntitySystem;
+
+		void Update() override
+		{
+			const auto since = GetLastRunVersion();
+
+			GetEntityManager()->ParallelEach<VersionVelocity, VersionHeading>(
+				[&] (Epic::Entity& entity, VersionVelocity&, VersionHeading&)
+				{
+					if (entity.ChangedSince<VersionVelocity>(since))
+						ChangedVelocities.fetch_add(1, std::memory_order_relaxed);
+
+					entity.Modify<VersionHeading>().Angle += 1.0f;
+				}, 64);
+		}
+	};
+
+	/// ChangeCounter<C> - Counts the components that changed since the system last ran
+	template<class C, class Write = C>
+	class ChangeCounter : public Epic::ScheduledEntitySystem<Epic::Reads<C>, Epic::Writes<Write>>
+	{
+	public:
+		size_t Changed = 0;
+		bool Touch = false;
+
+	public:
+		using ChangeCounter::ScheduledEntitySystem::ScheduledEntitySystem;
+
+		void Update() override
+		{
+			const auto since = this->GetLastRunVersion();
+			Changed = 0;
+
+			for (auto pEntity : this->GetEntityManager()->template Each<C>())
+			{
+				if (pEntity->template ChangedSince<C>(since))
+					++Changed;
+
+				if (Touch)
+					pEntity->template MarkChanged<Write>();
+			}
+		}
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(Versions_SystemsSeeChangesSinceTheirLastRun)
+{
+	Epic::EntityManager manager;
+
+	auto pEntity = manager.CreateEntity();
+	pEntity->Assign<VersionPosition>(0.0f);
+	pEntity->Assign<VersionHeading>(0.0f);
+
+	// pWriter stamps headings; pReader (which runs after it) reads them
+	auto pWriter = manager.CreateSystem<ChangeCounter<VersionPosition, VersionHeading>>();
+	auto pReader = manager.CreateSystem<ChangeCounter<VersionHeading>>();
+	auto pSelf = manager.CreateSystem<ChangeCounter<VersionPosition>>();
+	pWriter->Touch = true;
+	pSelf->Touch = true;
+
+	EPIC_CHECK(pWriter->GetLastRunVersion() == 0);
+
+	manager.Update();
+
+	EPIC_CHECK(pReader->Changed == 1);
+	EPIC_CHECK(pSelf->Changed == 1);
+	EPIC_CHECK(pWriter->GetLastRunVersion() < pReader->GetLastRunVersion());
+	EPIC_CHECK(pReader->GetLastRunVersion() < pSelf->GetLastRunVersion());
+	EPIC_CHECK(pSelf->GetLastRunVersion() < manager.GetVersion());
+
+	// The writer's stamps from this frame are seen by the reader, but a system's own are not
+	manager.Update();
+
+	EPIC_CHECK(pReader->Changed == 1);
+	EPIC_CHECK(pSelf->Changed == 0);
+
+	// Changes made between updates are newer than every system's last run
+	pWriter->Touch = false;
+	pEntity->Modify<VersionPosition>().X = 1.0f;
+
+	manager.Update();
+
+	EPIC_CHECK(pWriter->Changed == 1);
+	EPIC_CHECK(pReader->Changed == 0);
+	EPIC_CHECK(pSelf->Changed == 1);
+
+	manager.Update();
+
+	EPIC_CHECK(pWriter->Changed == 1);
+	EPIC_CHECK(pSelf->Changed == 0);
+}
+
+EPIC_TEST(Versions_OnlyModifyAndMarkChangedStamp)
+{
+	Epic::EntityManager manager;
+
+	auto pEntity = manager.CreateEntity();
+	pEntity->Assign<VersionPosition>(1.0f);
+
+	const VersionType assigned = pEntity->GetVersion<VersionPosition>();
+	manager.Update();
+
+	pEntity->Get<VersionPosition>().X += 1.0f;
+	manager.Each<VersionPosition>(std::function<void(Epic::Entity&, VersionPosition&)>
+	{
+		[] (Epic::Entity&, VersionPosition& position) { position.X += 1.0f; }
+	});
+
+	EPIC_CHECK(pEntity->GetVersion<VersionPosition>() == assigned);
+	EPIC_CHECK(!pEntity->ChangedSince<VersionPosition>(assigned));
+
+	pEntity->Modify<VersionPosition>().X += 1.0f;
+	EPIC_CHECK(pEntity->GetVersion<VersionPosition>() == manager.GetVersion());
+
+	manager.Update();
+
+	pEntity->MarkChanged<VersionPosition>();
+	EPIC_CHECK(pEntity->GetVersion<VersionPosition>() == manager.GetVersion());
+	EPIC_CHECK(pEntity->Get<VersionPosition>().X == 4.0f);
+}
+
+// Build with -DEPIC_SANITIZE=thread to check this test for data races
+EPIC_TEST(Versions_ParallelSystemsStampAndRead)
+{
+	constexpr size_t EntityCount = 4096;
+	constexpr size_t FrameCount = 4;
+
+	Epic::ThreadPool pool{ 3 };
+	Epic::EntityManager manager;
+	manager.SetUpdateMode(Epic::eEntityUpdateMode::Parallel, &pool);
+
+	Epic::STLVector<Epic::Entity*> entities;
+
+	for (size_t i = 0; i < EntityCount; ++i)
+	{
+		auto pEntity = manager.CreateEntity();
+		pEntity->Assign<VersionPosition>(0.0f);
+		pEntity->Assign<VersionVelocity>(1.0f);
+		pEntity->Assign<VersionHeading>(0.0f);
+		entities.push_back(pEntity);
+	}
+
+	auto pIntegrate = manager.CreateSystem<IntegrateSystem>();
+	auto pRead = manager.CreateSystem<ReadVelocitySystem>();
+	auto pSteer = manager.CreateSystem<SteerSystem>();
+	pIntegrate->pEntities = &entities;
+
+	const VersionType velocityVersion = entities[0]->GetVersion<VersionVelocity>();
+
+	for (size_t frame = 0; frame < FrameCount; ++frame)
+	{
+		const VersionType before = manager.GetVersion();
+
+		manager.Update();
+
+		for (auto pEntity : entities)
+		{
+			EPIC_CHECK(pEntity->GetVersion<VersionPosition>() >= before);
+			EPIC_CHECK(pEntity->GetVersion<VersionHeading>() >= before);
+			EPIC_CHECK(pEntity->GetVersion<VersionVelocity>() == velocityVersion);
+		}
+	}
+
+	EPIC_CHECK(entities[7]->Get<VersionPosition>().X == float(FrameCount));
+	EPIC_CHECK(entities[7]->Get<VersionHeading>().Angle == float(FrameCount));
+	EPIC_CHECK(pRead->Visited.load() == EntityCount * FrameCount);
+	EPIC_CHECK(pSteer->ChangedVelocities.load() == EntityCount);
+}
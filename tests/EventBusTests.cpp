@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/EventBus.hpp>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	struct TestPing { int Value; };
+	struct TestPong { int Value; };
+}
+
+MAKE_EVENT(TestPing);
+MAKE_EVENT(TestPong);
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(EventBus_Dispatch_DeliversOneBatchPerType)
+{
+	Epic::EventBus bus;
+	std::vector<std::string> log;
+
+	bus.Connect<TestPing>([&] (const TestPing* pRecords, size_t count)
+	{
+		std::string entry = "ping:";
+
+		for (size_t i = 0; i < count; ++i)
+			entry += std::to_string(pRecords[i].Value);
+
+		log.push_back(entry);
+	});
+
+	bus.Connect<TestPong>([&] (const TestPong*, size_t count)
+	{
+		log.push_back("pong:" + std::to_string(count));
+	});
+
+	bus.Post(TestPing{ 1 });
+	bus.Emplace<TestPong>(7);
+	bus.Emplace<TestPing>(2);
+	bus.Post(TestPing{ 3 });
+
+	EPIC_CHECK(bus.GetPendingCount() == 4);
+	EPIC_CHECK(bus.Dispatch() == 4);
+	EPIC_CHECK((log == std::vector<std::string>{ "ping:123", "pong:1" }));
+	EPIC_CHECK(bus.GetPendingCount() == 0);
+	EPIC_CHECK(bus.Dispatch() == 0);
+}
+
+EPIC_TEST(EventBus_PostDuringDispatch_DeliveredByNextDispatch)
+{
+	Epic::EventBus bus;
+	std::vector<std::string> log;
+
+	// Ping's channel is created first, so a pong posted while pings are 
+	// delivered would reach the pong channel before it is visited
+	bus.Connect<TestPing>([&] (const TestPing* pRecords, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			log.push_back("ping:" + std::to_string(pRecords[i].Value));
+			bus.Post(TestPong{ pRecords[i].Value });
+		}
+	});
+
+	bus.Connect<TestPong>([&] (const TestPong* pRecords, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			log.push_back("pong:" + std::to_string(pRecords[i].Value));
+
+			if (pRecords[i].Value < 2)
+				bus.Post(TestPing{ pRecords[i].Value + 1 });
+		}
+	});
+
+	bus.Post(TestPing{ 0 });
+
+	EPIC_CHECK(bus.Dispatch() == 1);
+	EPIC_CHECK((log == std::vector<std::string>{ "ping:0" }));
+	EPIC_CHECK(bus.GetPendingCount() == 1);
+
+	EPIC_CHECK(bus.Dispatch() == 1);
+	EPIC_CHECK((log == std::vector<std::string>{ "ping:0", "pong:0" }));
+
+	EPIC_CHECK(bus.Dispatch() == 1);
+	EPIC_CHECK(bus.Dispatch() == 1);
+	EPIC_CHECK(bus.Dispatch() == 1);
+	EPIC_CHECK(bus.Dispatch() == 1);
+	EPIC_CHECK(bus.Dispatch() == 0);
+	EPIC_CHECK((log == std::vector<std::string>{ "ping:0", "pong:0", "ping:1", "pong:1", "ping:2", "pong:2" }));
+}
+
+EPIC_TEST(EventBus_Clear_DiscardsPendingRecords)
+{
+	Epic::EventBus bus;
+	size_t delivered = 0;
+
+	bus.Connect<TestPing>([&] (const TestPing*, size_t count) { delivered += count; });
+
+	bus.Post(TestPing{ 1 });
+	bus.Post(TestPing{ 2 });
+	bus.Clear();
+
+	EPIC_CHECK(bus.GetPendingCount() == 0);
+	EPIC_CHECK(bus.Dispatch() == 0);
+	EPIC_CHECK(delivered == 0);
+}
@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/Event.hpp>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(EventPriority_Invoke_OrdersByPriorityThenSubscription)
+{
+	Epic::Event<void()> evt;
+	std::string order;
+
+	evt.Connect([&] { order += "n1 "; });
+	evt.Connect([&] { order += "low "; }, Epic::eEventPriority::Low);
+	evt.Connect([&] { order += "high "; }, Epic::eEventPriority::High);
+	evt.Connect([&] { order += "n2 "; });
+	evt.Connect([&] { order += "highest "; }, Epic::eEventPriority::Highest);
+
+	evt();
+
+	EPIC_CHECK(order == "highest high n1 n2 low ");
+}
+
+EPIC_TEST(EventPriority_Disconnect_PreservesOrderOfOthers)
+{
+	Epic::Event<void()> evt;
+	std::string order;
+
+	evt.Connect([&] { order += "a "; }, Epic::StringHash{ "a" }, Epic::eEventPriority::Low);
+	evt.Connect([&] { order += "b "; }, Epic::StringHash{ "b" }, Epic::eEventPriority::High);
+	evt.Connect([&] { order += "c "; }, Epic::StringHash{ "c" });
+	evt.Connect([&] { order += "d "; }, Epic::StringHash{ "d" }, Epic::eEventPriority::High);
+
+	evt.Disconnect(Epic::StringHash{ "d" });
+	evt.Disconnect(Epic::StringHash{ "c" });
+	EPIC_CHECK(evt.GetListenerCount() == 2);
+
+	evt();
+	EPIC_CHECK(order == "b a ");
+
+	// A reconnected listener is ordered as a new subscription
+	evt.Connect([&] { order += "c "; }, Epic::StringHash{ "c" }, Epic::eEventPriority::High);
+
+	order.clear();
+	evt();
+	EPIC_CHECK(order == "b c a ");
+}
+
+EPIC_TEST(EventPriority_ConnectDuringInvoke_AppliesAfterInvoke)
+{
+	Epic::Event<void()> evt;
+	std::string order;
+	bool connected = false;
+
+	evt.Connect([&]
+	{
+		order += "first ";
+
+		if (!connected)
+		{
+			connected = true;
+			evt.Connect([&] { order += "urgent "; }, Epic::eEventPriority::Highest);
+		}
+	});
+
+	evt();
+	EPIC_CHECK(order == "first ");
+
+	order.clear();
+	evt();
+	EPIC_CHECK(order == "urgent first ");
+}
+
+EPIC_TEST(EventPriority_InvokeUntil_StopsAtFirstMatch)
+{
+	Epic::Event<bool(int)> evt;
+	std::string order;
+
+	evt.Connect([&] (int) { order += "normal "; return true; });
+	evt.Connect([&] (int x) { order += "high "; return x > 0; }, Epic::eEventPriority::High);
+	evt.Connect([&] (int) { order += "low "; return true; }, Epic::eEventPriority::Low);
+
+	// The high priority listener handles positive values; the rest are not invoked
+	EPIC_CHECK(evt.InvokeUntil(true, 1));
+	EPIC_CHECK(order == "high ");
+
+	order.clear();
+	EPIC_CHECK(evt.InvokeUntil(true, -1));
+	EPIC_CHECK(order == "high normal ");
+
+	order.clear();
+	auto isNegative = [] (bool handled) { return !handled; };
+	EPIC_CHECK(!evt.InvokeUntil(isNegative, 1));
+	EPIC_CHECK(order == "high normal low ");
+}
+
+EPIC_TEST(EventPriority_InvokeWhile_StopsAtFirstMismatch)
+{
+	Epic::Event<bool()> evt;
+	std::string order;
+
+	evt.Connect([&] { order += "normal "; return false; });
+	evt.Connect([&] { order += "high "; return true; }, Epic::eEventPriority::High);
+	evt.Connect([&] { order += "low "; return true; }, Epic::eEventPriority::Low);
+
+	EPIC_CHECK(!evt.InvokeWhile(true));
+	EPIC_CHECK(order == "high normal ");
+}
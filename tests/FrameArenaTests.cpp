@@ -0,0 +1,55 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/Memory/FrameArena.hpp>
+#include <Epic/Memory/Mallocator.hpp>
+#include <Epic/STL/Vector.hpp>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using TestFrameArena = Epic::FrameArena<Epic::Mallocator, 4096>;
+	using TestFrameArenaAllocator = Epic::FrameArenaAllocator<TestFrameArena>;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(FrameArenaAllocator_EachThreadUsesItsOwnArena)
+{
+	TestFrameArena* pMainArena = &TestFrameArenaAllocator::Arena();
+	TestFrameArena* pThreadArenas[2] = { };
+
+	auto worker = [] (TestFrameArena** ppArena)
+	{
+		*ppArena = &TestFrameArenaAllocator::Arena();
+
+		Epic::STLVector<int, TestFrameArenaAllocator> values;
+		for (int i = 0; i < 1000; ++i)
+			values.push_back(i);
+
+		TestFrameArenaAllocator::Arena().NextFrame();
+	};
+
+	std::thread a{ worker, &pThreadArenas[0] };
+	std::thread b{ worker, &pThreadArenas[1] };
+	a.join();
+	b.join();
+
+	EPIC_CHECK(pThreadArenas[0] != pMainArena);
+	EPIC_CHECK(pThreadArenas[1] != pMainArena);
+	EPIC_CHECK(pThreadArenas[0] != pThreadArenas[1]);
+	EPIC_CHECK(&TestFrameArenaAllocator::Arena() == pMainArena);
+}
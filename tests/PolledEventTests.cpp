@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/Event.hpp>
+#include <chrono>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(PolledEvent_Poll_DrainsPendingInvocationsOnce)
+{
+	Epic::PolledEvent<void(int)> evt;
+	std::vector<int> received;
+
+	evt.Connect([&] (int x) { received.push_back(x); });
+
+	evt(1);
+	evt(2);
+	evt(3);
+
+	EPIC_CHECK(received.empty());
+	EPIC_CHECK(evt.GetPendingCount() == 3);
+	EPIC_CHECK(evt.Poll() == 3);
+	EPIC_CHECK((received == std::vector<int>{ 1, 2, 3 }));
+	EPIC_CHECK(evt.GetPendingCount() == 0);
+
+	// Nothing is re-dispatched
+	EPIC_CHECK(evt.Poll() == 0);
+	EPIC_CHECK(received.size() == 3);
+}
+
+EPIC_TEST(PolledEvent_InvokedDuringPoll_DispatchedByNextPoll)
+{
+	Epic::PolledEvent<void(int)> evt;
+	std::vector<int> received;
+
+	evt.Connect([&] (int x)
+	{
+		received.push_back(x);
+
+		if (x < 3)
+			evt(x + 1);
+	});
+
+	evt(1);
+
+	EPIC_CHECK(evt.Poll() == 1);
+	EPIC_CHECK((received == std::vector<int>{ 1 }));
+	EPIC_CHECK(evt.GetPendingCount() == 1);
+
+	EPIC_CHECK(evt.Poll() == 1);
+	EPIC_CHECK(evt.Poll() == 1);
+	EPIC_CHECK(evt.Poll() == 0);
+	EPIC_CHECK((received == std::vector<int>{ 1, 2, 3 }));
+}
+
+EPIC_TEST(PolledEvent_PollForCount_ResumesInOrder)
+{
+	Epic::PolledEvent<void(int)> evt;
+	std::vector<int> received;
+
+	evt.Connect([&] (int x) { received.push_back(x); });
+
+	for (int i = 0; i < 5; ++i)
+		evt(i);
+
+	EPIC_CHECK(evt.PollFor(2) == 2);
+	EPIC_CHECK((received == std::vector<int>{ 0, 1 }));
+	EPIC_CHECK(evt.GetPendingCount() == 3);
+
+	// Invocations made between polls queue behind the undispatched ones
+	evt(5);
+
+	EPIC_CHECK(evt.PollFor(3) == 3);
+	EPIC_CHECK((received == std::vector<int>{ 0, 1, 2, 3, 4 }));
+
+	EPIC_CHECK(evt.PollFor(10) == 1);
+	EPIC_CHECK((received == std::vector<int>{ 0, 1, 2, 3, 4, 5 }));
+	EPIC_CHECK(evt.PollFor(10) == 0);
+}
+
+EPIC_TEST(PolledEvent_PollForBudget_DispatchesAtLeastOne)
+{
+	Epic::PolledEvent<void(int)> evt;
+	std::vector<int> received;
+
+	evt.Connect([&] (int x) { received.push_back(x); });
+
+	evt(1);
+	evt(2);
+
+	// An exhausted budget still makes progress
+	EPIC_CHECK(evt.PollFor(std::chrono::nanoseconds{ 0 }) == 1);
+	EPIC_CHECK((received == std::vector<int>{ 1 }));
+
+	EPIC_CHECK(evt.PollFor(std::chrono::seconds{ 10 }) == 1);
+	EPIC_CHECK((received == std::vector<int>{ 1, 2 }));
+	EPIC_CHECK(evt.PollFor(std::chrono::seconds{ 10 }) == 0);
+}
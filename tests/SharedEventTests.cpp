@@ -0,0 +1,150 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/SharedEvent.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(SharedEvent_ConnectDisconnect_OrdersByPriority)
+{
+	Epic::SharedEvent<void()> evt;
+	std::string order;
+
+	evt.Connect([&] { order += "a "; }, Epic::StringHash{ "a" });
+	evt.Connect([&] { order += "b "; }, Epic::StringHash{ "b" }, Epic::eEventPriority::High);
+	evt.Connect([&] { order += "c "; }, Epic::StringHash{ "c" });
+
+	EPIC_CHECK(evt.GetListenerCount() == 3);
+
+	evt();
+	EPIC_CHECK(order == "b a c ");
+
+	evt.Disconnect(Epic::StringHash{ "a" });
+	EPIC_CHECK(evt.GetListenerCount() == 2);
+
+	order.clear();
+	evt();
+	EPIC_CHECK(order == "b c ");
+
+	evt.DisconnectAll();
+	EPIC_CHECK(!evt);
+}
+
+EPIC_TEST(SharedEvent_MutateDuringInvoke_AppliesToNextInvoke)
+{
+	Epic::SharedEvent<void()> evt;
+	std::string order;
+	bool connected = false;
+
+	evt.Connect([&]
+	{
+		order += "self ";
+
+		// Disconnecting mid-invocation must not skip or invalidate the remaining listeners
+		evt.Disconnect(Epic::StringHash{ "self" });
+
+		if (!connected)
+		{
+			connected = true;
+			evt.Connect([&] { order += "new "; }, Epic::eEventPriority::Highest);
+		}
+	}, Epic::StringHash{ "self" }, Epic::eEventPriority::High);
+
+	evt.Connect([&] { order += "other "; });
+
+	evt();
+	EPIC_CHECK(order == "self other ");
+
+	order.clear();
+	evt();
+	EPIC_CHECK(order == "new other ");
+}
+
+EPIC_TEST(SharedEvent_Synchronize_WaitsForInProgressInvocations)
+{
+	Epic::SharedEvent<void()> evt;
+	std::atomic<bool> entered{ false };
+	std::atomic<bool> disconnected{ false };
+	std::atomic<bool> finished{ false };
+
+	evt.Connect([&]
+	{
+		entered = true;
+
+		while (!disconnected)
+			std::this_thread::yield();
+
+		// Give Synchronize() a chance to return early if it is broken
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+		finished = true;
+	}, Epic::StringHash{ "slow" });
+
+	std::thread invoker{ [&] { evt(); } };
+
+	while (!entered)
+		std::this_thread::yield();
+
+	evt.Disconnect(Epic::StringHash{ "slow" });
+	disconnected = true;
+
+	evt.Synchronize();
+	EPIC_CHECK(finished);
+
+	invoker.join();
+	EPIC_CHECK(evt.GetListenerCount() == 0);
+}
+
+EPIC_TEST(SharedEvent_ConcurrentInvokeAndMutate_StaysConsistent)
+{
+	constexpr int InvokerCount = 3;
+	constexpr int Iterations = 2000;
+
+	Epic::SharedEvent<void(int)> evt;
+	std::atomic<int> calls{ 0 };
+	std::atomic<bool> stop{ false };
+
+	evt.Connect([&] (int) { calls.fetch_add(1, std::memory_order_relaxed); });
+
+	std::vector<std::thread> invokers;
+	for (int i = 0; i < InvokerCount; ++i)
+	{
+		invokers.emplace_back([&evt, &stop]
+		{
+			for (int n = 0; !stop; ++n)
+				evt(n);
+		});
+	}
+
+	// Churn a second listener while the invokers run
+	for (int i = 0; i < Iterations; ++i)
+	{
+		evt.Connect([&] (int) { calls.fetch_add(1, std::memory_order_relaxed); }, Epic::StringHash{ "churn" });
+		evt.Disconnect(Epic::StringHash{ "churn" });
+	}
+
+	stop = true;
+	for (auto& invoker : invokers)
+		invoker.join();
+
+	EPIC_CHECK(evt.GetListenerCount() == 1);
+
+	const int before = calls;
+	evt(0);
+	EPIC_CHECK(calls == before + 1);
+}
@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace Epic::Test
+{
+	/// TestCase - A named test function
+	struct TestCase
+	{
+		const char* Name;
+		void (*pRun)();
+	};
+
+	inline std::vector<TestCase>& GetTestCases()
+	{
+		static std::vector<TestCase> s_Cases;
+		return s_Cases;
+	}
+
+	inline size_t& GetFailureCount() noexcept
+	{
+		static size_t s_Failures = 0;
+		return s_Failures;
+	}
+
+	/// TestRegistrar - Adds a test to GetTestCases() during static initialization
+	struct TestRegistrar
+	{
+		TestRegistrar(const char* name, void (*pRun)())
+		{
+			GetTestCases().push_back({ name, pRun });
+		}
+	};
+
+	inline void Fail(const char* expr, const char* file, int line) noexcept
+	{
+		std::fprintf(stderr, "  FAILED %s (%s:%d)\n", expr, file, line);
+		++GetFailureCount();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define EPIC_TEST(name) \
+	static void name(); \
+	static const Epic::Test::TestRegistrar name##_Registrar{ #name, &name }; \
+	static void name()
+
+#define EPIC_CHECK(expr) \
+	do { if (!(expr)) Epic::Test::Fail(#expr, __FILE__, __LINE__); } while (0)
@@ -0,0 +1,40 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////
+
+// epic_tests [FILTER]
+//	Runs every registered test whose name contains FILTER.
+//	Returns non-zero if any check failed.
+int main(int argc, char** argv)
+{
+	const char* filter = (argc > 1) ? argv[1] : "";
+
+	for (const auto& test : Epic::Test::GetTestCases())
+	{
+		if (std::strstr(test.Name, filter) == nullptr)
+			continue;
+
+		const size_t failures = Epic::Test::GetFailureCount();
+
+		test.pRun();
+
+		std::printf("%-56s %s\n", test.Name, (Epic::Test::GetFailureCount() == failures) ? "ok" : "FAILED");
+		std::fflush(stdout);
+	}
+
+	return Epic::Test::GetFailureCount() ? 1 : 0;
+}
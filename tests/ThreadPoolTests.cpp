@@ -0,0 +1,81 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//            Copyright (c) 2017 Ronnie Brohn (EpicBrownie)      
+//
+//                Distributed under The MIT License (MIT).
+//             (See accompanying file License.txt or copy at 
+//                 https://opensource.org/licenses/MIT)
+//
+//           Please report any bugs, typos, or suggestions to
+//              https://github.com/epicbrownie/Epic/issues
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TestCommon.hpp"
+#include <Epic/ThreadPool.hpp>
+#include <atomic>
+#include <memory>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	/* Returns whether ParallelFor(count) on 'pool' invoked every index exactly once. */
+	bool VisitsEachIndexOnce(Epic::ThreadPool& pool, size_t count)
+	{
+		std::unique_ptr<std::atomic<int>[]> visits{ new std::atomic<int>[count + 1] };
+		for (size_t i = 0; i <= count; ++i)
+			visits[i] = 0;
+
+		pool.ParallelFor(count, [&] (size_t i) { visits[i].fetch_add(1, std::memory_order_relaxed); });
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (visits[i].load() != 1)
+				return false;
+		}
+
+		return visits[count].load() == 0;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+EPIC_TEST(ThreadPool_ParallelForVisitsEachIndexOnce)
+{
+	Epic::ThreadPool pool{ 3 };
+	Epic::ThreadPool inlinePool{ 0 };
+
+	for (size_t count : { 0, 1, 2, 7, 16, 17, 100, 1000 })
+	{
+		EPIC_CHECK(VisitsEachIndexOnce(pool, count));
+		EPIC_CHECK(VisitsEachIndexOnce(inlinePool, count));
+	}
+}
+
+EPIC_TEST(ThreadPool_NestedParallelFor)
+{
+	Epic::ThreadPool pool{ 3 };
+	std::atomic<size_t> total{ 0 };
+
+	pool.ParallelFor(8, [&] (size_t)
+	{
+		pool.ParallelFor(50, [&] (size_t i) { total.fetch_add(i, std::memory_order_relaxed); });
+	});
+
+	EPIC_CHECK(total.load() == 8 * (49 * 50 / 2));
+}
+
+EPIC_TEST(ThreadPool_SubmittedTasksRunBeforeDestruction)
+{
+	std::atomic<size_t> ran{ 0 };
+
+	{
+		Epic::ThreadPool pool{ 2 };
+
+		for (size_t i = 0; i < 500; ++i)
+			pool.Submit([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+	}
+
+	EPIC_CHECK(ran.load() == 500);
+}